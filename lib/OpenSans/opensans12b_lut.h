@@ -0,0 +1,91 @@
+#pragma once
+#include "font_lookup.h"
+#include "opensans12b.h"
+
+// Generated by tools/font_lut.py from opensans12b.h, do not edit.
+const uint16_t OpenSans12BLatin1[256] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+};
+const FontLookup OpenSans12BLookup = {&OpenSans12B, OpenSans12BLatin1, NULL, 0};
+// advance_x, left, width, top, height, present
+constexpr GlyphMetrics OpenSans12BMetrics[256] = {
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {7, 0, 0, 0, 0, true}, {7, 1, 5, 18, 18, true}, {12, 1, 10, 18, 6, true}, {16, 0, 16, 18, 18, true},
+    {14, 1, 13, 19, 20, true}, {23, 0, 22, 18, 18, true}, {19, 1, 18, 18, 18, true}, {7, 1, 5, 18, 6, true},
+    {8, 1, 7, 18, 22, true}, {8, 0, 8, 18, 22, true}, {14, 0, 13, 19, 13, true}, {14, 1, 13, 15, 13, true},
+    {7, 0, 6, 3, 6, true}, {8, 0, 8, 8, 4, true}, {7, 1, 5, 5, 5, true}, {10, 0, 11, 18, 18, true},
+    {14, 0, 14, 18, 18, true}, {14, 1, 10, 18, 18, true}, {14, 0, 14, 18, 18, true}, {14, 0, 14, 18, 18, true},
+    {14, 0, 14, 18, 18, true}, {14, 1, 13, 18, 18, true}, {14, 0, 14, 18, 18, true}, {14, 0, 14, 18, 18, true},
+    {14, 0, 14, 18, 18, true}, {14, 0, 14, 18, 18, true}, {7, 1, 5, 14, 14, true}, {7, 0, 6, 14, 17, true},
+    {14, 1, 13, 16, 14, true}, {14, 1, 13, 13, 7, true}, {14, 1, 13, 16, 14, true}, {12, 0, 12, 18, 18, true},
+    {22, 1, 21, 18, 20, true}, {17, 0, 18, 18, 18, true}, {17, 2, 14, 18, 18, true}, {16, 1, 15, 18, 18, true},
+    {19, 2, 16, 18, 18, true}, {14, 2, 11, 18, 18, true}, {14, 2, 11, 18, 18, true}, {18, 1, 16, 18, 18, true},
+    {19, 2, 15, 18, 18, true}, {8, 2, 5, 18, 18, true}, {8, -2, 9, 18, 23, true}, {17, 2, 15, 18, 18, true},
+    {14, 2, 12, 18, 18, true}, {24, 2, 20, 18, 18, true}, {20, 2, 17, 18, 18, true}, {20, 1, 18, 18, 18, true},
+    {16, 2, 13, 18, 18, true}, {20, 1, 18, 18, 22, true}, {17, 2, 15, 18, 18, true}, {14, 1, 12, 18, 18, true},
+    {14, 0, 14, 18, 18, true}, {19, 2, 15, 18, 18, true}, {16, 0, 17, 18, 18, true}, {24, 0, 25, 18, 18, true},
+    {17, 0, 17, 18, 18, true}, {16, 0, 16, 18, 18, true}, {14, 0, 14, 18, 18, true}, {8, 1, 7, 18, 22, true},
+    {10, 0, 11, 18, 18, true}, {8, 0, 7, 18, 22, true}, {13, 0, 14, 18, 12, true}, {10, -1, 12, -2, 2, true},
+    {15, 4, 8, 19, 4, true}, {15, 1, 13, 14, 14, true}, {16, 1, 14, 19, 19, true}, {13, 1, 12, 14, 14, true},
+    {16, 1, 13, 19, 19, true}, {15, 1, 13, 14, 14, true}, {10, 0, 11, 19, 19, true}, {14, 0, 14, 14, 20, true},
+    {16, 1, 14, 19, 19, true}, {8, 1, 5, 19, 19, true}, {8, -2, 8, 19, 25, true}, {16, 1, 15, 19, 19, true},
+    {8, 1, 5, 19, 19, true}, {25, 1, 22, 14, 14, true}, {16, 1, 14, 14, 14, true}, {15, 1, 14, 14, 14, true},
+    {16, 1, 14, 14, 20, true}, {16, 1, 13, 14, 20, true}, {11, 1, 10, 14, 14, true}, {12, 1, 11, 14, 14, true},
+    {11, 0, 11, 17, 17, true}, {16, 1, 14, 14, 14, true}, {14, 0, 15, 14, 14, true}, {21, 0, 22, 14, 14, true},
+    {14, 0, 15, 14, 14, true}, {14, 0, 15, 14, 20, true}, {12, 0, 12, 14, 14, true}, {10, 0, 9, 18, 22, true},
+    {14, 5, 4, 19, 25, true}, {10, 1, 9, 18, 22, true}, {14, 1, 13, 12, 7, true}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {7, 0, 0, 0, 0, true}, {7, 1, 5, 14, 19, true}, {14, 1, 12, 18, 18, true}, {14, 1, 13, 18, 18, true},
+    {14, 1, 12, 15, 13, true}, {14, 0, 15, 18, 18, true}, {14, 5, 4, 19, 25, true}, {12, 1, 10, 19, 19, true},
+    {15, 3, 9, 20, 4, true}, {21, 1, 19, 18, 18, true}, {10, 0, 9, 18, 9, true}, {15, 1, 14, 13, 12, true},
+    {14, 1, 13, 10, 7, true}, {8, 0, 8, 8, 4, true}, {21, 1, 19, 18, 18, true}, {13, -1, 14, 22, 3, true},
+    {11, 1, 9, 18, 8, true}, {14, 1, 13, 16, 16, true}, {9, 0, 9, 18, 11, true}, {9, 0, 9, 18, 11, true},
+    {15, 4, 8, 19, 4, true}, {17, 1, 14, 14, 20, true}, {16, 1, 14, 19, 22, true}, {7, 1, 5, 11, 5, true},
+    {5, -1, 7, 0, 6, true}, {9, 1, 7, 18, 11, true}, {10, 0, 9, 18, 9, true}, {15, 1, 14, 13, 12, true},
+    {22, 0, 21, 18, 18, true}, {22, 0, 21, 18, 18, true}, {22, 1, 20, 18, 18, true}, {12, 0, 12, 14, 19, true},
+    {17, 0, 18, 23, 23, true}, {17, 0, 18, 23, 23, true}, {17, 0, 18, 23, 23, true}, {17, 0, 18, 23, 23, true},
+    {17, 0, 18, 24, 24, true}, {17, 0, 18, 23, 23, true}, {24, 0, 23, 18, 18, true}, {16, 1, 15, 18, 24, true},
+    {14, 2, 11, 23, 23, true}, {14, 2, 11, 23, 23, true}, {14, 2, 11, 23, 23, true}, {14, 2, 11, 24, 24, true},
+    {8, -1, 8, 23, 23, true}, {8, 2, 8, 23, 23, true}, {8, -2, 12, 23, 23, true}, {8, -1, 10, 24, 24, true},
+    {19, 0, 18, 18, 18, true}, {20, 2, 17, 23, 23, true}, {20, 1, 18, 23, 23, true}, {20, 1, 18, 23, 23, true},
+    {20, 1, 18, 23, 23, true}, {20, 1, 18, 23, 23, true}, {20, 1, 18, 24, 24, true}, {14, 1, 12, 15, 13, true},
+    {20, 1, 18, 19, 20, true}, {19, 2, 15, 23, 23, true}, {19, 2, 15, 23, 23, true}, {19, 2, 15, 23, 23, true},
+    {19, 2, 15, 24, 24, true}, {16, 0, 16, 23, 23, true}, {16, 2, 13, 18, 18, true}, {18, 1, 16, 19, 19, true},
+    {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true},
+    {15, 1, 13, 20, 20, true}, {15, 1, 13, 22, 22, true}, {23, 1, 21, 14, 14, true}, {13, 1, 12, 14, 20, true},
+    {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true}, {15, 1, 13, 20, 20, true},
+    {8, -2, 8, 20, 20, true}, {8, 1, 8, 20, 20, true}, {8, -2, 12, 20, 20, true}, {8, -1, 10, 20, 20, true},
+    {15, 1, 14, 19, 19, true}, {16, 1, 14, 20, 20, true}, {15, 1, 14, 20, 20, true}, {15, 1, 14, 20, 20, true},
+    {15, 1, 14, 20, 20, true}, {15, 1, 14, 20, 20, true}, {15, 1, 14, 20, 20, true}, {14, 1, 13, 15, 13, true},
+    {15, 1, 14, 15, 16, true}, {16, 1, 14, 20, 20, true}, {16, 1, 14, 20, 20, true}, {16, 1, 14, 20, 20, true},
+    {16, 1, 14, 20, 20, true}, {14, 0, 15, 20, 26, true}, {16, 1, 14, 19, 25, true}, {14, 0, 15, 20, 26, true},
+};
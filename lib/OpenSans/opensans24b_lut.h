@@ -0,0 +1,91 @@
+#pragma once
+#include "font_lookup.h"
+#include "opensans24b.h"
+
+// Generated by tools/font_lut.py from opensans24b.h, do not edit.
+const uint16_t OpenSans24BLatin1[256] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+};
+const FontLookup OpenSans24BLookup = {&OpenSans24B, OpenSans24BLatin1, NULL, 0};
+// advance_x, left, width, top, height, present
+constexpr GlyphMetrics OpenSans24BMetrics[256] = {
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {13, 0, 0, 0, 0, true}, {14, 2, 10, 36, 37, true}, {24, 3, 18, 36, 13, true}, {32, 1, 31, 36, 36, true},
+    {29, 2, 25, 38, 41, true}, {45, 1, 43, 36, 36, true}, {38, 2, 36, 36, 36, true}, {13, 3, 8, 36, 13, true},
+    {17, 2, 14, 36, 44, true}, {17, 1, 14, 36, 44, true}, {27, 1, 25, 38, 24, true}, {29, 2, 25, 30, 25, true},
+    {15, 1, 11, 6, 12, true}, {16, 1, 14, 16, 7, true}, {14, 2, 10, 8, 9, true}, {21, 0, 21, 36, 36, true},
+    {29, 1, 26, 36, 36, true}, {29, 2, 19, 36, 36, true}, {29, 1, 26, 36, 36, true}, {29, 1, 26, 36, 36, true},
+    {29, 0, 28, 36, 36, true}, {29, 2, 25, 36, 36, true}, {29, 1, 26, 36, 36, true}, {29, 1, 26, 36, 36, true},
+    {29, 1, 26, 36, 36, true}, {29, 1, 26, 36, 36, true}, {14, 2, 10, 28, 29, true}, {15, 1, 11, 28, 34, true},
+    {29, 2, 25, 32, 28, true}, {29, 2, 25, 25, 15, true}, {29, 2, 25, 32, 28, true}, {24, 0, 23, 36, 37, true},
+    {45, 2, 41, 36, 40, true}, {35, 0, 35, 36, 36, true}, {34, 4, 27, 36, 36, true}, {32, 2, 29, 36, 36, true},
+    {37, 4, 31, 36, 36, true}, {28, 4, 22, 36, 36, true}, {27, 4, 21, 36, 36, true}, {36, 2, 31, 36, 36, true},
+    {38, 4, 30, 36, 36, true}, {17, 4, 9, 36, 36, true}, {17, -4, 17, 36, 46, true}, {33, 4, 30, 36, 36, true},
+    {28, 4, 23, 36, 36, true}, {47, 4, 39, 36, 36, true}, {41, 4, 33, 36, 36, true}, {40, 2, 35, 36, 36, true},
+    {31, 4, 26, 36, 36, true}, {40, 2, 35, 36, 44, true}, {33, 4, 30, 36, 36, true}, {28, 2, 24, 36, 36, true},
+    {29, 1, 27, 36, 36, true}, {38, 4, 30, 36, 36, true}, {33, 0, 33, 36, 36, true}, {48, 0, 49, 36, 36, true},
+    {33, 0, 34, 36, 36, true}, {31, 0, 32, 36, 36, true}, {29, 1, 27, 36, 36, true}, {17, 3, 13, 36, 44, true},
+    {21, 0, 21, 36, 36, true}, {17, 1, 13, 36, 44, true}, {27, 0, 27, 36, 23, true}, {21, -1, 22, -4, 4, true},
+    {30, 8, 15, 38, 8, true}, {30, 2, 25, 28, 28, true}, {32, 3, 27, 38, 38, true}, {26, 2, 23, 28, 28, true},
+    {32, 2, 26, 38, 38, true}, {30, 2, 26, 28, 28, true}, {19, 1, 21, 38, 38, true}, {28, 0, 28, 28, 40, true},
+    {33, 3, 27, 38, 38, true}, {15, 3, 9, 38, 38, true}, {15, -4, 16, 38, 50, true}, {31, 3, 28, 38, 38, true},
+    {15, 3, 9, 38, 38, true}, {49, 3, 43, 28, 28, true}, {33, 3, 27, 28, 28, true}, {31, 2, 27, 28, 28, true},
+    {32, 3, 27, 28, 40, true}, {32, 2, 26, 28, 40, true}, {23, 3, 19, 28, 28, true}, {25, 2, 21, 28, 28, true},
+    {22, 1, 20, 33, 33, true}, {33, 3, 26, 27, 27, true}, {28, 0, 29, 27, 27, true}, {43, 0, 43, 27, 27, true},
+    {29, 0, 29, 27, 27, true}, {28, 0, 29, 27, 39, true}, {24, 1, 22, 27, 27, true}, {20, 0, 18, 36, 44, true},
+    {28, 11, 6, 38, 49, true}, {20, 2, 17, 36, 44, true}, {29, 2, 25, 23, 11, true}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false}, {0, 0, 0, 0, 0, false},
+    {13, 0, 0, 0, 0, true}, {14, 2, 10, 27, 36, true}, {29, 3, 23, 36, 36, true}, {29, 2, 26, 36, 36, true},
+    {29, 2, 24, 29, 23, true}, {29, 0, 29, 36, 36, true}, {28, 11, 6, 38, 49, true}, {24, 2, 20, 38, 38, true},
+    {30, 6, 18, 38, 7, true}, {42, 2, 38, 36, 36, true}, {19, 1, 16, 36, 18, true}, {31, 2, 27, 25, 23, true},
+    {29, 2, 25, 20, 14, true}, {16, 1, 14, 16, 7, true}, {42, 2, 38, 36, 36, true}, {25, -1, 27, 43, 5, true},
+    {21, 2, 18, 36, 17, true}, {29, 2, 25, 32, 32, true}, {19, 1, 17, 36, 22, true}, {19, 1, 16, 36, 22, true},
+    {30, 8, 15, 38, 8, true}, {33, 3, 27, 27, 39, true}, {33, 2, 27, 38, 44, true}, {14, 2, 10, 22, 9, true},
+    {10, -1, 12, 0, 12, true}, {19, 2, 13, 36, 22, true}, {19, 1, 17, 36, 18, true}, {31, 2, 27, 25, 23, true},
+    {44, 1, 41, 36, 36, true}, {44, 1, 41, 36, 36, true}, {44, 2, 40, 36, 36, true}, {24, 1, 23, 27, 37, true},
+    {35, 0, 35, 46, 46, true}, {35, 0, 35, 46, 46, true}, {35, 0, 35, 46, 46, true}, {35, 0, 35, 46, 46, true},
+    {35, 0, 35, 46, 46, true}, {35, 0, 35, 45, 45, true}, {48, 0, 45, 36, 36, true}, {32, 2, 29, 36, 48, true},
+    {28, 4, 22, 46, 46, true}, {28, 4, 22, 46, 46, true}, {28, 4, 22, 46, 46, true}, {28, 4, 22, 46, 46, true},
+    {17, -2, 15, 46, 46, true}, {17, 4, 15, 46, 46, true}, {17, -3, 22, 46, 46, true}, {17, -1, 18, 46, 46, true},
+    {37, 1, 34, 36, 36, true}, {41, 4, 33, 46, 46, true}, {40, 2, 35, 46, 46, true}, {40, 2, 35, 46, 46, true},
+    {40, 2, 35, 46, 46, true}, {40, 2, 35, 46, 46, true}, {40, 2, 35, 46, 46, true}, {29, 3, 23, 29, 23, true},
+    {40, 2, 35, 38, 40, true}, {38, 4, 30, 46, 46, true}, {38, 4, 30, 46, 46, true}, {38, 4, 30, 46, 46, true},
+    {38, 4, 30, 46, 46, true}, {31, 0, 32, 46, 46, true}, {31, 4, 26, 36, 36, true}, {36, 3, 31, 38, 38, true},
+    {30, 2, 25, 38, 38, true}, {30, 2, 25, 38, 38, true}, {30, 2, 25, 38, 38, true}, {30, 2, 25, 38, 38, true},
+    {30, 2, 25, 38, 38, true}, {30, 2, 25, 42, 42, true}, {46, 2, 42, 28, 28, true}, {26, 2, 23, 28, 40, true},
+    {30, 2, 26, 38, 38, true}, {30, 2, 26, 38, 38, true}, {30, 2, 26, 38, 38, true}, {30, 2, 26, 38, 38, true},
+    {15, -3, 15, 38, 38, true}, {15, 3, 15, 38, 38, true}, {15, -3, 22, 38, 38, true}, {15, -1, 18, 38, 38, true},
+    {31, 2, 27, 38, 38, true}, {33, 3, 27, 38, 38, true}, {31, 2, 27, 38, 38, true}, {31, 2, 27, 38, 38, true},
+    {31, 2, 27, 38, 38, true}, {31, 2, 27, 38, 38, true}, {31, 2, 27, 38, 38, true}, {29, 2, 25, 30, 26, true},
+    {31, 2, 27, 29, 31, true}, {33, 3, 26, 38, 38, true}, {33, 3, 26, 38, 38, true}, {33, 3, 26, 38, 38, true},
+    {33, 3, 26, 38, 38, true}, {28, 0, 29, 38, 50, true}, {32, 3, 27, 38, 50, true}, {28, 0, 29, 38, 50, true},
+};
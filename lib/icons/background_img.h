@@ -0,0 +1,1659 @@
+#pragma once
+
+// Generated by tools/compose_background.py, do not edit.
+// Inputs sha256: 272b33d2d8ca42cd040f14c5f52fa6cfc7ed8c868f709d801f02544d92266c7c
+// Static layer of the display, 26392 bytes run length coded from 259200.
+const uint32_t background_img_width = 960;
+const uint32_t background_img_height = 540;
+const uint8_t background_img_data[26392] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83,
+    0x00, 0x02, 0x10, 0x95, 0xFE, 0x93, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10,
+    0x95, 0xFE, 0x93, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10, 0x95, 0xFE, 0x92,
+    0xFF, 0x00, 0x4C, 0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFB, 0x91, 0xFF, 0x00, 0x4C, 0xFF, 0x00,
+    0x87, 0x00, 0x01, 0x40, 0xFB, 0x91, 0xFF, 0x00, 0x4C, 0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFB,
+    0x90, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x01, 0x30, 0x65, 0xFF, 0x77, 0x02, 0x77, 0x67, 0x35, 0x81,
+    0x00, 0x01, 0x40, 0xFD, 0x8F, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x01, 0x30, 0x65, 0xFF, 0x77, 0x02,
+    0x77, 0x67, 0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x8F, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x01, 0x30,
+    0x65, 0xFF, 0x77, 0x02, 0x77, 0x67, 0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x8E, 0xFF, 0x00, 0x9F,
+    0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90,
+    0x8E, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xDF, 0x38,
+    0x80, 0x00, 0x00, 0x90, 0x8E, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83,
+    0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90, 0x8E, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF,
+    0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00, 0x00, 0xF6, 0x8D, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD,
+    0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00, 0x00, 0xF6, 0x8D, 0xFF, 0x03, 0x06, 0x00, 0x60,
+    0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00, 0x00, 0xF6, 0x8C, 0xFF, 0x03, 0x6F, 0x00,
+    0x30, 0xFD, 0x88, 0xFF, 0x03, 0x9F, 0x14, 0x21, 0xC5, 0xFB, 0xFF, 0x02, 0x3D, 0x00, 0x60, 0x8C,
+    0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0x88, 0xFF, 0x03, 0x9F, 0x14, 0x21, 0xC5, 0xFB, 0xFF, 0x02,
+    0x3D, 0x00, 0x60, 0x8C, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0x88, 0xFF, 0x03, 0x9F, 0x14, 0x21,
+    0xC5, 0xFB, 0xFF, 0x02, 0x3D, 0x00, 0x60, 0x8C, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0x88, 0xFF, 0x01,
+    0xBF, 0x01, 0x81, 0x00, 0x00, 0xF5, 0xFB, 0xFF, 0x02, 0x05, 0x00, 0xF9, 0x8B, 0xFF, 0x02, 0x09,
+    0x00, 0xF5, 0x88, 0xFF, 0x01, 0xBF, 0x01, 0x81, 0x00, 0x00, 0xF5, 0xFB, 0xFF, 0x02, 0x05, 0x00,
+    0xF9, 0x8B, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0x88, 0xFF, 0x01, 0xBF, 0x01, 0x81, 0x00, 0x00, 0xF5,
+    0xFB, 0xFF, 0x02, 0x05, 0x00, 0xF9, 0x8A, 0xFF, 0x02, 0xDF, 0x00, 0x50, 0x89, 0xFF, 0x00, 0x0A,
+    0x82, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x8A, 0xFF, 0x02, 0xDF, 0x00, 0x50,
+    0x89, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x8A, 0xFF,
+    0x02, 0xDF, 0x00, 0x50, 0x89, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0x02, 0x5F,
+    0x00, 0xD0, 0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0x88, 0xFF, 0x00, 0xDF, 0x81, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0xF6, 0xFB, 0xFF, 0x01, 0x03, 0x40, 0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0x88,
+    0xFF, 0x00, 0xDF, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF6, 0xFB, 0xFF, 0x01, 0x03, 0x40,
+    0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0x88, 0xFF, 0x00, 0xDF, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x00, 0xF6, 0xFB, 0xFF, 0x01, 0x03, 0x40, 0x8A, 0xFF, 0x02, 0x0B, 0x00, 0xFD, 0x88, 0xFF, 0x00,
+    0x6F, 0x80, 0x00, 0x04, 0xF9, 0xDF, 0x04, 0x00, 0xD0, 0xFB, 0xFF, 0x02, 0x0D, 0x00, 0xFC, 0x89,
+    0xFF, 0x02, 0x0B, 0x00, 0xFD, 0x88, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x04, 0xF9, 0xDF, 0x04, 0x00,
+    0xD0, 0xFB, 0xFF, 0x02, 0x0D, 0x00, 0xFC, 0x89, 0xFF, 0x02, 0x0B, 0x00, 0xFD, 0x88, 0xFF, 0x00,
+    0x6F, 0x80, 0x00, 0x04, 0xF9, 0xDF, 0x04, 0x00, 0xD0, 0xFB, 0xFF, 0x02, 0x0D, 0x00, 0xFC, 0x89,
+    0xFF, 0x01, 0x04, 0x60, 0x89, 0xFF, 0x02, 0x0F, 0x00, 0xB0, 0x80, 0xFF, 0x02, 0x4F, 0x00, 0x70,
+    0x80, 0xFF, 0x00, 0xAD, 0x81, 0xAA, 0x00, 0xCA, 0xF4, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x89, 0xFF,
+    0x01, 0x04, 0x60, 0x89, 0xFF, 0x02, 0x0F, 0x00, 0xB0, 0x80, 0xFF, 0x02, 0x4F, 0x00, 0x70, 0x80,
+    0xFF, 0x00, 0xAD, 0x81, 0xAA, 0x00, 0xCA, 0xF4, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x89, 0xFF, 0x01,
+    0x04, 0x60, 0x89, 0xFF, 0x02, 0x0F, 0x00, 0xB0, 0x80, 0xFF, 0x02, 0x4F, 0x00, 0x70, 0x80, 0xFF,
+    0x00, 0xAD, 0x81, 0xAA, 0x00, 0xCA, 0xF4, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x88, 0xFF, 0x02, 0xEF,
+    0x00, 0xD0, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF3, 0x80, 0xFF, 0x04, 0xCF, 0x00, 0x40, 0xFF, 0xBF,
+    0x83, 0x00, 0x00, 0xF9, 0xF3, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x88, 0xFF, 0x02, 0xEF, 0x00, 0xD0,
+    0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF3, 0x80, 0xFF, 0x04, 0xCF, 0x00, 0x40, 0xFF, 0xBF, 0x83, 0x00,
+    0x00, 0xF9, 0xF3, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x88, 0xFF, 0x02, 0xEF, 0x00, 0xD0, 0x89, 0xFF,
+    0x02, 0x0C, 0x00, 0xF3, 0x80, 0xFF, 0x04, 0xCF, 0x00, 0x40, 0xFF, 0xBF, 0x83, 0x00, 0x00, 0xF9,
+    0xF3, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0x89, 0xFF, 0x02, 0x0C,
+    0x00, 0xF5, 0x80, 0xFF, 0x04, 0xEF, 0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xF4, 0xFF,
+    0x01, 0x03, 0x90, 0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF5, 0x80,
+    0xFF, 0x04, 0xEF, 0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xF4, 0xFF, 0x01, 0x03, 0x90,
+    0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF5, 0x80, 0xFF, 0x04, 0xEF,
+    0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xF4, 0xFF, 0x01, 0x03, 0x90, 0x88, 0xFF, 0x02,
+    0x5F, 0x00, 0xF8, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF,
+    0x83, 0x00, 0x00, 0xF7, 0xF4, 0xFF, 0x01, 0x08, 0x50, 0x88, 0xFF, 0x02, 0x5F, 0x00, 0xF8, 0x89,
+    0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF, 0x83, 0x00, 0x00, 0xF7,
+    0xF4, 0xFF, 0x01, 0x08, 0x50, 0x88, 0xFF, 0x02, 0x5F, 0x00, 0xF8, 0x89, 0xFF, 0x02, 0x0C, 0x00,
+    0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF, 0x83, 0x00, 0x00, 0xF7, 0xF4, 0xFF, 0x01, 0x08,
+    0x50, 0x88, 0xFF, 0x02, 0x1F, 0x00, 0xFD, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01,
+    0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x81, 0x77, 0x00, 0x97, 0xF5, 0xFF, 0x01, 0x0D, 0x10, 0x88,
+    0xFF, 0x02, 0x1F, 0x00, 0xFD, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30,
+    0x80, 0xFF, 0x00, 0x8A, 0x81, 0x77, 0x00, 0x97, 0xF5, 0xFF, 0x01, 0x0D, 0x10, 0x88, 0xFF, 0x02,
+    0x1F, 0x00, 0xFD, 0x89, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF,
+    0x00, 0x8A, 0x81, 0x77, 0x00, 0x97, 0xF5, 0xFF, 0x01, 0x0D, 0x10, 0x88, 0xFF, 0x01, 0x0E, 0x00,
+    0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x0F, 0x00,
+    0x88, 0xFF, 0x01, 0x0E, 0x00, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30,
+    0xFC, 0xFF, 0x01, 0x0F, 0x00, 0x88, 0xFF, 0x01, 0x0E, 0x00, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6,
+    0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x0F, 0x00, 0x88, 0xFF, 0x01, 0x0C, 0x30, 0x8A,
+    0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x3F, 0x00, 0x88,
+    0xFF, 0x01, 0x0C, 0x30, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC,
+    0xFF, 0x01, 0x3F, 0x00, 0x88, 0xFF, 0x01, 0x0C, 0x30, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81,
+    0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x3F, 0x00, 0x88, 0xFF, 0x01, 0x0A, 0x50, 0x8A, 0xFF,
+    0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x5F, 0x00, 0x88, 0xFF,
+    0x01, 0x0A, 0x50, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF,
+    0x01, 0x5F, 0x00, 0x88, 0xFF, 0x01, 0x0A, 0x50, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF,
+    0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x5F, 0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0x8A, 0xFF, 0x02,
+    0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF, 0x25, 0x81, 0x22, 0x01, 0x42, 0xFD,
+    0xF4, 0xFF, 0x01, 0x6F, 0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6,
+    0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF, 0x25, 0x81, 0x22, 0x01, 0x42, 0xFD, 0xF4, 0xFF, 0x01,
+    0x6F, 0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04,
+    0x00, 0x30, 0xFF, 0xEF, 0x25, 0x81, 0x22, 0x01, 0x42, 0xFD, 0xF4, 0xFF, 0x01, 0x6F, 0x00, 0x88,
+    0xFF, 0x01, 0x08, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF,
+    0x8F, 0x83, 0x00, 0x00, 0xF5, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0x8A,
+    0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x83, 0x00, 0x00, 0xF5,
+    0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6,
+    0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x83, 0x00, 0x00, 0xF5, 0xF4, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x08, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0x7F, 0x83, 0x00, 0x00, 0xF4, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70,
+    0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x7F, 0x83, 0x00, 0x00,
+    0xF4, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00,
+    0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x7F, 0x83, 0x00, 0x00, 0xF4, 0xF4, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00,
+    0x30, 0xFF, 0xEF, 0x03, 0x81, 0x00, 0x01, 0x10, 0xFC, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF,
+    0x03, 0x81, 0x00, 0x01, 0x10, 0xFC, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF, 0x03, 0x81, 0x00,
+    0x01, 0x10, 0xFC, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02,
+    0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01,
+    0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C,
+    0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00,
+    0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00,
+    0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xD5, 0xFF, 0x02, 0x4A, 0x01, 0x93, 0x84, 0xFF, 0x04, 0x7C,
+    0x13, 0x00, 0x31, 0xB7, 0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF,
+    0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xD5, 0xFF, 0x02, 0x4A, 0x01, 0x93, 0x84,
+    0xFF, 0x04, 0x7C, 0x13, 0x00, 0x31, 0xB7, 0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0xD5, 0xFF, 0x02, 0x4A,
+    0x01, 0x93, 0x84, 0xFF, 0x04, 0x7C, 0x13, 0x00, 0x31, 0xB7, 0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0xCF, 0xEA, 0xFF, 0x00, 0x30, 0x80,
+    0xFF, 0x00, 0xAC, 0x81, 0xAA, 0x00, 0xBA, 0xCD, 0xFF, 0x00, 0x5F, 0x81, 0x00, 0x00, 0xF3, 0x82,
+    0xFF, 0x00, 0x4D, 0x83, 0x00, 0x00, 0x91, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0xCF, 0xEA, 0xFF, 0x00, 0x30, 0x80, 0xFF, 0x00, 0xAC,
+    0x81, 0xAA, 0x00, 0xBA, 0xCD, 0xFF, 0x00, 0x5F, 0x81, 0x00, 0x00, 0xF3, 0x82, 0xFF, 0x00, 0x4D,
+    0x83, 0x00, 0x00, 0x91, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF,
+    0x07, 0x0C, 0x00, 0xF6, 0xCF, 0xEA, 0xFF, 0x00, 0x30, 0x80, 0xFF, 0x00, 0xAC, 0x81, 0xAA, 0x00,
+    0xBA, 0xCD, 0xFF, 0x00, 0x5F, 0x81, 0x00, 0x00, 0xF3, 0x82, 0xFF, 0x00, 0x4D, 0x83, 0x00, 0x00,
+    0x91, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00,
+    0xF6, 0x0A, 0x20, 0xFF, 0x00, 0x30, 0xFF, 0xBF, 0x83, 0x00, 0x00, 0xF9, 0xCC, 0xFF, 0x00, 0x07,
+    0x81, 0x00, 0x00, 0x50, 0x81, 0xFF, 0x00, 0xAF, 0x84, 0x00, 0x00, 0x70, 0x96, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x0A, 0x20, 0xFF, 0x00,
+    0x30, 0xFF, 0xBF, 0x83, 0x00, 0x00, 0xF9, 0xCC, 0xFF, 0x00, 0x07, 0x81, 0x00, 0x00, 0x50, 0x81,
+    0xFF, 0x00, 0xAF, 0x84, 0x00, 0x00, 0x70, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x0A, 0x20, 0xFF, 0x00, 0x30, 0xFF, 0xBF, 0x83, 0x00,
+    0x00, 0xF9, 0xCC, 0xFF, 0x00, 0x07, 0x81, 0x00, 0x00, 0x50, 0x81, 0xFF, 0x00, 0xAF, 0x84, 0x00,
+    0x00, 0x70, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C,
+    0x00, 0xF6, 0x06, 0x00, 0xFC, 0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xCB, 0xFF, 0x06,
+    0xEF, 0x00, 0x50, 0xDD, 0x06, 0x00, 0xFC, 0x80, 0xFF, 0x00, 0x0A, 0x84, 0x00, 0x00, 0xD0, 0x96,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x06,
+    0x00, 0xFC, 0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xCB, 0xFF, 0x06, 0xEF, 0x00, 0x50,
+    0xDD, 0x06, 0x00, 0xFC, 0x80, 0xFF, 0x00, 0x0A, 0x84, 0x00, 0x00, 0xD0, 0x96, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFC, 0x00,
+    0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0xCB, 0xFF, 0x06, 0xEF, 0x00, 0x50, 0xDD, 0x06, 0x00,
+    0xFC, 0x80, 0xFF, 0x00, 0x0A, 0x84, 0x00, 0x00, 0xD0, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xFF, 0xAF,
+    0x83, 0x00, 0x00, 0xF8, 0xCB, 0xFF, 0x08, 0x9F, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xEF,
+    0x81, 0x00, 0x04, 0xA4, 0xCC, 0x6A, 0x00, 0xF4, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xFF, 0xAF, 0x83,
+    0x00, 0x00, 0xF8, 0xCB, 0xFF, 0x08, 0x9F, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xEF, 0x81,
+    0x00, 0x04, 0xA4, 0xCC, 0x6A, 0x00, 0xF4, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xFF, 0xAF, 0x83, 0x00,
+    0x00, 0xF8, 0xCB, 0xFF, 0x08, 0x9F, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xEF, 0x81, 0x00,
+    0x04, 0xA4, 0xCC, 0x6A, 0x00, 0xF4, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x8B, 0x81,
+    0x77, 0x00, 0xA7, 0xCC, 0xFF, 0x08, 0x8F, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0xF6, 0xFF, 0x5F, 0x80,
+    0x00, 0x00, 0xA0, 0x81, 0xFF, 0x01, 0x9F, 0xFB, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00,
+    0x8B, 0x81, 0x77, 0x00, 0xA7, 0xCC, 0xFF, 0x08, 0x8F, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0xF6, 0xFF,
+    0x5F, 0x80, 0x00, 0x00, 0xA0, 0x81, 0xFF, 0x01, 0x9F, 0xFB, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80,
+    0xFF, 0x00, 0x8B, 0x81, 0x77, 0x00, 0xA7, 0xCC, 0xFF, 0x08, 0x8F, 0x00, 0xF6, 0xFF, 0x8F, 0x00,
+    0xF6, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0xA0, 0x81, 0xFF, 0x01, 0x9F, 0xFB, 0x96, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00,
+    0x30, 0xD3, 0xFF, 0x08, 0x9F, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0x0E, 0x80, 0x00, 0x00,
+    0xF8, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00,
+    0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD3, 0xFF, 0x08, 0x9F, 0x00, 0xF2, 0xFF, 0x4F, 0x00, 0xF7,
+    0xFF, 0x0E, 0x80, 0x00, 0x00, 0xF8, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD3, 0xFF, 0x08, 0x9F, 0x00,
+    0xF2, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0x0E, 0x80, 0x00, 0x00, 0xF8, 0x9B, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30,
+    0xD3, 0xFF, 0x0A, 0xDF, 0x00, 0x50, 0xDD, 0x07, 0x00, 0xFC, 0xFF, 0x08, 0x00, 0x10, 0x9C, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00,
+    0xFB, 0x00, 0x30, 0xD3, 0xFF, 0x0A, 0xDF, 0x00, 0x50, 0xDD, 0x07, 0x00, 0xFC, 0xFF, 0x08, 0x00,
+    0x10, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00,
+    0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD3, 0xFF, 0x0A, 0xDF, 0x00, 0x50, 0xDD, 0x07, 0x00, 0xFC,
+    0xFF, 0x08, 0x00, 0x10, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF,
+    0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD4, 0xFF, 0x00, 0x05, 0x81, 0x00, 0x00,
+    0x40, 0x80, 0xFF, 0x02, 0x04, 0x00, 0x70, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD4, 0xFF, 0x00, 0x05,
+    0x81, 0x00, 0x00, 0x40, 0x80, 0xFF, 0x02, 0x04, 0x00, 0x70, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xD4,
+    0xFF, 0x00, 0x05, 0x81, 0x00, 0x00, 0x40, 0x80, 0xFF, 0x02, 0x04, 0x00, 0x70, 0x9C, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB,
+    0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF, 0x23, 0x80, 0x22, 0x01, 0x32, 0xFD, 0xCC, 0xFF, 0x00, 0x4F,
+    0x81, 0x00, 0x00, 0xE3, 0x80, 0xFF, 0x02, 0x01, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80,
+    0xFF, 0x01, 0xDF, 0x23, 0x80, 0x22, 0x01, 0x32, 0xFD, 0xCC, 0xFF, 0x00, 0x4F, 0x81, 0x00, 0x00,
+    0xE3, 0x80, 0xFF, 0x02, 0x01, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF,
+    0x23, 0x80, 0x22, 0x01, 0x32, 0xFD, 0xCC, 0xFF, 0x00, 0x4F, 0x81, 0x00, 0x00, 0xE3, 0x80, 0xFF,
+    0x02, 0x01, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF,
+    0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00,
+    0xF5, 0xCD, 0xFF, 0x02, 0x39, 0x00, 0x93, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xD0, 0x9C, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB,
+    0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0xF5, 0xCD, 0xFF, 0x02, 0x39, 0x00, 0x93,
+    0x81, 0xFF, 0x80, 0x00, 0x00, 0xD0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82,
+    0x00, 0x00, 0xF5, 0xCD, 0xFF, 0x02, 0x39, 0x00, 0x93, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xD0, 0x9C,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06,
+    0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0xF5, 0xD3, 0xFF, 0x80, 0x00,
+    0x00, 0xE0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C,
+    0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0xF5, 0xD3,
+    0xFF, 0x80, 0x00, 0x00, 0xE0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A,
+    0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00,
+    0x00, 0xF5, 0xD3, 0xFF, 0x80, 0x00, 0x00, 0xE0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x01,
+    0xDF, 0x13, 0x80, 0x11, 0x01, 0x31, 0xFD, 0xD3, 0xFF, 0x80, 0x00, 0x00, 0xE0, 0x9C, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB,
+    0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF, 0x13, 0x80, 0x11, 0x01, 0x31, 0xFD, 0xD3, 0xFF, 0x80, 0x00,
+    0x00, 0xE0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x07, 0x0C,
+    0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF, 0x13, 0x80, 0x11, 0x01, 0x31,
+    0xFD, 0xD3, 0xFF, 0x80, 0x00, 0x00, 0xE0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x89, 0xFF, 0x06, 0xBF, 0x02, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x00, 0xF6, 0xDA,
+    0xFF, 0x80, 0x00, 0x00, 0xD0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89,
+    0xFF, 0x06, 0xBF, 0x02, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x00, 0xF6, 0xDA, 0xFF, 0x80,
+    0x00, 0x00, 0xD0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x06,
+    0xBF, 0x02, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x00, 0xF6, 0xDA, 0xFF, 0x80, 0x00, 0x00,
+    0xD0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x08, 0x80,
+    0x00, 0x03, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x01, 0x20, 0xFD, 0xD9, 0xFF, 0x02, 0x01, 0x00,
+    0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x08, 0x80,
+    0x00, 0x03, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x01, 0x20, 0xFD, 0xD9, 0xFF, 0x02, 0x01, 0x00,
+    0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x08, 0x80,
+    0x00, 0x03, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x01, 0x20, 0xFD, 0xD9, 0xFF, 0x02, 0x01, 0x00,
+    0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x7F, 0x80,
+    0x00, 0x05, 0x10, 0xFA, 0x06, 0x00, 0xFB, 0x05, 0x80, 0x00, 0x00, 0xD1, 0xD9, 0xFF, 0x02, 0x03,
+    0x00, 0x80, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x7F,
+    0x80, 0x00, 0x05, 0x10, 0xFA, 0x06, 0x00, 0xFB, 0x05, 0x80, 0x00, 0x00, 0xD1, 0xD9, 0xFF, 0x02,
+    0x03, 0x00, 0x80, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00,
+    0x7F, 0x80, 0x00, 0x05, 0x10, 0xFA, 0x06, 0x00, 0xFB, 0x05, 0x80, 0x00, 0x00, 0xD1, 0xD9, 0xFF,
+    0x02, 0x03, 0x00, 0x80, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x00, 0x09, 0x80, 0x00, 0x09, 0xF8, 0xEF, 0x04, 0x00, 0xF9, 0xDF, 0x04, 0x00, 0x20, 0xFE, 0xD8,
+    0xFF, 0x02, 0x07, 0x00, 0x30, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88,
+    0xFF, 0x00, 0x09, 0x80, 0x00, 0x09, 0xF8, 0xEF, 0x04, 0x00, 0xF9, 0xDF, 0x04, 0x00, 0x20, 0xFE,
+    0xD8, 0xFF, 0x02, 0x07, 0x00, 0x30, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x88, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x09, 0xF8, 0xEF, 0x04, 0x00, 0xF9, 0xDF, 0x04, 0x00, 0x20,
+    0xFE, 0xD8, 0xFF, 0x02, 0x07, 0x00, 0x30, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x87, 0xFF, 0x00, 0xCF, 0x80, 0x00, 0x02, 0xD2, 0xCF, 0x04, 0x80, 0x00, 0x02, 0x10, 0xF8,
+    0x7F, 0x80, 0x00, 0x00, 0xF5, 0xD8, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xFB, 0x9B, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0xCF, 0x80, 0x00, 0x02, 0xD2, 0xCF,
+    0x04, 0x80, 0x00, 0x02, 0x10, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xF5, 0xD8, 0xFF, 0x00, 0x0B, 0x80,
+    0x00, 0x00, 0xFB, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00,
+    0xCF, 0x80, 0x00, 0x02, 0xD2, 0xCF, 0x04, 0x80, 0x00, 0x02, 0x10, 0xF8, 0x7F, 0x80, 0x00, 0x00,
+    0xF5, 0xD8, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xFB, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x87, 0xFF, 0x04, 0x3F, 0x00, 0x10, 0xFD, 0x08, 0x82, 0x00, 0x04, 0x20, 0xFD,
+    0x08, 0x00, 0xB0, 0xD8, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xC1, 0x82, 0xFF, 0x00, 0xFC, 0x96,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x04, 0x3F, 0x00, 0x10, 0xFD,
+    0x08, 0x82, 0x00, 0x04, 0x20, 0xFD, 0x08, 0x00, 0xB0, 0xD8, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00,
+    0xC1, 0x82, 0xFF, 0x00, 0xFC, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87,
+    0xFF, 0x04, 0x3F, 0x00, 0x10, 0xFD, 0x08, 0x82, 0x00, 0x04, 0x20, 0xFD, 0x08, 0x00, 0xB0, 0xD8,
+    0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xC1, 0x82, 0xFF, 0x00, 0xFC, 0x96, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x0A, 0x00, 0xC0, 0x6F, 0x84, 0x00, 0x03, 0xC0,
+    0x5F, 0x00, 0x20, 0xD8, 0xFF, 0x00, 0xAF, 0x81, 0x00, 0x04, 0xA5, 0xDC, 0x9B, 0x15, 0xF0, 0x96,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x0A, 0x00, 0xC0, 0x6F,
+    0x84, 0x00, 0x03, 0xC0, 0x5F, 0x00, 0x20, 0xD8, 0xFF, 0x00, 0xAF, 0x81, 0x00, 0x04, 0xA5, 0xDC,
+    0x9B, 0x15, 0xF0, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03,
+    0x0A, 0x00, 0xC0, 0x6F, 0x84, 0x00, 0x03, 0xC0, 0x5F, 0x00, 0x20, 0xD8, 0xFF, 0x00, 0xAF, 0x81,
+    0x00, 0x04, 0xA5, 0xDC, 0x9B, 0x15, 0xF0, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x87, 0xFF, 0x03, 0x04, 0x00, 0xF7, 0x09, 0x84, 0x00, 0x01, 0x10, 0xEE, 0x80, 0x00, 0x00,
+    0xFB, 0xD8, 0xFF, 0x00, 0x05, 0x84, 0x00, 0x00, 0xF0, 0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x04, 0x00, 0xF7, 0x09, 0x84, 0x00, 0x01, 0x10, 0xEE, 0x80,
+    0x00, 0x00, 0xFB, 0xD8, 0xFF, 0x00, 0x05, 0x84, 0x00, 0x00, 0xF0, 0x96, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x04, 0x00, 0xF7, 0x09, 0x84, 0x00, 0x01, 0x10,
+    0xEE, 0x80, 0x00, 0x00, 0xFB, 0xD8, 0xFF, 0x00, 0x05, 0x84, 0x00, 0x00, 0xF0, 0x96, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xEE, 0x86,
+    0x00, 0x03, 0xF6, 0x07, 0x00, 0xF6, 0xD8, 0xFF, 0x00, 0x5F, 0x84, 0x00, 0x00, 0xF0, 0x96, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xEE,
+    0x86, 0x00, 0x03, 0xF6, 0x07, 0x00, 0xF6, 0xD8, 0xFF, 0x00, 0x5F, 0x84, 0x00, 0x00, 0xF0, 0x96,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00,
+    0xEE, 0x86, 0x00, 0x03, 0xF6, 0x07, 0x00, 0xF6, 0xD8, 0xFF, 0x00, 0x5F, 0x84, 0x00, 0x00, 0xF0,
+    0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40,
+    0x7F, 0x86, 0x00, 0x03, 0xE0, 0x0D, 0x00, 0xF1, 0xD9, 0xFF, 0x00, 0x18, 0x83, 0x00, 0x00, 0xF1,
+    0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40,
+    0x7F, 0x86, 0x00, 0x03, 0xE0, 0x0D, 0x00, 0xF1, 0xD9, 0xFF, 0x00, 0x18, 0x83, 0x00, 0x00, 0xF1,
+    0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40,
+    0x7F, 0x86, 0x00, 0x03, 0xE0, 0x0D, 0x00, 0xF1, 0xD9, 0xFF, 0x00, 0x18, 0x83, 0x00, 0x00, 0xF1,
+    0x96, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x6F, 0x00, 0x90,
+    0x2F, 0x86, 0x00, 0x03, 0xA0, 0x2F, 0x00, 0xE0, 0xDA, 0xFF, 0x04, 0x59, 0x12, 0x00, 0x31, 0xB7,
+    0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x6F, 0x00, 0x90,
+    0x2F, 0x86, 0x00, 0x03, 0xA0, 0x2F, 0x00, 0xE0, 0xDA, 0xFF, 0x04, 0x59, 0x12, 0x00, 0x31, 0xB7,
+    0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x6F, 0x00, 0x90,
+    0x2F, 0x86, 0x00, 0x03, 0xA0, 0x2F, 0x00, 0xE0, 0xDA, 0xFF, 0x04, 0x59, 0x12, 0x00, 0x31, 0xB7,
+    0x97, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0,
+    0x0F, 0x86, 0x00, 0x03, 0x60, 0x5F, 0x00, 0xC0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0, 0x0F, 0x86, 0x00, 0x03, 0x60, 0x5F, 0x00, 0xC0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0,
+    0x0F, 0x86, 0x00, 0x03, 0x60, 0x5F, 0x00, 0xC0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0, 0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0,
+    0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0, 0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0,
+    0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0, 0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x4F, 0x00, 0xD0,
+    0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0, 0x0F, 0x86, 0x00, 0x03, 0x60, 0x4F, 0x00, 0xC0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0,
+    0x0F, 0x86, 0x00, 0x03, 0x60, 0x4F, 0x00, 0xC0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x5F, 0x00, 0xC0, 0x0F, 0x86, 0x00, 0x03, 0x60, 0x4F, 0x00, 0xC0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x7F, 0x00, 0x90,
+    0x3F, 0x86, 0x00, 0x03, 0xA0, 0x1F, 0x00, 0xE0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0x7F, 0x00, 0x90, 0x3F, 0x86, 0x00, 0x03, 0xA0, 0x1F, 0x00, 0xE0,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0x7F, 0x00, 0x90,
+    0x3F, 0x86, 0x00, 0x03, 0xA0, 0x1F, 0x00, 0xE0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40, 0x8F, 0x86, 0x00, 0x03, 0xF1, 0x0D, 0x00, 0xF2,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40,
+    0x8F, 0x86, 0x00, 0x03, 0xF1, 0x0D, 0x00, 0xF2, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x40, 0x8F, 0x86, 0x00, 0x03, 0xF1, 0x0D, 0x00, 0xF2,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x01, 0xEE, 0x01, 0x85, 0x00, 0x03, 0xF7, 0x06, 0x00, 0xF6, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x01, 0xEE, 0x01, 0x85, 0x00, 0x03,
+    0xF7, 0x06, 0x00, 0xF6, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x01, 0xEE, 0x01, 0x85, 0x00, 0x03, 0xF7, 0x06, 0x00, 0xF6, 0xF8, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x04, 0x00, 0xF5, 0x0A, 0x84,
+    0x00, 0x01, 0x20, 0xDF, 0x80, 0x00, 0x00, 0xFC, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x87, 0xFF, 0x03, 0x04, 0x00, 0xF5, 0x0A, 0x84, 0x00, 0x01, 0x20, 0xDF, 0x80, 0x00,
+    0x00, 0xFC, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x04,
+    0x00, 0xF5, 0x0A, 0x84, 0x00, 0x01, 0x20, 0xDF, 0x80, 0x00, 0x00, 0xFC, 0xF8, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x0B, 0x00, 0xB0, 0x7F, 0x84, 0x00, 0x03,
+    0xD1, 0x4F, 0x00, 0x30, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF,
+    0x03, 0x0B, 0x00, 0xB0, 0x7F, 0x84, 0x00, 0x03, 0xD1, 0x4F, 0x00, 0x30, 0xF9, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x03, 0x0B, 0x00, 0xB0, 0x7F, 0x84, 0x00, 0x03,
+    0xD1, 0x4F, 0x00, 0x30, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF,
+    0x04, 0x4F, 0x00, 0x10, 0xFC, 0x09, 0x82, 0x00, 0x04, 0x30, 0xFE, 0x06, 0x00, 0xB0, 0xF9, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x04, 0x4F, 0x00, 0x10, 0xFC, 0x09,
+    0x82, 0x00, 0x04, 0x30, 0xFE, 0x06, 0x00, 0xB0, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x87, 0xFF, 0x04, 0x4F, 0x00, 0x10, 0xFC, 0x09, 0x82, 0x00, 0x04, 0x30, 0xFE, 0x06,
+    0x00, 0xB0, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0xDF,
+    0x80, 0x00, 0x02, 0xB1, 0xEF, 0x16, 0x80, 0x00, 0x02, 0x30, 0xFA, 0x6F, 0x80, 0x00, 0x00, 0xF5,
+    0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0xDF, 0x80, 0x00,
+    0x02, 0xB1, 0xEF, 0x16, 0x80, 0x00, 0x02, 0x30, 0xFA, 0x6F, 0x80, 0x00, 0x00, 0xF5, 0xF9, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x02, 0xB1,
+    0xEF, 0x16, 0x80, 0x00, 0x02, 0x30, 0xFA, 0x6F, 0x80, 0x00, 0x00, 0xF5, 0xF9, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x0A, 0x80, 0x00, 0x08, 0xE7, 0xFF, 0xAC,
+    0xB9, 0xFE, 0xBF, 0x02, 0x00, 0x20, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x88, 0xFF, 0x00, 0x0A, 0x80, 0x00, 0x08, 0xE7, 0xFF, 0xAC, 0xB9, 0xFE, 0xBF, 0x02, 0x00, 0x20,
+    0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x0A, 0x80, 0x00,
+    0x08, 0xE7, 0xFF, 0xAC, 0xB9, 0xFE, 0xBF, 0x02, 0x00, 0x20, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x9F, 0x81, 0x00, 0x04, 0xB6, 0xFE, 0xFF, 0x9D, 0x03,
+    0x80, 0x00, 0x00, 0xE2, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x00, 0x9F, 0x81, 0x00, 0x04, 0xB6, 0xFE, 0xFF, 0x9D, 0x03, 0x80, 0x00, 0x00, 0xE2, 0xFA, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x9F, 0x81, 0x00, 0x04, 0xB6,
+    0xFE, 0xFF, 0x9D, 0x03, 0x80, 0x00, 0x00, 0xE2, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x89, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x30, 0xFE, 0xFA,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x01, 0x30, 0xFE, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x89, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x30, 0xFE, 0xFA, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x01, 0xCF, 0x03, 0x85, 0x00, 0x00, 0xF7,
+    0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x01, 0xCF, 0x03, 0x85,
+    0x00, 0x00, 0xF7, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x01,
+    0xCF, 0x03, 0x85, 0x00, 0x00, 0xF7, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8A, 0xFF, 0x01, 0x9F, 0x02, 0x83, 0x00, 0x00, 0xD5, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x8A, 0xFF, 0x01, 0x9F, 0x02, 0x83, 0x00, 0x00, 0xD5, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x01, 0x9F, 0x02, 0x83, 0x00, 0x00, 0xD5, 0xFC,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x05, 0xDF, 0x48, 0x12, 0x11,
+    0x63, 0xFA, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x05, 0xDF,
+    0x48, 0x12, 0x11, 0x63, 0xFA, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B,
+    0xFF, 0x05, 0xDF, 0x48, 0x12, 0x11, 0x63, 0xFA, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x3D, 0xD3, 0xFD,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x3D, 0xD3, 0xFD, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x3D, 0xD3, 0xFD, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x03, 0x20, 0xFD, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x03, 0x20, 0xFD, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x03, 0x20, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x0D, 0x80, 0x00,
+    0x00, 0xD0, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x0D,
+    0x80, 0x00, 0x00, 0xD0, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0x0D, 0x80, 0x00, 0x00, 0xD0, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0x03, 0x80, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0x03, 0x80, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x03, 0x80, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x8F, 0x00, 0x20, 0x02, 0x00, 0xF8, 0xFB,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x8F, 0x00, 0x20, 0x02,
+    0x00, 0xF8, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x8F,
+    0x00, 0x20, 0x02, 0x00, 0xF8, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D,
+    0xFF, 0x05, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8D, 0xFF, 0x05, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xFB, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xFB, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x02, 0x00, 0xF8, 0x8F, 0x00,
+    0x20, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x02, 0x00,
+    0xF8, 0x8F, 0x00, 0x20, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF,
+    0x05, 0x02, 0x00, 0xF8, 0x8F, 0x00, 0x20, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8C, 0xFF, 0x02, 0x5F, 0x00, 0x30, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xF5, 0xFA, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x02, 0x5F, 0x00, 0x30, 0x80, 0xFF, 0x02,
+    0x04, 0x00, 0xF5, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x02,
+    0x5F, 0x00, 0x30, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xF5, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x8C, 0xFF, 0x02, 0x09, 0x00, 0xE0, 0x80, 0xFF, 0x02, 0x1E, 0x00, 0x90, 0xFA,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x02, 0x09, 0x00, 0xE0, 0x80,
+    0xFF, 0x02, 0x1E, 0x00, 0x90, 0xFA, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C,
+    0xFF, 0x02, 0x09, 0x00, 0xE0, 0x80, 0xFF, 0x02, 0x1E, 0x00, 0x90, 0xFA, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x00,
+    0xBF, 0x80, 0x00, 0x00, 0xFC, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B,
+    0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0xF9,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00,
+    0xFB, 0x80, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x8B, 0xFF, 0x02, 0x2E, 0x00, 0x70, 0x82, 0xFF, 0x02, 0x07, 0x00, 0xE2, 0xF9,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x02, 0x2E, 0x00, 0x70, 0x82,
+    0xFF, 0x02, 0x07, 0x00, 0xE2, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B,
+    0xFF, 0x02, 0x2E, 0x00, 0x70, 0x82, 0xFF, 0x02, 0x07, 0x00, 0xE2, 0xF9, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x02, 0x04, 0x00, 0xF3, 0x82, 0xFF, 0x02, 0x3F, 0x00,
+    0x40, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x02, 0x04, 0x00,
+    0xF3, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0x40, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8B, 0xFF, 0x02, 0x04, 0x00, 0xF3, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0x40, 0xF9, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x03, 0x7F, 0x00, 0x10, 0xFE, 0x82, 0xFF,
+    0x03, 0xEF, 0x01, 0x00, 0xF7, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A,
+    0xFF, 0x03, 0x7F, 0x00, 0x10, 0xFE, 0x82, 0xFF, 0x03, 0xEF, 0x01, 0x00, 0xF7, 0xF8, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x03, 0x7F, 0x00, 0x10, 0xFE, 0x82, 0xFF,
+    0x03, 0xEF, 0x01, 0x00, 0xF7, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A,
+    0xFF, 0x02, 0x0B, 0x00, 0xC0, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0B, 0x00, 0xC0, 0x84, 0xFF, 0x02, 0x0C, 0x00,
+    0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x02, 0x0B, 0x00,
+    0xC0, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xB0, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x89, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xF9, 0x84, 0xFF, 0x03, 0x8F, 0x00, 0x10, 0xFD, 0xF7,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xF9,
+    0x84, 0xFF, 0x03, 0x8F, 0x00, 0x10, 0xFD, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x89, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xF9, 0x84, 0xFF, 0x03, 0x8F, 0x00, 0x10, 0xFD, 0xF7,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x02, 0x3F, 0x00, 0x50, 0x86,
+    0xFF, 0x02, 0x05, 0x00, 0xF3, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89,
+    0xFF, 0x02, 0x3F, 0x00, 0x50, 0x86, 0xFF, 0x02, 0x05, 0x00, 0xF3, 0xF7, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x02, 0x3F, 0x00, 0x50, 0x86, 0xFF, 0x02, 0x05, 0x00,
+    0xF3, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x02, 0x06, 0x00,
+    0xE2, 0x86, 0xFF, 0x02, 0x3E, 0x00, 0x60, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x89, 0xFF, 0x02, 0x06, 0x00, 0xE2, 0x86, 0xFF, 0x02, 0x3E, 0x00, 0x60, 0xF7, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x02, 0x06, 0x00, 0xE2, 0x86, 0xFF, 0x02,
+    0x3E, 0x00, 0x60, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00,
+    0xAF, 0x80, 0x00, 0x00, 0xFD, 0x86, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFA, 0xF6, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0xAF, 0x80, 0x00, 0x00, 0xFD, 0x86,
+    0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFA, 0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x88, 0xFF, 0x00, 0xAF, 0x80, 0x00, 0x00, 0xFD, 0x86, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00,
+    0xFA, 0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x02, 0x0D, 0x00,
+    0xA0, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xD0, 0xCE, 0xFF, 0x03, 0xDF, 0x15, 0x10, 0xC5, 0x82, 0xFF,
+    0x02, 0x2F, 0x00, 0xE0, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x02, 0x0D, 0x00, 0xA0, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xD0, 0xCE, 0xFF, 0x03, 0xDF, 0x15, 0x10,
+    0xC5, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xE0, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x88, 0xFF, 0x02, 0x0D, 0x00, 0xA0, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xD0, 0xCE, 0xFF, 0x03,
+    0xDF, 0x15, 0x10, 0xC5, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xE0, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x02, 0x04, 0x00, 0xF6, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0x30,
+    0xCE, 0xFF, 0x00, 0x0B, 0x81, 0x00, 0x00, 0xFA, 0x81, 0xFF, 0x02, 0x09, 0x00, 0xF8, 0x9B, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x02, 0x04, 0x00, 0xF6, 0x88, 0xFF,
+    0x02, 0x6F, 0x00, 0x30, 0xCE, 0xFF, 0x00, 0x0B, 0x81, 0x00, 0x00, 0xFA, 0x81, 0xFF, 0x02, 0x09,
+    0x00, 0xF8, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x02, 0x04,
+    0x00, 0xF6, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0x30, 0xCE, 0xFF, 0x00, 0x0B, 0x81, 0x00, 0x00, 0xFA,
+    0x81, 0xFF, 0x02, 0x09, 0x00, 0xF8, 0x9B, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x87, 0xFF, 0x02, 0x7F, 0x00, 0x20, 0x8A, 0xFF, 0x02, 0x02, 0x00, 0xF7, 0xCD, 0xFF, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0xE0, 0x81, 0xFF, 0x01, 0x01, 0x10, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x7F, 0x00, 0x20, 0x8A, 0xFF, 0x02, 0x02, 0x00, 0xF7, 0xCD,
+    0xFF, 0x00, 0x01, 0x81, 0x00, 0x00, 0xE0, 0x81, 0xFF, 0x01, 0x01, 0x10, 0x9C, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x7F, 0x00, 0x20, 0x8A, 0xFF, 0x02, 0x02,
+    0x00, 0xF7, 0xCD, 0xFF, 0x00, 0x01, 0x81, 0x00, 0x00, 0xE0, 0x81, 0xFF, 0x01, 0x01, 0x10, 0x9C,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x0C, 0x00, 0xC0, 0x80,
+    0xFF, 0x01, 0xBE, 0xB9, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xD0, 0xCC, 0xFF, 0x05, 0x9F, 0x00, 0x10,
+    0x39, 0x00, 0x60, 0x80, 0xFF, 0x02, 0x8F, 0x00, 0x90, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x0C, 0x00, 0xC0, 0x80, 0xFF, 0x01, 0xBE, 0xB9, 0x86, 0xFF,
+    0x02, 0x0C, 0x00, 0xD0, 0xCC, 0xFF, 0x05, 0x9F, 0x00, 0x10, 0x39, 0x00, 0x60, 0x80, 0xFF, 0x02,
+    0x8F, 0x00, 0x90, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x02,
+    0x0C, 0x00, 0xC0, 0x80, 0xFF, 0x01, 0xBE, 0xB9, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xD0, 0xCC, 0xFF,
+    0x05, 0x9F, 0x00, 0x10, 0x39, 0x00, 0x60, 0x80, 0xFF, 0x02, 0x8F, 0x00, 0x90, 0x9C, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x04, 0x03, 0x00, 0xF9, 0xFF, 0x6E, 0x80,
+    0x00, 0x00, 0x80, 0x85, 0xFF, 0x02, 0x9F, 0x00, 0x30, 0xCC, 0xFF, 0x05, 0x5F, 0x00, 0x90, 0xCF,
+    0x00, 0x10, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0xF2, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x87, 0xFF, 0x04, 0x03, 0x00, 0xF9, 0xFF, 0x6E, 0x80, 0x00, 0x00, 0x80, 0x85, 0xFF,
+    0x02, 0x9F, 0x00, 0x30, 0xCC, 0xFF, 0x05, 0x5F, 0x00, 0x90, 0xCF, 0x00, 0x10, 0x80, 0xFF, 0x02,
+    0x0E, 0x00, 0xF2, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x04,
+    0x03, 0x00, 0xF9, 0xFF, 0x6E, 0x80, 0x00, 0x00, 0x80, 0x85, 0xFF, 0x02, 0x9F, 0x00, 0x30, 0xCC,
+    0xFF, 0x05, 0x5F, 0x00, 0x90, 0xCF, 0x00, 0x10, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0xF2, 0x9C, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x02, 0xAF, 0x00, 0x30, 0x80, 0xFF,
+    0x00, 0x03, 0x81, 0x00, 0x00, 0xF7, 0x85, 0xFF, 0x02, 0x04, 0x00, 0xF9, 0xCB, 0xFF, 0x03, 0x2F,
+    0x00, 0xC0, 0xFF, 0x80, 0x00, 0x04, 0xFE, 0xFF, 0x06, 0x00, 0xFB, 0x9C, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x02, 0xAF, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x03, 0x81,
+    0x00, 0x00, 0xF7, 0x85, 0xFF, 0x02, 0x04, 0x00, 0xF9, 0xCB, 0xFF, 0x03, 0x2F, 0x00, 0xC0, 0xFF,
+    0x80, 0x00, 0x04, 0xFE, 0xFF, 0x06, 0x00, 0xFB, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x86, 0xFF, 0x02, 0xAF, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x03, 0x81, 0x00, 0x00, 0xF7,
+    0x85, 0xFF, 0x02, 0x04, 0x00, 0xF9, 0xCB, 0xFF, 0x03, 0x2F, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x04,
+    0xFE, 0xFF, 0x06, 0x00, 0xFB, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x04, 0x1F, 0x00, 0xC0, 0xFF, 0x8F, 0x82, 0x00, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x0C, 0x00,
+    0xF1, 0xCB, 0xFF, 0x09, 0x0F, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xFD, 0xDF, 0x00, 0x30, 0x9D, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x04, 0x1F, 0x00, 0xC0, 0xFF, 0x8F,
+    0x82, 0x00, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF1, 0xCB, 0xFF, 0x09, 0x0F, 0x00, 0xE0,
+    0xFF, 0x01, 0x00, 0xFD, 0xDF, 0x00, 0x30, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x86, 0xFF, 0x04, 0x1F, 0x00, 0xC0, 0xFF, 0x8F, 0x82, 0x00, 0x00, 0xB0, 0x85, 0xFF, 0x02,
+    0x0C, 0x00, 0xF1, 0xCB, 0xFF, 0x09, 0x0F, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xFD, 0xDF, 0x00, 0x30,
+    0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x09, 0x08, 0x00, 0xF6,
+    0xFF, 0x1F, 0x00, 0x90, 0x6B, 0x00, 0x50, 0x82, 0xFF, 0x05, 0x6A, 0xFC, 0xFF, 0x6F, 0x00, 0x80,
+    0xCB, 0xFF, 0x09, 0x0F, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0xFC, 0x5F, 0x00, 0xC0, 0x9D, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x09, 0x08, 0x00, 0xF6, 0xFF, 0x1F, 0x00,
+    0x90, 0x6B, 0x00, 0x50, 0x82, 0xFF, 0x05, 0x6A, 0xFC, 0xFF, 0x6F, 0x00, 0x80, 0xCB, 0xFF, 0x09,
+    0x0F, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0xFC, 0x5F, 0x00, 0xC0, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x09, 0x08, 0x00, 0xF6, 0xFF, 0x1F, 0x00, 0x90, 0x6B, 0x00,
+    0x50, 0x82, 0xFF, 0x05, 0x6A, 0xFC, 0xFF, 0x6F, 0x00, 0x80, 0xCB, 0xFF, 0x09, 0x0F, 0x00, 0xE0,
+    0xFF, 0x02, 0x00, 0xFC, 0x5F, 0x00, 0xC0, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x86, 0xFF, 0x09, 0x01, 0x10, 0xFE, 0xFF, 0x0E, 0x00, 0xF7, 0xFF, 0x03, 0x20, 0x81, 0xFF,
+    0x06, 0x8F, 0x00, 0xF0, 0xFF, 0xEF, 0x01, 0x10, 0xCB, 0xFF, 0x09, 0x1F, 0x00, 0xE0, 0xFF, 0x01,
+    0x00, 0xFD, 0x0C, 0x00, 0xF5, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x09, 0x01, 0x10, 0xFE, 0xFF, 0x0E, 0x00, 0xF7, 0xFF, 0x03, 0x20, 0x81, 0xFF, 0x06, 0x8F,
+    0x00, 0xF0, 0xFF, 0xEF, 0x01, 0x10, 0xCB, 0xFF, 0x09, 0x1F, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xFD,
+    0x0C, 0x00, 0xF5, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x09,
+    0x01, 0x10, 0xFE, 0xFF, 0x0E, 0x00, 0xF7, 0xFF, 0x03, 0x20, 0x81, 0xFF, 0x06, 0x8F, 0x00, 0xF0,
+    0xFF, 0xEF, 0x01, 0x10, 0xCB, 0xFF, 0x09, 0x1F, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xFD, 0x0C, 0x00,
+    0xF5, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x8F, 0x00,
+    0x70, 0x80, 0xFF, 0x05, 0x0D, 0x00, 0xF7, 0xFF, 0x04, 0x10, 0x81, 0xFF, 0x02, 0x08, 0x00, 0xE0,
+    0x80, 0xFF, 0x02, 0x07, 0x00, 0xF8, 0xCA, 0xFF, 0x03, 0x2F, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x06,
+    0xFE, 0x04, 0x00, 0xFD, 0x39, 0x00, 0x82, 0x9A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x85, 0xFF, 0x02, 0x8F, 0x00, 0x70, 0x80, 0xFF, 0x05, 0x0D, 0x00, 0xF7, 0xFF, 0x04, 0x10,
+    0x81, 0xFF, 0x02, 0x08, 0x00, 0xE0, 0x80, 0xFF, 0x02, 0x07, 0x00, 0xF8, 0xCA, 0xFF, 0x03, 0x2F,
+    0x00, 0xC0, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x04, 0x00, 0xFD, 0x39, 0x00, 0x82, 0x9A, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x8F, 0x00, 0x70, 0x80, 0xFF, 0x05,
+    0x0D, 0x00, 0xF7, 0xFF, 0x04, 0x10, 0x81, 0xFF, 0x02, 0x08, 0x00, 0xE0, 0x80, 0xFF, 0x02, 0x07,
+    0x00, 0xF8, 0xCA, 0xFF, 0x03, 0x2F, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0x04, 0x00, 0xFD,
+    0x39, 0x00, 0x82, 0x9A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02,
+    0x3F, 0x00, 0xE0, 0x80, 0xFF, 0x05, 0x0F, 0x00, 0xD1, 0xBF, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0xF3, 0xCA, 0xFF, 0x09, 0x5F, 0x00, 0x90,
+    0xCF, 0x00, 0x10, 0xBF, 0x00, 0x60, 0x4F, 0x81, 0x00, 0x00, 0xF3, 0x99, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x3F, 0x00, 0xE0, 0x80, 0xFF, 0x05, 0x0F, 0x00,
+    0xD1, 0xBF, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x02, 0x0E,
+    0x00, 0xF3, 0xCA, 0xFF, 0x09, 0x5F, 0x00, 0x90, 0xCF, 0x00, 0x10, 0xBF, 0x00, 0x60, 0x4F, 0x81,
+    0x00, 0x00, 0xF3, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02,
+    0x3F, 0x00, 0xE0, 0x80, 0xFF, 0x05, 0x0F, 0x00, 0xD1, 0xBF, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x8F,
+    0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0xF3, 0xCA, 0xFF, 0x09, 0x5F, 0x00, 0x90,
+    0xCF, 0x00, 0x10, 0xBF, 0x00, 0x60, 0x4F, 0x81, 0x00, 0x00, 0xF3, 0x99, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x80, 0xFF, 0x00, 0x5F, 0x82,
+    0x00, 0x00, 0x90, 0x80, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x81, 0xFF, 0x02, 0x6F, 0x00, 0xC0, 0xCA,
+    0xFF, 0x09, 0xAF, 0x00, 0x10, 0x39, 0x00, 0x60, 0x2F, 0x00, 0xE0, 0x08, 0x81, 0x00, 0x00, 0x60,
+    0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF6,
+    0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0x90, 0x80, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x81, 0xFF,
+    0x02, 0x6F, 0x00, 0xC0, 0xCA, 0xFF, 0x09, 0xAF, 0x00, 0x10, 0x39, 0x00, 0x60, 0x2F, 0x00, 0xE0,
+    0x08, 0x81, 0x00, 0x00, 0x60, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85,
+    0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0x90, 0x80, 0xFF, 0x02,
+    0x08, 0x00, 0x80, 0x81, 0xFF, 0x02, 0x6F, 0x00, 0xC0, 0xCA, 0xFF, 0x09, 0xAF, 0x00, 0x10, 0x39,
+    0x00, 0x60, 0x2F, 0x00, 0xE0, 0x08, 0x81, 0x00, 0x00, 0x60, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x07, 0x00, 0xFB, 0x80, 0xFF, 0x01, 0xEF, 0x01, 0x81,
+    0x00, 0x02, 0xF4, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x81, 0xFF, 0x02, 0xBF, 0x00, 0x70, 0xCB,
+    0xFF, 0x00, 0x02, 0x81, 0x00, 0x06, 0xD0, 0x09, 0x00, 0xF8, 0x01, 0x00, 0x76, 0x80, 0x00, 0x00,
+    0xFE, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x07, 0x00,
+    0xFB, 0x80, 0xFF, 0x01, 0xEF, 0x01, 0x81, 0x00, 0x02, 0xF4, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8,
+    0x81, 0xFF, 0x02, 0xBF, 0x00, 0x70, 0xCB, 0xFF, 0x00, 0x02, 0x81, 0x00, 0x06, 0xD0, 0x09, 0x00,
+    0xF8, 0x01, 0x00, 0x76, 0x80, 0x00, 0x00, 0xFE, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x85, 0xFF, 0x02, 0x07, 0x00, 0xFB, 0x80, 0xFF, 0x01, 0xEF, 0x01, 0x81, 0x00, 0x02,
+    0xF4, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x81, 0xFF, 0x02, 0xBF, 0x00, 0x70, 0xCB, 0xFF, 0x00,
+    0x02, 0x81, 0x00, 0x06, 0xD0, 0x09, 0x00, 0xF8, 0x01, 0x00, 0x76, 0x80, 0x00, 0x00, 0xFE, 0x98,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01, 0x03, 0x10, 0x82, 0xFF,
+    0x00, 0x3C, 0x80, 0x00, 0x05, 0x50, 0xFE, 0xFF, 0x08, 0x00, 0x80, 0x83, 0xFF, 0x01, 0x01, 0x30,
+    0xCB, 0xFF, 0x00, 0x1D, 0x81, 0x00, 0x09, 0xF9, 0x01, 0x10, 0xDF, 0x00, 0x10, 0xFF, 0x04, 0x00,
+    0xF9, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01, 0x03, 0x10,
+    0x82, 0xFF, 0x00, 0x3C, 0x80, 0x00, 0x05, 0x50, 0xFE, 0xFF, 0x08, 0x00, 0x80, 0x83, 0xFF, 0x01,
+    0x01, 0x30, 0xCB, 0xFF, 0x00, 0x1D, 0x81, 0x00, 0x09, 0xF9, 0x01, 0x10, 0xDF, 0x00, 0x10, 0xFF,
+    0x04, 0x00, 0xF9, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01,
+    0x03, 0x10, 0x82, 0xFF, 0x00, 0x3C, 0x80, 0x00, 0x05, 0x50, 0xFE, 0xFF, 0x08, 0x00, 0x80, 0x83,
+    0xFF, 0x01, 0x01, 0x30, 0xCB, 0xFF, 0x00, 0x1D, 0x81, 0x00, 0x09, 0xF9, 0x01, 0x10, 0xDF, 0x00,
+    0x10, 0xFF, 0x04, 0x00, 0xF9, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85,
+    0xFF, 0x01, 0x00, 0x50, 0x83, 0xFF, 0x04, 0x7A, 0x74, 0xFC, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8,
+    0x83, 0xFF, 0x01, 0x05, 0x00, 0xCB, 0xFF, 0x0D, 0xEF, 0x16, 0x10, 0xC4, 0x8F, 0x00, 0x90, 0xAF,
+    0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x85, 0xFF, 0x01, 0x00, 0x50, 0x83, 0xFF, 0x04, 0x7A, 0x74, 0xFC, 0xFF, 0x8F, 0x80, 0x00, 0x00,
+    0xF8, 0x83, 0xFF, 0x01, 0x05, 0x00, 0xCB, 0xFF, 0x0D, 0xEF, 0x16, 0x10, 0xC4, 0x8F, 0x00, 0x90,
+    0xAF, 0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x85, 0xFF, 0x01, 0x00, 0x50, 0x83, 0xFF, 0x04, 0x7A, 0x74, 0xFC, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0xF8, 0x83, 0xFF, 0x01, 0x05, 0x00, 0xCB, 0xFF, 0x0D, 0xEF, 0x16, 0x10, 0xC4, 0x8F, 0x00,
+    0x90, 0xAF, 0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x80, 0x87, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x84, 0xFF,
+    0x02, 0x08, 0x00, 0xFC, 0xCE, 0xFF, 0x09, 0x1E, 0x00, 0xF2, 0x8F, 0x00, 0x60, 0xFF, 0x09, 0x00,
+    0xF5, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00,
+    0x80, 0x87, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x84, 0xFF, 0x02, 0x08, 0x00, 0xFC, 0xCE, 0xFF, 0x09,
+    0x1E, 0x00, 0xF2, 0x8F, 0x00, 0x60, 0xFF, 0x09, 0x00, 0xF5, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x80, 0x87, 0xFF, 0x02, 0x08, 0x00, 0x80,
+    0x84, 0xFF, 0x02, 0x08, 0x00, 0xFC, 0xCE, 0xFF, 0x09, 0x1E, 0x00, 0xF2, 0x8F, 0x00, 0x60, 0xFF,
+    0x09, 0x00, 0xF5, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02,
+    0xBF, 0x00, 0xB0, 0x86, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x84, 0xFF, 0x02, 0x0C, 0x00,
+    0xFB, 0xCE, 0xFF, 0x09, 0x07, 0x00, 0xFA, 0x8F, 0x00, 0x60, 0xFF, 0x0A, 0x00, 0xF4, 0x98, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0xB0, 0x86, 0xFF,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xFB, 0xCE, 0xFF, 0x09, 0x07,
+    0x00, 0xFA, 0x8F, 0x00, 0x60, 0xFF, 0x0A, 0x00, 0xF4, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0xB0, 0x86, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0xF8, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xFB, 0xCE, 0xFF, 0x09, 0x07, 0x00, 0xFA, 0x8F, 0x00, 0x60,
+    0xFF, 0x0A, 0x00, 0xF4, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF,
+    0x02, 0xAF, 0x00, 0xB0, 0x86, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xFA,
+    0xCD, 0xFF, 0x0A, 0xDF, 0x00, 0x30, 0xFF, 0x9F, 0x00, 0x60, 0xFF, 0x09, 0x00, 0xF5, 0x98, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0, 0x86, 0xFF,
+    0x02, 0x08, 0x00, 0x80, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0xCD, 0xFF, 0x0A, 0xDF, 0x00, 0x30,
+    0xFF, 0x9F, 0x00, 0x60, 0xFF, 0x09, 0x00, 0xF5, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0, 0x86, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x85, 0xFF,
+    0x02, 0x0C, 0x00, 0xFA, 0xCD, 0xFF, 0x0A, 0xDF, 0x00, 0x30, 0xFF, 0x9F, 0x00, 0x60, 0xFF, 0x09,
+    0x00, 0xF5, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0x8F,
+    0x00, 0xB0, 0x85, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF7,
+    0xCD, 0xFF, 0x0A, 0x5F, 0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0x8F, 0x00, 0xB0, 0x85, 0xFF,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF7, 0xCD, 0xFF, 0x0A, 0x5F,
+    0x00, 0xC0, 0xFF, 0xAF, 0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0x8F, 0x00, 0xB0, 0x85, 0xFF, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0xF8, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF7, 0xCD, 0xFF, 0x0A, 0x5F, 0x00, 0xC0, 0xFF, 0xAF,
+    0x00, 0x40, 0xFF, 0x08, 0x00, 0xF6, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x86, 0xFF, 0x02, 0x0C,
+    0x00, 0xFA, 0xCD, 0xFF, 0x0A, 0x0C, 0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x10, 0xFF, 0x04, 0x00, 0xF9,
+    0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0,
+    0x85, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0xCD, 0xFF, 0x0A, 0x0C,
+    0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x10, 0xFF, 0x04, 0x00, 0xF9, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x08, 0x00, 0x80,
+    0x86, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0xCD, 0xFF, 0x0A, 0x0C, 0x00, 0xF5, 0xFF, 0xDF, 0x00, 0x10,
+    0xFF, 0x04, 0x00, 0xF9, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF,
+    0x02, 0xBF, 0x00, 0xB0, 0x84, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x86, 0xFF, 0x02, 0x0C,
+    0x00, 0xFB, 0xCD, 0xFF, 0x02, 0x04, 0x00, 0xFD, 0x80, 0xFF, 0x02, 0x02, 0x00, 0x86, 0x80, 0x00,
+    0x00, 0xFE, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xBF,
+    0x00, 0xB0, 0x84, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xFB,
+    0xCD, 0xFF, 0x02, 0x04, 0x00, 0xFD, 0x80, 0xFF, 0x02, 0x02, 0x00, 0x86, 0x80, 0x00, 0x00, 0xFE,
+    0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0xB0,
+    0x84, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xFB, 0xCD, 0xFF,
+    0x02, 0x04, 0x00, 0xFD, 0x80, 0xFF, 0x02, 0x02, 0x00, 0x86, 0x80, 0x00, 0x00, 0xFE, 0x98, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x90, 0x84, 0xFF,
+    0x02, 0x08, 0x00, 0x80, 0x87, 0xFF, 0x02, 0x09, 0x00, 0xFC, 0xCC, 0xFF, 0x02, 0xBF, 0x00, 0x60,
+    0x81, 0xFF, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x50, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x90, 0x84, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x87, 0xFF,
+    0x02, 0x09, 0x00, 0xFC, 0xCC, 0xFF, 0x02, 0xBF, 0x00, 0x60, 0x81, 0xFF, 0x00, 0x0A, 0x81, 0x00,
+    0x00, 0x50, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x84, 0xFF, 0x02, 0xCF,
+    0x00, 0x90, 0x84, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x87, 0xFF, 0x02, 0x09, 0x00, 0xFC, 0xCC, 0xFF,
+    0x02, 0xBF, 0x00, 0x60, 0x81, 0xFF, 0x00, 0x0A, 0x81, 0x00, 0x00, 0x50, 0x99, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01, 0x00, 0x60, 0x83, 0xFF, 0x00, 0x8F, 0x80,
+    0x00, 0x04, 0xF8, 0xFF, 0xCF, 0x57, 0xA7, 0x83, 0xFF, 0x01, 0x06, 0x00, 0xCD, 0xFF, 0x02, 0x2F,
+    0x00, 0xE0, 0x81, 0xFF, 0x00, 0x6F, 0x81, 0x00, 0x00, 0xE2, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01, 0x00, 0x60, 0x83, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x04,
+    0xF8, 0xFF, 0xCF, 0x57, 0xA7, 0x83, 0xFF, 0x01, 0x06, 0x00, 0xCD, 0xFF, 0x02, 0x2F, 0x00, 0xE0,
+    0x81, 0xFF, 0x00, 0x6F, 0x81, 0x00, 0x00, 0xE2, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x85, 0xFF, 0x01, 0x00, 0x60, 0x83, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x04, 0xF8, 0xFF,
+    0xCF, 0x57, 0xA7, 0x83, 0xFF, 0x01, 0x06, 0x00, 0xCD, 0xFF, 0x02, 0x2F, 0x00, 0xE0, 0x81, 0xFF,
+    0x00, 0x6F, 0x81, 0x00, 0x00, 0xE2, 0x99, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x85, 0xFF, 0x01, 0x02, 0x20, 0x83, 0xFF, 0x05, 0x08, 0x00, 0x80, 0xFF, 0xEF, 0x05, 0x80, 0x00,
+    0x00, 0xC3, 0x82, 0xFF, 0x01, 0x02, 0x20, 0xCD, 0xFF, 0x02, 0x0A, 0x00, 0xF7, 0x82, 0xFF, 0x02,
+    0x3A, 0x00, 0x82, 0x9A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01,
+    0x02, 0x20, 0x83, 0xFF, 0x05, 0x08, 0x00, 0x80, 0xFF, 0xEF, 0x05, 0x80, 0x00, 0x00, 0xC3, 0x82,
+    0xFF, 0x01, 0x02, 0x20, 0xCD, 0xFF, 0x02, 0x0A, 0x00, 0xF7, 0x82, 0xFF, 0x02, 0x3A, 0x00, 0x82,
+    0x9A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x01, 0x02, 0x20, 0x83,
+    0xFF, 0x05, 0x08, 0x00, 0x80, 0xFF, 0xEF, 0x05, 0x80, 0x00, 0x00, 0xC3, 0x82, 0xFF, 0x01, 0x02,
+    0x20, 0xCD, 0xFF, 0x02, 0x0A, 0x00, 0xF7, 0x82, 0xFF, 0x02, 0x3A, 0x00, 0x82, 0x9A, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x06, 0x00, 0xFE, 0x81, 0xFF, 0x00,
+    0x8F, 0x80, 0x00, 0x02, 0xF8, 0xFF, 0x4F, 0x81, 0x00, 0x01, 0x10, 0xFE, 0x80, 0xFF, 0x02, 0xEF,
+    0x00, 0x60, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x06,
+    0x00, 0xFE, 0x81, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x02, 0xF8, 0xFF, 0x4F, 0x81, 0x00, 0x01, 0x10,
+    0xFE, 0x80, 0xFF, 0x02, 0xEF, 0x00, 0x60, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x85, 0xFF, 0x02, 0x06, 0x00, 0xFE, 0x81, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x02, 0xF8, 0xFF,
+    0x4F, 0x81, 0x00, 0x01, 0x10, 0xFE, 0x80, 0xFF, 0x02, 0xEF, 0x00, 0x60, 0xF3, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x0B, 0x00, 0xF7, 0x81, 0xFF, 0x02, 0x08,
+    0x00, 0x80, 0x80, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0xF5, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0xB0,
+    0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x0B, 0x00, 0xF7,
+    0x81, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0xF5, 0x80, 0xFF,
+    0x02, 0x7F, 0x00, 0xB0, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF,
+    0x02, 0x0B, 0x00, 0xF7, 0x81, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x0A, 0x82, 0x00,
+    0x00, 0xF5, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0xB0, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x85, 0xFF, 0x02, 0x1F, 0x00, 0xF2, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8,
+    0x80, 0xFF, 0x05, 0x04, 0x00, 0xFA, 0x1D, 0x00, 0xF1, 0x80, 0xFF, 0x02, 0x2F, 0x00, 0xF1, 0xF3,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x1F, 0x00, 0xF2, 0x80,
+    0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x05, 0x04, 0x00, 0xFA, 0x1D, 0x00, 0xF1,
+    0x80, 0xFF, 0x02, 0x2F, 0x00, 0xF1, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x85, 0xFF, 0x02, 0x1F, 0x00, 0xF2, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF,
+    0x05, 0x04, 0x00, 0xFA, 0x1D, 0x00, 0xF1, 0x80, 0xFF, 0x02, 0x2F, 0x00, 0xF1, 0xF3, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x7F, 0x00, 0x90, 0x80, 0xFF, 0x02,
+    0x0E, 0x00, 0x80, 0x81, 0xFF, 0x05, 0x01, 0x40, 0xFF, 0x8F, 0x00, 0xD0, 0x80, 0xFF, 0x02, 0x09,
+    0x00, 0xF7, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x02, 0x7F,
+    0x00, 0x90, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0x80, 0x81, 0xFF, 0x05, 0x01, 0x40, 0xFF, 0x8F, 0x00,
+    0xD0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0xF7, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x85, 0xFF, 0x02, 0x7F, 0x00, 0x90, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0x80, 0x81, 0xFF, 0x05,
+    0x01, 0x40, 0xFF, 0x8F, 0x00, 0xD0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0xF7, 0xF3, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x07, 0xEF, 0x00, 0x10, 0xFE, 0xFF, 0x0F, 0x00,
+    0xF8, 0x81, 0xFF, 0x0A, 0x02, 0x30, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xEF, 0x01, 0x00, 0xFE, 0xF3,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x07, 0xEF, 0x00, 0x10, 0xFE,
+    0xFF, 0x0F, 0x00, 0xF8, 0x81, 0xFF, 0x0A, 0x02, 0x30, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xEF, 0x01,
+    0x00, 0xFE, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x85, 0xFF, 0x07, 0xEF,
+    0x00, 0x10, 0xFE, 0xFF, 0x0F, 0x00, 0xF8, 0x81, 0xFF, 0x0A, 0x02, 0x30, 0xFF, 0x7F, 0x00, 0xE0,
+    0xFF, 0xEF, 0x01, 0x00, 0xFE, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x05, 0x07, 0x00, 0xF4, 0xFF, 0xCF, 0x95, 0x82, 0xFF, 0x09, 0x05, 0x00, 0xC7, 0x09, 0x00,
+    0xF1, 0xFF, 0x5F, 0x00, 0x70, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x05, 0x07, 0x00, 0xF4, 0xFF, 0xCF, 0x95, 0x82, 0xFF, 0x09, 0x05, 0x00, 0xC7, 0x09, 0x00,
+    0xF1, 0xFF, 0x5F, 0x00, 0x70, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x05, 0x07, 0x00, 0xF4, 0xFF, 0xCF, 0x95, 0x82, 0xFF, 0x09, 0x05, 0x00, 0xC7, 0x09, 0x00,
+    0xF1, 0xFF, 0x5F, 0x00, 0x70, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86,
+    0xFF, 0x02, 0x1F, 0x00, 0x80, 0x85, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x04, 0xF7, 0xFF, 0x08, 0x00,
+    0xF1, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x02, 0x1F, 0x00,
+    0x80, 0x85, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x04, 0xF7, 0xFF, 0x08, 0x00, 0xF1, 0xF4, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x86, 0xFF, 0x02, 0x1F, 0x00, 0x80, 0x85, 0xFF, 0x00,
+    0x0C, 0x82, 0x00, 0x04, 0xF7, 0xFF, 0x08, 0x00, 0xF1, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xF9, 0x84, 0xFF, 0x00, 0x7F, 0x81,
+    0x00, 0x02, 0x30, 0xFF, 0x9F, 0x80, 0x00, 0x00, 0xFB, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xF9, 0x84, 0xFF, 0x00, 0x7F, 0x81,
+    0x00, 0x02, 0x30, 0xFF, 0x9F, 0x80, 0x00, 0x00, 0xFB, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x86, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xF9, 0x84, 0xFF, 0x00, 0x7F, 0x81,
+    0x00, 0x02, 0x30, 0xFF, 0x9F, 0x80, 0x00, 0x00, 0xFB, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x07, 0x00, 0x90, 0x85, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x04,
+    0xE6, 0xFF, 0x09, 0x00, 0x70, 0xF5, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87,
+    0xFF, 0x02, 0x07, 0x00, 0x90, 0x85, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x04, 0xE6, 0xFF, 0x09, 0x00,
+    0x70, 0xF5, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x02, 0x07, 0x00,
+    0x90, 0x85, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x04, 0xE6, 0xFF, 0x09, 0x00, 0x70, 0xF5, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0x5F, 0x80, 0x00, 0x00, 0xF6, 0x85,
+    0xFF, 0x03, 0x8B, 0xEB, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xF5, 0xF5, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x87, 0xFF, 0x00, 0x5F, 0x80, 0x00, 0x00, 0xF6, 0x85, 0xFF, 0x03, 0x8B,
+    0xEB, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xF5, 0xF5, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x87, 0xFF, 0x00, 0x5F, 0x80, 0x00, 0x00, 0xF6, 0x85, 0xFF, 0x03, 0x8B, 0xEB, 0xFF, 0x7F,
+    0x80, 0x00, 0x00, 0xF5, 0xF5, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x03, 0x04, 0x00, 0x30, 0xFB, 0x86, 0xFF, 0x03, 0xBF, 0x03, 0x00, 0x40, 0xF6, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x03, 0x04, 0x00, 0x30, 0xFB, 0x86, 0xFF, 0x03,
+    0xBF, 0x03, 0x00, 0x40, 0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x03, 0x04, 0x00, 0x30, 0xFB, 0x86, 0xFF, 0x03, 0xBF, 0x03, 0x00, 0x40, 0xF6, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x50, 0xFC, 0x84,
+    0xFF, 0x01, 0xCF, 0x05, 0x80, 0x00, 0x00, 0xF7, 0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x88, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x01, 0x50, 0xFC, 0x84, 0xFF, 0x01, 0xCF, 0x05,
+    0x80, 0x00, 0x00, 0xF7, 0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x88, 0xFF,
+    0x00, 0x7F, 0x80, 0x00, 0x01, 0x50, 0xFC, 0x84, 0xFF, 0x01, 0xCF, 0x05, 0x80, 0x00, 0x00, 0xF7,
+    0xF6, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x09, 0x80, 0x00,
+    0x01, 0x30, 0xC8, 0x82, 0xFF, 0x01, 0x8C, 0x03, 0x80, 0x00, 0x00, 0x90, 0xF7, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x01, 0x30, 0xC8, 0x82,
+    0xFF, 0x01, 0x8C, 0x03, 0x80, 0x00, 0x00, 0x90, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x89, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x01, 0x30, 0xC8, 0x82, 0xFF, 0x01, 0x8C, 0x03,
+    0x80, 0x00, 0x00, 0x90, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF,
+    0x01, 0xDF, 0x04, 0x81, 0x00, 0x00, 0x30, 0x80, 0x44, 0x00, 0x03, 0x81, 0x00, 0x01, 0x40, 0xFD,
+    0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x01, 0xDF, 0x04, 0x81,
+    0x00, 0x00, 0x30, 0x80, 0x44, 0x00, 0x03, 0x81, 0x00, 0x01, 0x40, 0xFD, 0xF7, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x89, 0xFF, 0x01, 0xDF, 0x04, 0x81, 0x00, 0x00, 0x30, 0x80,
+    0x44, 0x00, 0x03, 0x81, 0x00, 0x01, 0x40, 0xFD, 0xF7, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8A, 0xFF, 0x01, 0xAF, 0x03, 0x86, 0x00, 0x01, 0x20, 0xFA, 0xF8, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x01, 0xAF, 0x03, 0x86, 0x00, 0x01, 0x20, 0xFA,
+    0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8A, 0xFF, 0x01, 0xAF, 0x03, 0x86,
+    0x00, 0x01, 0x20, 0xFA, 0xF8, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF,
+    0x01, 0xCF, 0x15, 0x84, 0x00, 0x01, 0x51, 0xFC, 0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8B, 0xFF, 0x01, 0xCF, 0x15, 0x84, 0x00, 0x01, 0x51, 0xFC, 0xF9, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x01, 0xCF, 0x15, 0x84, 0x00, 0x01, 0x51, 0xFC,
+    0xF9, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05, 0x8C, 0x35, 0x03,
+    0x30, 0x53, 0xC8, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x05,
+    0x8C, 0x35, 0x03, 0x30, 0x53, 0xC8, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8D, 0xFF, 0x05, 0x8C, 0x35, 0x03, 0x30, 0x53, 0xC8, 0xFB, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x90,
+    0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x90, 0xFF, 0x00,
+    0xFE, 0xFD, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x90, 0xFF, 0x00, 0xFE, 0xFD,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x09, 0x70, 0xFD, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x09, 0x70, 0xFD, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x09, 0x70, 0xFD, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF,
+    0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF,
+    0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF,
+    0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF,
+    0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF,
+    0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF,
+    0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xFC, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC,
+    0xFC, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0xEF, 0x80, 0x00,
+    0x00, 0xFC, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8C, 0xFF, 0x02, 0x48, 0x44, 0x34, 0x80, 0x00, 0x02, 0x43, 0x44, 0x74, 0xD2, 0xFF,
+    0x02, 0x09, 0x00, 0x80, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF,
+    0x02, 0x48, 0x44, 0x34, 0x80, 0x00, 0x02, 0x43, 0x44, 0x74, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x80,
+    0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x02, 0x48, 0x44, 0x34,
+    0x80, 0x00, 0x02, 0x43, 0x44, 0x74, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x80, 0xA3, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0x9F, 0x86, 0x00, 0x00, 0xF7, 0xD1, 0xFF,
+    0x02, 0x09, 0x00, 0x80, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF,
+    0x00, 0x9F, 0x86, 0x00, 0x00, 0xF7, 0xD1, 0xFF, 0x02, 0x09, 0x00, 0x80, 0xA3, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0x9F, 0x86, 0x00, 0x00, 0xF7, 0xD1, 0xFF,
+    0x02, 0x09, 0x00, 0x80, 0xA3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF,
+    0x00, 0x6F, 0x86, 0x00, 0x00, 0xF4, 0xD1, 0xFF, 0x07, 0x09, 0x00, 0x90, 0xCF, 0x25, 0x00, 0x62,
+    0xFD, 0x81, 0xFF, 0x06, 0x09, 0x00, 0xF4, 0xCF, 0x15, 0x10, 0xA4, 0x83, 0xFF, 0x04, 0x6A, 0x13,
+    0x00, 0x41, 0xE8, 0x8A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00,
+    0x6F, 0x86, 0x00, 0x00, 0xF4, 0xD1, 0xFF, 0x07, 0x09, 0x00, 0x90, 0xCF, 0x25, 0x00, 0x62, 0xFD,
+    0x81, 0xFF, 0x06, 0x09, 0x00, 0xF4, 0xCF, 0x15, 0x10, 0xA4, 0x83, 0xFF, 0x04, 0x6A, 0x13, 0x00,
+    0x41, 0xE8, 0x8A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0x6F,
+    0x86, 0x00, 0x00, 0xF4, 0xD1, 0xFF, 0x07, 0x09, 0x00, 0x90, 0xCF, 0x25, 0x00, 0x62, 0xFD, 0x81,
+    0xFF, 0x06, 0x09, 0x00, 0xF4, 0xCF, 0x15, 0x10, 0xA4, 0x83, 0xFF, 0x04, 0x6A, 0x13, 0x00, 0x41,
+    0xE8, 0x8A, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0xBF, 0x86,
+    0x00, 0x00, 0xF9, 0xD1, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x08, 0x81, 0x00, 0x00, 0xA0, 0x81, 0xFF,
+    0x03, 0x09, 0x00, 0xF0, 0x07, 0x81, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00,
+    0xF9, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0xBF, 0x86,
+    0x00, 0x00, 0xF9, 0xD1, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x08, 0x81, 0x00, 0x00, 0xA0, 0x81, 0xFF,
+    0x03, 0x09, 0x00, 0xF0, 0x07, 0x81, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00,
+    0xF9, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8B, 0xFF, 0x00, 0xBF, 0x86,
+    0x00, 0x00, 0xF9, 0xD1, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x08, 0x81, 0x00, 0x00, 0xA0, 0x81, 0xFF,
+    0x03, 0x09, 0x00, 0xF0, 0x07, 0x81, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00,
+    0xF9, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00, 0x06, 0x84,
+    0x00, 0x00, 0x40, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x50, 0x83, 0x00, 0x00, 0xFC, 0x80, 0xFF, 0x02,
+    0x09, 0x00, 0x50, 0x82, 0x00, 0x00, 0x50, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00, 0xA0, 0x89,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00, 0x06, 0x84, 0x00, 0x00,
+    0x40, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x50, 0x83, 0x00, 0x00, 0xFC, 0x80, 0xFF, 0x02, 0x09, 0x00,
+    0x50, 0x82, 0x00, 0x00, 0x50, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00, 0xA0, 0x89, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00, 0x06, 0x84, 0x00, 0x00, 0x40, 0xD2,
+    0xFF, 0x02, 0x09, 0x00, 0x50, 0x83, 0x00, 0x00, 0xFC, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x50, 0x82,
+    0x00, 0x00, 0x50, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00, 0xA0, 0x89, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00, 0x2F, 0x84, 0x00, 0x00, 0xE1, 0xD2, 0xFF, 0x00,
+    0x09, 0x85, 0x00, 0x00, 0xF5, 0x80, 0xFF, 0x00, 0x09, 0x85, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x03,
+    0x0E, 0x00, 0x30, 0x45, 0x80, 0x00, 0x00, 0x10, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x8C, 0xFF, 0x00, 0x2F, 0x84, 0x00, 0x00, 0xE1, 0xD2, 0xFF, 0x00, 0x09, 0x85, 0x00,
+    0x00, 0xF5, 0x80, 0xFF, 0x00, 0x09, 0x85, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x03, 0x0E, 0x00, 0x30,
+    0x45, 0x80, 0x00, 0x00, 0x10, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C,
+    0xFF, 0x00, 0x2F, 0x84, 0x00, 0x00, 0xE1, 0xD2, 0xFF, 0x00, 0x09, 0x85, 0x00, 0x00, 0xF5, 0x80,
+    0xFF, 0x00, 0x09, 0x85, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x03, 0x0E, 0x00, 0x30, 0x45, 0x80, 0x00,
+    0x00, 0x10, 0x89, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00, 0xCF,
+    0x84, 0x00, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0xDF, 0xBB, 0xFD, 0xCA, 0xFF, 0x00, 0x09, 0x80, 0x00,
+    0x02, 0x90, 0xFF, 0x3D, 0x80, 0x00, 0x00, 0xF0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xC3,
+    0xFF, 0x1B, 0x80, 0x00, 0x00, 0xF4, 0x80, 0xFF, 0x01, 0x7F, 0xB5, 0x80, 0xFF, 0x00, 0x1D, 0x80,
+    0x00, 0x00, 0xFC, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF, 0x00,
+    0xCF, 0x84, 0x00, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0xDF, 0xBB, 0xFD, 0xCA, 0xFF, 0x00, 0x09, 0x80,
+    0x00, 0x02, 0x90, 0xFF, 0x3D, 0x80, 0x00, 0x00, 0xF0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02,
+    0xC3, 0xFF, 0x1B, 0x80, 0x00, 0x00, 0xF4, 0x80, 0xFF, 0x01, 0x7F, 0xB5, 0x80, 0xFF, 0x00, 0x1D,
+    0x80, 0x00, 0x00, 0xFC, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8C, 0xFF,
+    0x00, 0xCF, 0x84, 0x00, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0xDF, 0xBB, 0xFD, 0xCA, 0xFF, 0x00, 0x09,
+    0x80, 0x00, 0x02, 0x90, 0xFF, 0x3D, 0x80, 0x00, 0x00, 0xF0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00,
+    0x02, 0xC3, 0xFF, 0x1B, 0x80, 0x00, 0x00, 0xF4, 0x80, 0xFF, 0x01, 0x7F, 0xB5, 0x80, 0xFF, 0x00,
+    0x1D, 0x80, 0x00, 0x00, 0xFC, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D,
+    0xFF, 0x00, 0x08, 0x82, 0x00, 0x00, 0x60, 0x83, 0xFF, 0x04, 0x7E, 0x01, 0x00, 0x20, 0xF8, 0xC9,
+    0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xFA, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0xD0, 0x80, 0xFF, 0x00,
+    0x09, 0x80, 0x00, 0x02, 0xFE, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xF0, 0x84, 0xFF, 0x00, 0x7F, 0x80,
+    0x00, 0x00, 0xF9, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x00,
+    0x08, 0x82, 0x00, 0x00, 0x60, 0x83, 0xFF, 0x04, 0x7E, 0x01, 0x00, 0x20, 0xF8, 0xC9, 0xFF, 0x00,
+    0x09, 0x80, 0x00, 0x02, 0xFA, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0xD0, 0x80, 0xFF, 0x00, 0x09, 0x80,
+    0x00, 0x02, 0xFE, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xF0, 0x84, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0xF9, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x00, 0x08, 0x82,
+    0x00, 0x00, 0x60, 0x83, 0xFF, 0x04, 0x7E, 0x01, 0x00, 0x20, 0xF8, 0xC9, 0xFF, 0x00, 0x09, 0x80,
+    0x00, 0x02, 0xFA, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0xD0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02,
+    0xFE, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0xF0, 0x84, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xF9, 0x88,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x00, 0x4F, 0x82, 0x00, 0x00,
+    0xF2, 0x82, 0xFF, 0x01, 0xAF, 0x01, 0x81, 0x00, 0x01, 0x20, 0xFC, 0xC8, 0xFF, 0x02, 0x09, 0x00,
+    0x10, 0x81, 0xFF, 0x02, 0x02, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x40, 0x81, 0xFF, 0x02,
+    0x01, 0x00, 0xC0, 0x84, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x00, 0x4F, 0x82, 0x00, 0x00, 0xF2, 0x82, 0xFF, 0x01,
+    0xAF, 0x01, 0x81, 0x00, 0x01, 0x20, 0xFC, 0xC8, 0xFF, 0x02, 0x09, 0x00, 0x10, 0x81, 0xFF, 0x02,
+    0x02, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x01, 0x00, 0xC0, 0x84,
+    0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x8D, 0xFF, 0x00, 0x4F, 0x82, 0x00, 0x00, 0xF2, 0x82, 0xFF, 0x01, 0xAF, 0x01, 0x81, 0x00,
+    0x01, 0x20, 0xFC, 0xC8, 0xFF, 0x02, 0x09, 0x00, 0x10, 0x81, 0xFF, 0x02, 0x02, 0x00, 0xC0, 0x80,
+    0xFF, 0x02, 0x09, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x01, 0x00, 0xC0, 0x84, 0xFF, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x01,
+    0xEF, 0x01, 0x81, 0x00, 0x00, 0xFC, 0x82, 0xFF, 0x00, 0x09, 0x83, 0x00, 0x00, 0xC0, 0xC8, 0xFF,
+    0x02, 0x09, 0x00, 0x50, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0x81, 0xFF, 0x02, 0x04, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0x6A, 0x24, 0x11, 0x81, 0x00, 0x00, 0xF8,
+    0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x01, 0xEF, 0x01, 0x81,
+    0x00, 0x00, 0xFC, 0x82, 0xFF, 0x00, 0x09, 0x83, 0x00, 0x00, 0xC0, 0xC8, 0xFF, 0x02, 0x09, 0x00,
+    0x50, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02,
+    0x04, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0x6A, 0x24, 0x11, 0x81, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8D, 0xFF, 0x01, 0xEF, 0x01, 0x81, 0x00, 0x00, 0xFC,
+    0x82, 0xFF, 0x00, 0x09, 0x83, 0x00, 0x00, 0xC0, 0xC8, 0xFF, 0x02, 0x09, 0x00, 0x50, 0x81, 0xFF,
+    0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xA0,
+    0x81, 0xFF, 0x02, 0x6A, 0x24, 0x11, 0x81, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x80, 0x82, 0xFF, 0x00, 0xBF,
+    0x84, 0x00, 0x01, 0x10, 0xFE, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00,
+    0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x90, 0x80, 0xFF, 0x00,
+    0x08, 0x84, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E,
+    0xFF, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x80, 0x82, 0xFF, 0x00, 0xBF, 0x84, 0x00, 0x01, 0x10, 0xFE,
+    0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09,
+    0x00, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x90, 0x80, 0xFF, 0x00, 0x08, 0x84, 0x00, 0x00, 0xF8,
+    0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x0B, 0x80, 0x00,
+    0x00, 0x80, 0x82, 0xFF, 0x00, 0xBF, 0x84, 0x00, 0x01, 0x10, 0xFE, 0xC7, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02,
+    0x05, 0x00, 0x90, 0x80, 0xFF, 0x00, 0x08, 0x84, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xF4, 0x82, 0xFF, 0x00,
+    0x2F, 0x80, 0x00, 0x02, 0xB3, 0xFF, 0x2A, 0x80, 0x00, 0x00, 0xF5, 0xC7, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x04,
+    0x05, 0x00, 0xA0, 0xFF, 0x6F, 0x82, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xF4, 0x82,
+    0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xB3, 0xFF, 0x2A, 0x80, 0x00, 0x00, 0xF5, 0xC7, 0xFF, 0x02,
+    0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81,
+    0xFF, 0x04, 0x05, 0x00, 0xA0, 0xFF, 0x6F, 0x82, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00, 0xF8, 0x88,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8E, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x00,
+    0xF4, 0x82, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xB3, 0xFF, 0x2A, 0x80, 0x00, 0x00, 0xF5, 0xC7,
+    0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x81, 0xFF, 0x04, 0x05, 0x00, 0xA0, 0xFF, 0x6F, 0x82, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00,
+    0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x02, 0x02, 0x10,
+    0xFE, 0x82, 0xFF, 0x02, 0x0A, 0x00, 0x60, 0x80, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xD0, 0xC7, 0xFF,
+    0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x60,
+    0x81, 0xFF, 0x04, 0x04, 0x00, 0xB0, 0xFF, 0x0C, 0x80, 0x00, 0x02, 0xC5, 0xFF, 0x8F, 0x80, 0x00,
+    0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x02, 0x02,
+    0x10, 0xFE, 0x82, 0xFF, 0x02, 0x0A, 0x00, 0x60, 0x80, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xD0, 0xC7,
+    0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00,
+    0x60, 0x81, 0xFF, 0x04, 0x04, 0x00, 0xB0, 0xFF, 0x0C, 0x80, 0x00, 0x02, 0xC5, 0xFF, 0x8F, 0x80,
+    0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x02,
+    0x02, 0x10, 0xFE, 0x82, 0xFF, 0x02, 0x0A, 0x00, 0x60, 0x80, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xD0,
+    0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09,
+    0x00, 0x60, 0x81, 0xFF, 0x04, 0x04, 0x00, 0xB0, 0xFF, 0x0C, 0x80, 0x00, 0x02, 0xC5, 0xFF, 0x8F,
+    0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF,
+    0x01, 0x6E, 0xD6, 0x83, 0xFF, 0x02, 0x09, 0x00, 0xF2, 0x81, 0xFF, 0x02, 0x0D, 0x00, 0x80, 0xC7,
+    0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00,
+    0x30, 0x81, 0xFF, 0x06, 0x01, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x50, 0x80, 0xFF, 0x00, 0x8F, 0x80,
+    0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01,
+    0x6E, 0xD6, 0x83, 0xFF, 0x02, 0x09, 0x00, 0xF2, 0x81, 0xFF, 0x02, 0x0D, 0x00, 0x80, 0xC7, 0xFF,
+    0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x30,
+    0x81, 0xFF, 0x06, 0x01, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x50, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x8F, 0xFF, 0x01, 0x6E,
+    0xD6, 0x83, 0xFF, 0x02, 0x09, 0x00, 0xF2, 0x81, 0xFF, 0x02, 0x0D, 0x00, 0x80, 0xC7, 0xFF, 0x02,
+    0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0x30, 0x81,
+    0xFF, 0x06, 0x01, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x50, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x96, 0xFF, 0x02, 0x3E, 0x00,
+    0xFB, 0x81, 0xFF, 0x02, 0x4F, 0x00, 0x50, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02,
+    0x04, 0x00, 0xC0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xFD, 0xFF, 0xAF, 0x80, 0x00, 0x04,
+    0xF1, 0xFF, 0x06, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x4F, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x96, 0xFF, 0x02, 0x3E, 0x00, 0xFB, 0x81, 0xFF, 0x02,
+    0x4F, 0x00, 0x50, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80,
+    0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xFD, 0xFF, 0xAF, 0x80, 0x00, 0x04, 0xF1, 0xFF, 0x06, 0x00,
+    0x80, 0x80, 0xFF, 0x00, 0x4F, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x96, 0xFF, 0x02, 0x3E, 0x00, 0xFB, 0x81, 0xFF, 0x02, 0x4F, 0x00, 0x50, 0xC7,
+    0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x00, 0x09, 0x80,
+    0x00, 0x02, 0xFD, 0xFF, 0xAF, 0x80, 0x00, 0x04, 0xF1, 0xFF, 0x06, 0x00, 0x80, 0x80, 0xFF, 0x00,
+    0x4F, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x97,
+    0xFF, 0x00, 0xEC, 0x82, 0xFF, 0x02, 0x7F, 0x00, 0x30, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81,
+    0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xB1, 0xFF, 0x1A, 0x80,
+    0x00, 0x04, 0xF5, 0xFF, 0x07, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF8, 0x88,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x97, 0xFF, 0x00, 0xEC, 0x82, 0xFF, 0x02,
+    0x7F, 0x00, 0x30, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80,
+    0xFF, 0x00, 0x09, 0x80, 0x00, 0x02, 0xB1, 0xFF, 0x1A, 0x80, 0x00, 0x04, 0xF5, 0xFF, 0x07, 0x00,
+    0x40, 0x80, 0xFF, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x97, 0xFF, 0x00, 0xEC, 0x82, 0xFF, 0x02, 0x7F, 0x00, 0x30, 0xC7, 0xFF, 0x02,
+    0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x02,
+    0xB1, 0xFF, 0x1A, 0x80, 0x00, 0x04, 0xF5, 0xFF, 0x07, 0x00, 0x40, 0x80, 0xFF, 0x00, 0x07, 0x80,
+    0x00, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02,
+    0x7F, 0x00, 0x30, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80,
+    0xFF, 0x00, 0x09, 0x85, 0x00, 0x02, 0xFD, 0xFF, 0x0A, 0x80, 0x00, 0x01, 0x52, 0x14, 0x81, 0x00,
+    0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02, 0x7F,
+    0x00, 0x30, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF,
+    0x00, 0x09, 0x85, 0x00, 0x02, 0xFD, 0xFF, 0x0A, 0x80, 0x00, 0x01, 0x52, 0x14, 0x81, 0x00, 0x00,
+    0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02, 0x7F, 0x00,
+    0x30, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x00,
+    0x09, 0x85, 0x00, 0x02, 0xFD, 0xFF, 0x0A, 0x80, 0x00, 0x01, 0x52, 0x14, 0x81, 0x00, 0x00, 0xF8,
+    0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02, 0x1E, 0x00, 0x50,
+    0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x09,
+    0x00, 0x10, 0x82, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x00, 0x1F, 0x82, 0x00, 0x03, 0x50, 0x02, 0x00,
+    0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02, 0x1E, 0x00,
+    0x50, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x02,
+    0x09, 0x00, 0x10, 0x82, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x00, 0x1F, 0x82, 0x00, 0x03, 0x50, 0x02,
+    0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9C, 0xFF, 0x02, 0x1E,
+    0x00, 0x50, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF,
+    0x02, 0x09, 0x00, 0x10, 0x82, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x00, 0x1F, 0x82, 0x00, 0x03, 0x50,
+    0x02, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x9B, 0xFF, 0x03,
+    0xDF, 0x02, 0x00, 0xA0, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0,
+    0x80, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x04, 0x81, 0x00, 0x00, 0xF6, 0x80, 0xFF, 0x01, 0xCF, 0x01,
+    0x81, 0x00, 0x03, 0xF5, 0x07, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x9B, 0xFF, 0x03, 0xDF, 0x02, 0x00, 0xA0, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF,
+    0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x04, 0x81, 0x00, 0x00, 0xF6, 0x80,
+    0xFF, 0x01, 0xCF, 0x01, 0x81, 0x00, 0x03, 0xF5, 0x07, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x9B, 0xFF, 0x03, 0xDF, 0x02, 0x00, 0xA0, 0xC7, 0xFF, 0x02, 0x09,
+    0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x03, 0x09, 0x00, 0xA0, 0x04, 0x81,
+    0x00, 0x00, 0xF6, 0x80, 0xFF, 0x01, 0xCF, 0x01, 0x81, 0x00, 0x03, 0xF5, 0x07, 0x00, 0xF8, 0x88,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xAF, 0x97, 0x77, 0x00,
+    0x04, 0x80, 0x00, 0x00, 0xF3, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00,
+    0xC0, 0x80, 0xFF, 0x06, 0x09, 0x00, 0x90, 0xAF, 0x14, 0x10, 0xB4, 0x82, 0xFF, 0x07, 0x6E, 0x02,
+    0x10, 0xB5, 0xFF, 0x0D, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x81, 0xFF, 0x00, 0xAF, 0x97, 0x77, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF3, 0xC7, 0xFF, 0x02, 0x09,
+    0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80, 0xFF, 0x06, 0x09, 0x00, 0x90, 0xAF, 0x14,
+    0x10, 0xB4, 0x82, 0xFF, 0x07, 0x6E, 0x02, 0x10, 0xB5, 0xFF, 0x0D, 0x00, 0xF8, 0x88, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xAF, 0x97, 0x77, 0x00, 0x04, 0x80,
+    0x00, 0x00, 0xF3, 0xC7, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xC0, 0x80,
+    0xFF, 0x06, 0x09, 0x00, 0x90, 0xAF, 0x14, 0x10, 0xB4, 0x82, 0xFF, 0x07, 0x6E, 0x02, 0x10, 0xB5,
+    0xFF, 0x0D, 0x00, 0xF8, 0x88, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF,
+    0x00, 0x07, 0x99, 0x00, 0x01, 0x10, 0xFD, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x80, 0x98, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x07, 0x99, 0x00, 0x01, 0x10, 0xFD,
+    0xD2, 0xFF, 0x02, 0x09, 0x00, 0x80, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x81, 0xFF, 0x00, 0x07, 0x99, 0x00, 0x01, 0x10, 0xFD, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x80, 0x98,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x02, 0x99, 0x00, 0x00,
+    0xC1, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x00, 0x02, 0x99, 0x00, 0x00, 0xC1, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x02, 0x99, 0x00, 0x00,
+    0xC1, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x00, 0x05, 0x98, 0x00, 0x01, 0x50, 0xFE, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70,
+    0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x05, 0x98, 0x00,
+    0x01, 0x50, 0xFE, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x05, 0x98, 0x00, 0x01, 0x50, 0xFE, 0xD3, 0xFF, 0x02, 0x09,
+    0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x6E,
+    0x97, 0x33, 0x01, 0x85, 0xFD, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x6E, 0x97, 0x33, 0x01, 0x85, 0xFD, 0xD4, 0xFF,
+    0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF,
+    0x00, 0x6E, 0x97, 0x33, 0x01, 0x85, 0xFD, 0xD4, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xF3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xF3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xF3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x9A, 0xEE, 0xD3, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x9A, 0xEE, 0xD3,
+    0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82,
+    0xFF, 0x9A, 0xEE, 0xD3, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x1C, 0x9A, 0x00, 0x00, 0xA1, 0xD2, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x1C, 0x9A,
+    0x00, 0x00, 0xA1, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x1C, 0x9A, 0x00, 0x00, 0xA1, 0xD2, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A,
+    0x00, 0x00, 0x10, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A, 0x00, 0x00, 0x10, 0xD2, 0xFF, 0x02, 0x09, 0x00,
+    0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A,
+    0x00, 0x00, 0x10, 0xD2, 0xFF, 0x02, 0x09, 0x00, 0x70, 0x98, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A, 0x00, 0x00, 0x10, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A, 0x00, 0x00, 0x10, 0xEF, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x03, 0x9A, 0x00, 0x00, 0x10, 0xEF,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0B, 0x9A, 0x00, 0x00,
+    0x90, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0B, 0x9A,
+    0x00, 0x00, 0x90, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00,
+    0x0B, 0x9A, 0x00, 0x00, 0x90, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x00, 0xEF, 0x9A, 0xCC, 0x00, 0xFE, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x00, 0xEF, 0x9A, 0xCC, 0x00, 0xFE, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xEF, 0x9A, 0xCC, 0x00, 0xFE, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x7F, 0x9A, 0x55, 0x00,
+    0xE7, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x7F, 0x9A,
+    0x55, 0x00, 0xE7, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00,
+    0x7F, 0x9A, 0x55, 0x00, 0xE7, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x40, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x40, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x40, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x02, 0x9B, 0x00, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x02, 0x9B, 0x00, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x02, 0x9B, 0x00, 0xEF, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x40, 0xEF, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x40, 0xEF,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x06, 0x9A, 0x00, 0x00,
+    0x40, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x9F, 0x9A,
+    0x66, 0x00, 0xF8, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00,
+    0x9F, 0x9A, 0x66, 0x00, 0xF8, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x00, 0x9F, 0x9A, 0x66, 0x00, 0xF8, 0xEF, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00, 0x93, 0xF4, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00, 0x93, 0xF4,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00,
+    0x93, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xBF, 0x96,
+    0x00, 0x00, 0xF4, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00,
+    0xBF, 0x96, 0x00, 0x00, 0xF4, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x00, 0xBF, 0x96, 0x00, 0x00, 0xF4, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0xF3, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0xF3, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x33, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xFD, 0xF2, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x33, 0x00, 0x03, 0x80, 0x00, 0x00, 0xFD, 0xF2, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x33, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0xFD, 0xF2, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x80, 0x00, 0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xC9, 0xFF, 0x02, 0x02, 0x00,
+    0xC0, 0x83, 0xFF, 0x02, 0x03, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xC9, 0xFF, 0x02,
+    0x02, 0x00, 0xC0, 0x83, 0xFF, 0x02, 0x03, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xC9,
+    0xFF, 0x02, 0x02, 0x00, 0xC0, 0x83, 0xFF, 0x02, 0x03, 0x00, 0xB0, 0x9C, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x04, 0x0A, 0x00, 0xA4,
+    0xAA, 0xCA, 0xC7, 0xFF, 0x02, 0x07, 0x00, 0x70, 0x82, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xF1,
+    0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x20, 0x94,
+    0xFF, 0x04, 0x0A, 0x00, 0xA4, 0xAA, 0xCA, 0xC7, 0xFF, 0x02, 0x07, 0x00, 0x70, 0x82, 0xFF, 0x00,
+    0xEF, 0x80, 0x00, 0x00, 0xF1, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x04, 0x0A, 0x00, 0xA4, 0xAA, 0xCA, 0xC7, 0xFF, 0x02, 0x07,
+    0x00, 0x70, 0x82, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xF1, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x00,
+    0xF4, 0xC6, 0xFF, 0x02, 0x0D, 0x00, 0x20, 0x82, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x00, 0xF6, 0x9C,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF,
+    0x00, 0x0C, 0x82, 0x00, 0x00, 0xF4, 0xC6, 0xFF, 0x02, 0x0D, 0x00, 0x20, 0x82, 0xFF, 0x00, 0x9F,
+    0x80, 0x00, 0x00, 0xF6, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF,
+    0x01, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x00, 0xF4, 0xC6, 0xFF, 0x02, 0x0D, 0x00,
+    0x20, 0x82, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x00, 0xF6, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x8F, 0x88, 0x02, 0xFE,
+    0xFF, 0x0C, 0x82, 0x00, 0x00, 0x60, 0xC6, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x81, 0xFF,
+    0x00, 0x4F, 0x80, 0x00, 0x00, 0xFB, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x81, 0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x8F, 0x88, 0x02, 0xFE, 0xFF, 0x0C, 0x82,
+    0x00, 0x00, 0x60, 0xC6, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x81, 0xFF, 0x00, 0x4F, 0x80,
+    0x00, 0x00, 0xFB, 0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01,
+    0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x8F, 0x88, 0x02, 0xFE, 0xFF, 0x0C, 0x82, 0x00, 0x00, 0x60,
+    0xC6, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x81, 0xFF, 0x00, 0x4F, 0x80, 0x00, 0x00, 0xFB,
+    0x9C, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF,
+    0xAF, 0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00, 0xC6, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00,
+    0xF9, 0x81, 0xFF, 0x02, 0x0F, 0x00, 0x10, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF, 0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00,
+    0xC6, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xF9, 0x81, 0xFF, 0x02, 0x0F, 0x00, 0x10, 0x9D, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF, 0x90,
+    0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00, 0xC6, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xF9, 0x81,
+    0xFF, 0x02, 0x0F, 0x00, 0x10, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0x94, 0x99, 0x02,
+    0x00, 0xC6, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x02, 0x0B, 0x00, 0x60, 0x9D,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0x94, 0x99, 0x02, 0x00, 0xC6, 0xFF, 0x00, 0xDF, 0x80,
+    0x00, 0x00, 0xF4, 0x81, 0xFF, 0x02, 0x0B, 0x00, 0x60, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C,
+    0x00, 0x94, 0x99, 0x02, 0x00, 0xC6, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x02,
+    0x0B, 0x00, 0x60, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7,
+    0xFF, 0x02, 0x02, 0x00, 0xE0, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xB0, 0x9D, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0,
+    0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x02, 0x02, 0x00, 0xE0, 0x81, 0xFF, 0x02,
+    0x06, 0x00, 0xB0, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7,
+    0xFF, 0x02, 0x02, 0x00, 0xE0, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xB0, 0x9D, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0,
+    0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x02, 0x07, 0x00, 0xA0, 0x81, 0xFF, 0x02,
+    0x01, 0x00, 0xF1, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7,
+    0xFF, 0x02, 0x07, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0x01, 0x00, 0xF1, 0x9D, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0,
+    0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x02, 0x07, 0x00, 0xA0, 0x81, 0xFF, 0x02,
+    0x01, 0x00, 0xF1, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7,
+    0xFF, 0x02, 0x0D, 0x00, 0x50, 0x80, 0xFF, 0x00, 0xCF, 0x80, 0x00, 0x00, 0xF6, 0x9D, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00,
+    0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x02, 0x0D, 0x00, 0x50, 0x80,
+    0xFF, 0x00, 0xCF, 0x80, 0x00, 0x00, 0xF6, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7,
+    0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x02, 0x0D, 0x00, 0x50, 0x80, 0xFF, 0x00, 0xCF, 0x80, 0x00, 0x00,
+    0xF6, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00,
+    0x2F, 0x80, 0x00, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFB, 0x9D, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0,
+    0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x80, 0xFF, 0x00,
+    0x7F, 0x80, 0x00, 0x00, 0xFB, 0x9D, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04,
+    0x00, 0xC7, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFB, 0x9D,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0x7F, 0x80,
+    0x00, 0x04, 0xFB, 0xFF, 0x2F, 0x00, 0x10, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7,
+    0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x04, 0xFB, 0xFF, 0x2F, 0x00, 0x10, 0x9E,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0x7F, 0x80,
+    0x00, 0x04, 0xFB, 0xFF, 0x2F, 0x00, 0x10, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7,
+    0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x04, 0xF6, 0xFF, 0x0D, 0x00, 0x60, 0x9E,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0xDF, 0x80,
+    0x00, 0x04, 0xF6, 0xFF, 0x0D, 0x00, 0x60, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7,
+    0xFF, 0x04, 0x00, 0xC7, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x04, 0xF6, 0xFF, 0x0D, 0x00, 0x60, 0x9E,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x06, 0x02, 0x00,
+    0xF1, 0xFF, 0x08, 0x00, 0xB0, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04,
+    0x00, 0xC8, 0xFF, 0x06, 0x02, 0x00, 0xF1, 0xFF, 0x08, 0x00, 0xB0, 0x9E, 0xFF, 0x01, 0x7F, 0x00,
+    0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0,
+    0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x06, 0x02, 0x00, 0xF1, 0xFF, 0x08, 0x00,
+    0xB0, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x06,
+    0x07, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xF1, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7,
+    0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x06, 0x07, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0xF1, 0x9E, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00,
+    0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x06, 0x07, 0x00, 0xC0, 0xFF,
+    0x03, 0x00, 0xF1, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8,
+    0xFF, 0x03, 0x0D, 0x00, 0x70, 0xEF, 0x80, 0x00, 0x00, 0xF6, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF,
+    0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x03, 0x0D, 0x00, 0x70, 0xEF, 0x80, 0x00, 0x00,
+    0xF6, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30,
+    0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x03,
+    0x0D, 0x00, 0x70, 0xEF, 0x80, 0x00, 0x00, 0xF6, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00,
+    0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x03, 0x2F, 0x00, 0x30, 0xAF, 0x80, 0x00, 0x00, 0xFB, 0x9E,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0xC8, 0xFF, 0x03, 0x2F, 0x00,
+    0x30, 0xAF, 0x80, 0x00, 0x00, 0xFB, 0x9E, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF,
+    0x04, 0x00, 0xC8, 0xFF, 0x03, 0x2F, 0x00, 0x30, 0xAF, 0x80, 0x00, 0x00, 0xFB, 0x9E, 0xFF, 0x01,
+    0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00,
+    0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xA4, 0xAA, 0x02, 0x00, 0xC8, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x02,
+    0x6F, 0x00, 0x10, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03,
+    0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0xA4, 0xAA, 0x02, 0x00, 0xC8,
+    0xFF, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x6F, 0x00, 0x10, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x90, 0x00, 0x07, 0xF0, 0xFF, 0x0C,
+    0x00, 0xA4, 0xAA, 0x02, 0x00, 0xC8, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x02, 0x6F, 0x00, 0x10, 0x9F,
+    0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF,
+    0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00, 0xC8, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x02, 0x2B,
+    0x00, 0x60, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x03, 0x00,
+    0x30, 0xFF, 0xAF, 0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00, 0xC8, 0xFF, 0x00, 0xDF, 0x80,
+    0x00, 0x02, 0x2B, 0x00, 0x60, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x03, 0x00, 0x30, 0xFF, 0xAF, 0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x83, 0x00, 0xC8, 0xFF,
+    0x00, 0xDF, 0x80, 0x00, 0x02, 0x2B, 0x00, 0x60, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x7A, 0x8E, 0x77, 0x03, 0x87, 0xFE,
+    0xFF, 0x0C, 0x82, 0x00, 0x00, 0x60, 0xC9, 0xFF, 0x04, 0x02, 0x00, 0x06, 0x00, 0xB0, 0x9F, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF, 0x00,
+    0x7A, 0x8E, 0x77, 0x03, 0x87, 0xFE, 0xFF, 0x0C, 0x82, 0x00, 0x00, 0x60, 0xC9, 0xFF, 0x04, 0x02,
+    0x00, 0x06, 0x00, 0xB0, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF,
+    0x01, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x7A, 0x8E, 0x77, 0x03, 0x87, 0xFE, 0xFF, 0x0C, 0x82, 0x00,
+    0x00, 0x60, 0xC9, 0xFF, 0x04, 0x02, 0x00, 0x06, 0x00, 0xB0, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88,
+    0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x00,
+    0xF4, 0xC9, 0xFF, 0x04, 0x07, 0x00, 0x01, 0x00, 0xF1, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF,
+    0x01, 0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x00, 0xF4,
+    0xC9, 0xFF, 0x04, 0x07, 0x00, 0x01, 0x00, 0xF1, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x00, 0xF4, 0xC9,
+    0xFF, 0x04, 0x07, 0x00, 0x01, 0x00, 0xF1, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07,
+    0x70, 0x81, 0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x04, 0x0A, 0x00, 0x94, 0x99, 0xC9, 0xCA, 0xFF,
+    0x00, 0x0D, 0x81, 0x00, 0x00, 0xF6, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x81, 0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x04, 0x0A, 0x00, 0x94, 0x99, 0xC9, 0xCA, 0xFF, 0x00,
+    0x0D, 0x81, 0x00, 0x00, 0xF6, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81,
+    0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x04, 0x0A, 0x00, 0x94, 0x99, 0xC9, 0xCA, 0xFF, 0x00, 0x0D,
+    0x81, 0x00, 0x00, 0xF6, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF,
+    0x80, 0x00, 0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xCC, 0xFF, 0x00, 0x2F, 0x81, 0x00,
+    0x00, 0xFB, 0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x80, 0x00,
+    0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xCC, 0xFF, 0x00, 0x2F, 0x81, 0x00, 0x00, 0xFB,
+    0x9F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x80, 0x00, 0x00, 0xFB,
+    0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0xCC, 0xFF, 0x00, 0x2F, 0x81, 0x00, 0x00, 0xFB, 0x9F, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x44,
+    0x00, 0x13, 0x80, 0x00, 0x00, 0xFD, 0xCC, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x10, 0xA0, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x44,
+    0x00, 0x13, 0x80, 0x00, 0x00, 0xFD, 0xCC, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x10, 0xA0, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x44,
+    0x00, 0x13, 0x80, 0x00, 0x00, 0xFD, 0xCC, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x10, 0xA0, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50,
+    0xCD, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x60, 0xA0, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0xCD, 0xFF, 0x00, 0xDF, 0x80, 0x00,
+    0x00, 0x60, 0xA0, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0x0D,
+    0x96, 0x00, 0x00, 0x50, 0xCD, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x60, 0xA0, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xBF, 0x96, 0x00, 0x00, 0xF4, 0xF3, 0xFF,
+    0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xBF, 0x96, 0x00, 0x00, 0xF4,
+    0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x81, 0xFF, 0x00, 0xBF, 0x96, 0x00,
+    0x00, 0xF4, 0xF3, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF, 0x00, 0x5D,
+    0x94, 0x00, 0x00, 0x82, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0x82, 0xFF,
+    0x00, 0x5D, 0x94, 0x00, 0x00, 0x82, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70,
+    0x82, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00, 0x82, 0xF4, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F,
+    0x00, 0x88, 0xFF, 0x01, 0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01,
+    0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x7F, 0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x6F, 0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x6F,
+    0x00, 0x88, 0xFF, 0x01, 0x09, 0x60, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x6F, 0x00, 0x88, 0xFF, 0x01,
+    0x0A, 0x50, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x5F, 0x00, 0x88, 0xFF, 0x01, 0x0A, 0x50, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x5F, 0x00, 0x88, 0xFF, 0x01, 0x0A, 0x50, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x5F,
+    0x00, 0x88, 0xFF, 0x01, 0x0C, 0x30, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x3F, 0x00, 0x88, 0xFF, 0x01,
+    0x0C, 0x30, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x3F, 0x00, 0x88, 0xFF, 0x01, 0x0C, 0x30, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x01, 0x3F, 0x00, 0x88, 0xFF, 0x01, 0x0E, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x0F,
+    0x00, 0x88, 0xFF, 0x01, 0x0E, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x0F, 0x00, 0x88, 0xFF, 0x01,
+    0x0E, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0x01, 0x0F, 0x00, 0x88, 0xFF, 0x02, 0x1F, 0x00, 0xFD, 0xFF,
+    0xFF, 0x8E, 0xFF, 0x01, 0x0D, 0x10, 0x88, 0xFF, 0x02, 0x1F, 0x00, 0xFD, 0xFF, 0xFF, 0x8E, 0xFF,
+    0x01, 0x0D, 0x10, 0x88, 0xFF, 0x02, 0x1F, 0x00, 0xFD, 0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x0D, 0x10,
+    0x88, 0xFF, 0x02, 0x5F, 0x00, 0xF8, 0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x08, 0x50, 0x88, 0xFF, 0x02,
+    0x5F, 0x00, 0xF8, 0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x08, 0x50, 0x88, 0xFF, 0x02, 0x5F, 0x00, 0xF8,
+    0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x08, 0x50, 0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0xFF, 0xFF, 0x8E,
+    0xFF, 0x01, 0x03, 0x90, 0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x03,
+    0x90, 0x88, 0xFF, 0x02, 0x9F, 0x00, 0xF3, 0xFF, 0xFF, 0x8E, 0xFF, 0x01, 0x03, 0x90, 0x88, 0xFF,
+    0x02, 0xEF, 0x00, 0xD0, 0xFF, 0xFF, 0x8D, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x88, 0xFF, 0x02, 0xEF,
+    0x00, 0xD0, 0xFF, 0xFF, 0x8D, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x88, 0xFF, 0x02, 0xEF, 0x00, 0xD0,
+    0xFF, 0xFF, 0x8D, 0xFF, 0x02, 0xDF, 0x00, 0xE0, 0x89, 0xFF, 0x01, 0x04, 0x60, 0xFF, 0xFF, 0x8D,
+    0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x89, 0xFF, 0x01, 0x04, 0x60, 0xFF, 0xFF, 0x8D, 0xFF, 0x02, 0x6F,
+    0x00, 0xF4, 0x89, 0xFF, 0x01, 0x04, 0x60, 0xFF, 0xFF, 0x8D, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x89,
+    0xFF, 0x02, 0x0C, 0x00, 0xFD, 0xFF, 0xFF, 0x8C, 0xFF, 0x02, 0x0D, 0x00, 0xFB, 0x89, 0xFF, 0x02,
+    0x0C, 0x00, 0xFD, 0xFF, 0xFF, 0x8C, 0xFF, 0x02, 0x0D, 0x00, 0xFB, 0x89, 0xFF, 0x02, 0x0C, 0x00,
+    0xFD, 0xFF, 0xFF, 0x8C, 0xFF, 0x02, 0x0D, 0x00, 0xFB, 0x89, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0xFF,
+    0xFF, 0x8C, 0xFF, 0x01, 0x03, 0x40, 0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0xFF, 0xFF, 0x8C, 0xFF,
+    0x01, 0x03, 0x40, 0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xF3, 0xFF, 0xFF, 0x8C, 0xFF, 0x01, 0x03, 0x40,
+    0x8A, 0xFF, 0x02, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0x8B, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x8A, 0xFF,
+    0x02, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0x8B, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x8A, 0xFF, 0x02, 0xDF,
+    0x00, 0x50, 0xFF, 0xFF, 0x8B, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x8B, 0xFF, 0x02, 0x09, 0x00, 0xF5,
+    0xFF, 0xFF, 0x8A, 0xFF, 0x02, 0x05, 0x00, 0xF9, 0x8B, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0xFF, 0xFF,
+    0x8A, 0xFF, 0x02, 0x05, 0x00, 0xF9, 0x8B, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0xFF, 0xFF, 0x8A, 0xFF,
+    0x02, 0x05, 0x00, 0xF9, 0x8B, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x88, 0xFF, 0x02,
+    0x3D, 0x00, 0x60, 0x8C, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x88, 0xFF, 0x02, 0x3D,
+    0x00, 0x60, 0x8C, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x88, 0xFF, 0x02, 0x3D, 0x00,
+    0x60, 0x8D, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00,
+    0x00, 0xF6, 0x8D, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80,
+    0x00, 0x00, 0xF6, 0x8D, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D,
+    0x80, 0x00, 0x00, 0xF6, 0x8D, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83,
+    0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90, 0x8E, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0x30,
+    0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90, 0x8E, 0xFF, 0x00, 0x9F,
+    0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90,
+    0x8F, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x03, 0x30, 0x65, 0x77, 0x87, 0xFD, 0x88, 0x02, 0x78, 0x67,
+    0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x8F, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x03, 0x30, 0x65, 0x77,
+    0x87, 0xFD, 0x88, 0x02, 0x78, 0x67, 0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x8F, 0xFF, 0x00, 0x4D,
+    0x81, 0x00, 0x03, 0x30, 0x65, 0x77, 0x87, 0xFD, 0x88, 0x02, 0x78, 0x67, 0x35, 0x81, 0x00, 0x01,
+    0x40, 0xFD, 0x90, 0xFF, 0x00, 0x4B, 0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFC, 0x91, 0xFF, 0x00,
+    0x4B, 0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFC, 0x91, 0xFF, 0x00, 0x4B, 0xFF, 0x00, 0x87, 0x00,
+    0x01, 0x40, 0xFC, 0x92, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10, 0x95, 0xFE,
+    0x93, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10, 0x95, 0xFE, 0x93, 0xFF, 0x01,
+    0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10, 0x95, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF,
+};
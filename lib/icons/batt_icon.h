@@ -0,0 +1,34 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from batt_img.h
+// raw 1800, rle 406, mask 1138, pal2 900 bytes
+const uint8_t batt_icon_data[406] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00, 0x93, 0x83, 0xFF,
+    0x00, 0xBF, 0x96, 0x00, 0x00, 0xF4, 0x82, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0x82, 0xFF,
+    0x02, 0x05, 0x00, 0x20, 0x92, 0x33, 0x00, 0x03, 0x80, 0x00, 0x00, 0xFD, 0x81, 0xFF, 0x80, 0x00,
+    0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0x81, 0xFF, 0x01, 0x00, 0x20, 0x94, 0xFF, 0x07,
+    0x0A, 0x00, 0xA4, 0xAA, 0xCA, 0xFF, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x02, 0xF4,
+    0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x8F, 0x88, 0x02, 0xFE, 0xFF, 0x0C, 0x82, 0x00, 0x04, 0x60,
+    0x00, 0x30, 0xFF, 0xAF, 0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x84, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0x94, 0x99, 0x02, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x30, 0xFF, 0x8F,
+    0x90, 0x00, 0x06, 0xF0, 0xFF, 0x0C, 0x00, 0xA4, 0xAA, 0x02, 0x80, 0x00, 0x02, 0x30, 0xFF, 0xAF,
+    0x90, 0x00, 0x02, 0xF2, 0xFF, 0x0C, 0x84, 0x00, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x7A, 0x8E, 0x77,
+    0x03, 0x87, 0xFE, 0xFF, 0x0C, 0x82, 0x00, 0x02, 0x60, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0C, 0x82,
+    0x00, 0x02, 0xF4, 0x00, 0x20, 0x94, 0xFF, 0x05, 0x0A, 0x00, 0x94, 0x99, 0xC9, 0xFF, 0x80, 0x00,
+    0x00, 0xFB, 0x93, 0xFF, 0x02, 0x04, 0x00, 0xF8, 0x81, 0xFF, 0x02, 0x05, 0x00, 0x20, 0x92, 0x44,
+    0x00, 0x13, 0x80, 0x00, 0x00, 0xFD, 0x81, 0xFF, 0x00, 0x0D, 0x96, 0x00, 0x00, 0x50, 0x82, 0xFF,
+    0x00, 0xBF, 0x96, 0x00, 0x00, 0xF4, 0x83, 0xFF, 0x00, 0x5D, 0x94, 0x00, 0x00, 0x82, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF,
+};
+const Icon batt_icon = {60, 60, ICON_RLE, {0, 5, 10, 15}, batt_icon_data, 406};
@@ -0,0 +1,72 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from hum_img.h
+// raw 1800, rle 1022, mask 979, pal2 900 bytes
+const uint8_t hum_icon_data[1022] = {
+    0x8C, 0xFF, 0x01, 0x3D, 0xD3, 0x9A, 0xFF, 0x01, 0x03, 0x20, 0x99, 0xFF, 0x00, 0x8F, 0x80, 0x00,
+    0x00, 0xF8, 0x98, 0xFF, 0x00, 0x0D, 0x80, 0x00, 0x00, 0xD0, 0x98, 0xFF, 0x00, 0x03, 0x80, 0x00,
+    0x00, 0x30, 0x97, 0xFF, 0x05, 0x8F, 0x00, 0x20, 0x02, 0x00, 0xF8, 0x96, 0xFF, 0x05, 0x0C, 0x00,
+    0xC0, 0x0C, 0x00, 0xC0, 0x96, 0xFF, 0x05, 0x02, 0x00, 0xF8, 0x8F, 0x00, 0x20, 0x95, 0xFF, 0x02,
+    0x5F, 0x00, 0x30, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xF5, 0x94, 0xFF, 0x02, 0x09, 0x00, 0xE0, 0x80,
+    0xFF, 0x02, 0x1E, 0x00, 0x90, 0x93, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFB, 0x80, 0xFF, 0x00,
+    0xBF, 0x80, 0x00, 0x00, 0xFC, 0x92, 0xFF, 0x02, 0x2E, 0x00, 0x70, 0x82, 0xFF, 0x02, 0x07, 0x00,
+    0xE2, 0x92, 0xFF, 0x02, 0x04, 0x00, 0xF3, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0x40, 0x91, 0xFF, 0x03,
+    0x7F, 0x00, 0x10, 0xFE, 0x82, 0xFF, 0x03, 0xEF, 0x01, 0x00, 0xF7, 0x90, 0xFF, 0x02, 0x0B, 0x00,
+    0xC0, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xB0, 0x8F, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xF9, 0x84, 0xFF,
+    0x03, 0x8F, 0x00, 0x10, 0xFD, 0x8E, 0xFF, 0x02, 0x3F, 0x00, 0x50, 0x86, 0xFF, 0x02, 0x05, 0x00,
+    0xF3, 0x8E, 0xFF, 0x02, 0x06, 0x00, 0xE2, 0x86, 0xFF, 0x02, 0x3E, 0x00, 0x60, 0x8D, 0xFF, 0x00,
+    0xAF, 0x80, 0x00, 0x00, 0xFD, 0x86, 0xFF, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xFA, 0x8C, 0xFF, 0x02,
+    0x0D, 0x00, 0xA0, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xD0, 0x8C, 0xFF, 0x02, 0x04, 0x00, 0xF6, 0x88,
+    0xFF, 0x02, 0x6F, 0x00, 0x30, 0x8B, 0xFF, 0x02, 0x7F, 0x00, 0x20, 0x8A, 0xFF, 0x02, 0x02, 0x00,
+    0xF7, 0x8A, 0xFF, 0x02, 0x0C, 0x00, 0xC0, 0x80, 0xFF, 0x01, 0xBE, 0xB9, 0x86, 0xFF, 0x02, 0x0C,
+    0x00, 0xD0, 0x8A, 0xFF, 0x04, 0x03, 0x00, 0xF9, 0xFF, 0x6E, 0x80, 0x00, 0x00, 0x80, 0x85, 0xFF,
+    0x02, 0x9F, 0x00, 0x30, 0x89, 0xFF, 0x02, 0xAF, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x03, 0x81, 0x00,
+    0x00, 0xF7, 0x85, 0xFF, 0x02, 0x04, 0x00, 0xF9, 0x88, 0xFF, 0x04, 0x1F, 0x00, 0xC0, 0xFF, 0x8F,
+    0x82, 0x00, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF1, 0x88, 0xFF, 0x09, 0x08, 0x00, 0xF6,
+    0xFF, 0x1F, 0x00, 0x90, 0x6B, 0x00, 0x50, 0x82, 0xFF, 0x05, 0x6A, 0xFC, 0xFF, 0x6F, 0x00, 0x80,
+    0x88, 0xFF, 0x09, 0x01, 0x10, 0xFE, 0xFF, 0x0E, 0x00, 0xF7, 0xFF, 0x03, 0x20, 0x81, 0xFF, 0x06,
+    0x8F, 0x00, 0xF0, 0xFF, 0xEF, 0x01, 0x10, 0x87, 0xFF, 0x02, 0x8F, 0x00, 0x70, 0x80, 0xFF, 0x05,
+    0x0D, 0x00, 0xF7, 0xFF, 0x04, 0x10, 0x81, 0xFF, 0x02, 0x08, 0x00, 0xE0, 0x80, 0xFF, 0x02, 0x07,
+    0x00, 0xF8, 0x86, 0xFF, 0x02, 0x3F, 0x00, 0xE0, 0x80, 0xFF, 0x05, 0x0F, 0x00, 0xD1, 0xBF, 0x00,
+    0x40, 0x80, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0xF3, 0x86,
+    0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0x90, 0x80, 0xFF, 0x02,
+    0x08, 0x00, 0x80, 0x81, 0xFF, 0x02, 0x6F, 0x00, 0xC0, 0x86, 0xFF, 0x02, 0x07, 0x00, 0xFB, 0x80,
+    0xFF, 0x01, 0xEF, 0x01, 0x81, 0x00, 0x02, 0xF4, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x81, 0xFF,
+    0x02, 0xBF, 0x00, 0x70, 0x86, 0xFF, 0x01, 0x03, 0x10, 0x82, 0xFF, 0x00, 0x3C, 0x80, 0x00, 0x05,
+    0x50, 0xFE, 0xFF, 0x08, 0x00, 0x80, 0x83, 0xFF, 0x01, 0x01, 0x30, 0x86, 0xFF, 0x01, 0x00, 0x50,
+    0x83, 0xFF, 0x04, 0x7A, 0x74, 0xFC, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x83, 0xFF, 0x01, 0x05,
+    0x00, 0x85, 0xFF, 0x02, 0xCF, 0x00, 0x80, 0x87, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x84, 0xFF, 0x02,
+    0x08, 0x00, 0xFC, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0xB0, 0x86, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00,
+    0xF8, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0xFB, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0xB0, 0x86, 0xFF, 0x02,
+    0x08, 0x00, 0x80, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0x84, 0xFF, 0x02, 0x8F, 0x00, 0xB0, 0x85,
+    0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x85, 0xFF, 0x02, 0x0C, 0x00, 0xF7, 0x84, 0xFF, 0x02,
+    0xAF, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0x84,
+    0xFF, 0x02, 0xBF, 0x00, 0xB0, 0x84, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xF8, 0x86, 0xFF, 0x02,
+    0x0C, 0x00, 0xFB, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x90, 0x84, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x87,
+    0xFF, 0x02, 0x09, 0x00, 0xFC, 0x85, 0xFF, 0x01, 0x00, 0x60, 0x83, 0xFF, 0x00, 0x8F, 0x80, 0x00,
+    0x04, 0xF8, 0xFF, 0xCF, 0x57, 0xA7, 0x83, 0xFF, 0x01, 0x06, 0x00, 0x86, 0xFF, 0x01, 0x02, 0x20,
+    0x83, 0xFF, 0x05, 0x08, 0x00, 0x80, 0xFF, 0xEF, 0x05, 0x80, 0x00, 0x00, 0xC3, 0x82, 0xFF, 0x01,
+    0x02, 0x20, 0x86, 0xFF, 0x02, 0x06, 0x00, 0xFE, 0x81, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x02, 0xF8,
+    0xFF, 0x4F, 0x81, 0x00, 0x01, 0x10, 0xFE, 0x80, 0xFF, 0x02, 0xEF, 0x00, 0x60, 0x86, 0xFF, 0x02,
+    0x0B, 0x00, 0xF7, 0x81, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00,
+    0xF5, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0xB0, 0x86, 0xFF, 0x02, 0x1F, 0x00, 0xF2, 0x80, 0xFF, 0x00,
+    0x8F, 0x80, 0x00, 0x00, 0xF8, 0x80, 0xFF, 0x05, 0x04, 0x00, 0xFA, 0x1D, 0x00, 0xF1, 0x80, 0xFF,
+    0x02, 0x2F, 0x00, 0xF1, 0x86, 0xFF, 0x02, 0x7F, 0x00, 0x90, 0x80, 0xFF, 0x02, 0x0E, 0x00, 0x80,
+    0x81, 0xFF, 0x05, 0x01, 0x40, 0xFF, 0x8F, 0x00, 0xD0, 0x80, 0xFF, 0x02, 0x09, 0x00, 0xF7, 0x86,
+    0xFF, 0x07, 0xEF, 0x00, 0x10, 0xFE, 0xFF, 0x0F, 0x00, 0xF8, 0x81, 0xFF, 0x0A, 0x02, 0x30, 0xFF,
+    0x7F, 0x00, 0xE0, 0xFF, 0xEF, 0x01, 0x00, 0xFE, 0x87, 0xFF, 0x05, 0x07, 0x00, 0xF4, 0xFF, 0xCF,
+    0x95, 0x82, 0xFF, 0x09, 0x05, 0x00, 0xC7, 0x09, 0x00, 0xF1, 0xFF, 0x5F, 0x00, 0x70, 0x88, 0xFF,
+    0x02, 0x1F, 0x00, 0x80, 0x85, 0xFF, 0x00, 0x0C, 0x82, 0x00, 0x04, 0xF7, 0xFF, 0x08, 0x00, 0xF1,
+    0x88, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xF9, 0x84, 0xFF, 0x00, 0x7F, 0x81, 0x00, 0x02, 0x30,
+    0xFF, 0x9F, 0x80, 0x00, 0x00, 0xFB, 0x89, 0xFF, 0x02, 0x07, 0x00, 0x90, 0x85, 0xFF, 0x00, 0x08,
+    0x80, 0x00, 0x04, 0xE6, 0xFF, 0x09, 0x00, 0x70, 0x8A, 0xFF, 0x00, 0x5F, 0x80, 0x00, 0x00, 0xF6,
+    0x85, 0xFF, 0x03, 0x8B, 0xEB, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0xF5, 0x8B, 0xFF, 0x03, 0x04, 0x00,
+    0x30, 0xFB, 0x86, 0xFF, 0x03, 0xBF, 0x03, 0x00, 0x40, 0x8C, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x01,
+    0x50, 0xFC, 0x84, 0xFF, 0x01, 0xCF, 0x05, 0x80, 0x00, 0x00, 0xF7, 0x8D, 0xFF, 0x00, 0x09, 0x80,
+    0x00, 0x01, 0x30, 0xC8, 0x82, 0xFF, 0x01, 0x8C, 0x03, 0x80, 0x00, 0x00, 0x90, 0x8E, 0xFF, 0x01,
+    0xDF, 0x04, 0x81, 0x00, 0x00, 0x30, 0x80, 0x44, 0x00, 0x03, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x8F,
+    0xFF, 0x01, 0xAF, 0x03, 0x86, 0x00, 0x01, 0x20, 0xFA, 0x91, 0xFF, 0x01, 0xCF, 0x15, 0x84, 0x00,
+    0x01, 0x51, 0xFC, 0x94, 0xFF, 0x05, 0x8C, 0x35, 0x03, 0x30, 0x53, 0xC8, 0x8A, 0xFF,
+};
+const Icon hum_icon = {60, 60, ICON_RLE, {0, 5, 10, 15}, hum_icon_data, 1022};
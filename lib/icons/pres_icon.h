@@ -0,0 +1,39 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from pres_img.h
+// raw 1800, rle 492, mask 1160, pal2 900 bytes
+const uint8_t pres_icon_data[492] = {
+    0xAB, 0xFF, 0x00, 0xFE, 0x9A, 0xFF, 0x01, 0x09, 0x70, 0x9A, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x98,
+    0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFC, 0x96, 0xFF, 0x02, 0x48, 0x44, 0x34, 0x80, 0x00, 0x02,
+    0x43, 0x44, 0x74, 0x93, 0xFF, 0x00, 0x9F, 0x86, 0x00, 0x00, 0xF7, 0x92, 0xFF, 0x00, 0x6F, 0x86,
+    0x00, 0x00, 0xF4, 0x92, 0xFF, 0x00, 0xBF, 0x86, 0x00, 0x00, 0xF9, 0x93, 0xFF, 0x00, 0x06, 0x84,
+    0x00, 0x00, 0x40, 0x94, 0xFF, 0x00, 0x2F, 0x84, 0x00, 0x00, 0xE1, 0x94, 0xFF, 0x00, 0xCF, 0x84,
+    0x00, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0xDF, 0xBB, 0xFD, 0x8D, 0xFF, 0x00, 0x08, 0x82, 0x00, 0x00,
+    0x60, 0x83, 0xFF, 0x04, 0x7E, 0x01, 0x00, 0x20, 0xF8, 0x8C, 0xFF, 0x00, 0x4F, 0x82, 0x00, 0x00,
+    0xF2, 0x82, 0xFF, 0x01, 0xAF, 0x01, 0x81, 0x00, 0x01, 0x20, 0xFC, 0x8B, 0xFF, 0x01, 0xEF, 0x01,
+    0x81, 0x00, 0x00, 0xFC, 0x82, 0xFF, 0x00, 0x09, 0x83, 0x00, 0x00, 0xC0, 0x8C, 0xFF, 0x00, 0x0B,
+    0x80, 0x00, 0x00, 0x80, 0x82, 0xFF, 0x00, 0xBF, 0x84, 0x00, 0x01, 0x10, 0xFE, 0x8B, 0xFF, 0x00,
+    0x6F, 0x80, 0x00, 0x00, 0xF4, 0x82, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xB3, 0xFF, 0x2A, 0x80,
+    0x00, 0x00, 0xF5, 0x8C, 0xFF, 0x02, 0x02, 0x10, 0xFE, 0x82, 0xFF, 0x02, 0x0A, 0x00, 0x60, 0x80,
+    0xFF, 0x03, 0xEF, 0x03, 0x00, 0xD0, 0x8C, 0xFF, 0x01, 0x6E, 0xD6, 0x83, 0xFF, 0x02, 0x09, 0x00,
+    0xF2, 0x81, 0xFF, 0x02, 0x0D, 0x00, 0x80, 0x93, 0xFF, 0x02, 0x3E, 0x00, 0xFB, 0x81, 0xFF, 0x02,
+    0x4F, 0x00, 0x50, 0x94, 0xFF, 0x00, 0xEC, 0x82, 0xFF, 0x02, 0x7F, 0x00, 0x30, 0x99, 0xFF, 0x02,
+    0x7F, 0x00, 0x30, 0x99, 0xFF, 0x02, 0x1E, 0x00, 0x50, 0x98, 0xFF, 0x04, 0xDF, 0x02, 0x00, 0xA0,
+    0xAF, 0x97, 0x77, 0x00, 0x04, 0x80, 0x00, 0x01, 0xF3, 0x07, 0x99, 0x00, 0x02, 0x10, 0xFD, 0x02,
+    0x99, 0x00, 0x02, 0xC1, 0xFF, 0x05, 0x98, 0x00, 0x03, 0x50, 0xFE, 0xFF, 0x6E, 0x97, 0x33, 0x01,
+    0x85, 0xFD, 0x9F, 0xFF, 0x9A, 0xEE, 0x01, 0xFF, 0x1C, 0x9A, 0x00, 0x01, 0xA1, 0x03, 0x9A, 0x00,
+    0x01, 0x10, 0x03, 0x9A, 0x00, 0x01, 0x10, 0x0B, 0x9A, 0x00, 0x01, 0x90, 0xEF, 0x9A, 0xCC, 0x00,
+    0xFE, 0x9C, 0xFF, 0x00, 0x7F, 0x9A, 0x55, 0x01, 0xE7, 0x06, 0x9A, 0x00, 0x01, 0x40, 0x02, 0x9B,
+    0x00, 0x00, 0x06, 0x9A, 0x00, 0x01, 0x40, 0x9F, 0x9A, 0x66, 0x00, 0xF8,
+};
+const Icon pres_icon = {60, 60, ICON_RLE, {0, 5, 10, 15}, pres_icon_data, 492};
@@ -0,0 +1,214 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from r_rect_img.h
+// raw 52500, rle 3286, mask 15387, pal2 26250 bytes
+const uint8_t r_rect_icon_data[3286] = {
+    0x84, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00, 0x02, 0x10, 0x95, 0xFE, 0x88, 0xFF, 0x00,
+    0x4C, 0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFB, 0x86, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x01, 0x30,
+    0x65, 0xFF, 0x77, 0x02, 0x77, 0x67, 0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x84, 0xFF, 0x00, 0x9F,
+    0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01, 0xDF, 0x38, 0x80, 0x00, 0x00, 0x90,
+    0x84, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00, 0x00,
+    0xF6, 0x82, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x88, 0xFF, 0x02, 0x3D, 0x00, 0x60,
+    0x82, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0xFF, 0xFF, 0x8A, 0xFF, 0x02, 0x05, 0x00, 0xF9, 0x80, 0xFF,
+    0x02, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0x8B, 0xFF, 0x02, 0x5F, 0x00, 0xD0, 0x80, 0xFF, 0x02, 0x4F,
+    0x00, 0xF3, 0xFF, 0xFF, 0x8C, 0xFF, 0x01, 0x03, 0x40, 0x80, 0xFF, 0x02, 0x0B, 0x00, 0xFD, 0xFF,
+    0xFF, 0x8C, 0xFF, 0x05, 0x0D, 0x00, 0xFC, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0x8D, 0xFF, 0x05, 0x6F,
+    0x00, 0xF4, 0xEF, 0x00, 0xD0, 0xFF, 0xFF, 0x8D, 0xFF, 0x05, 0xDF, 0x00, 0xE0, 0x9F, 0x00, 0xF3,
+    0xFF, 0xFF, 0x8E, 0xFF, 0x04, 0x03, 0x90, 0x5F, 0x00, 0xF8, 0xFF, 0xFF, 0x8E, 0xFF, 0x04, 0x08,
+    0x50, 0x1F, 0x00, 0xFD, 0xFF, 0xFF, 0x8E, 0xFF, 0x03, 0x0D, 0x10, 0x0E, 0x00, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x0F, 0x00, 0x0C, 0x30, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x3F, 0x00, 0x0A, 0x50, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x5F, 0x00, 0x09, 0x60, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x6F, 0x00, 0x08,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00,
+    0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F,
+    0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF,
+    0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07,
+    0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F,
+    0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF,
+    0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x07, 0x70, 0xFF, 0xFF,
+    0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x08, 0x70, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x08, 0x70,
+    0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, 0x09, 0x60, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x6F, 0x00,
+    0x0A, 0x50, 0xFF, 0xFF, 0x8F, 0xFF, 0x03, 0x5F, 0x00, 0x0C, 0x30, 0xFF, 0xFF, 0x8F, 0xFF, 0x03,
+    0x3F, 0x00, 0x0E, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0x04, 0x0F, 0x00, 0x1F, 0x00, 0xFD, 0xFF, 0xFF,
+    0x8E, 0xFF, 0x04, 0x0D, 0x10, 0x5F, 0x00, 0xF8, 0xFF, 0xFF, 0x8E, 0xFF, 0x04, 0x08, 0x50, 0x9F,
+    0x00, 0xF3, 0xFF, 0xFF, 0x8E, 0xFF, 0x04, 0x03, 0x90, 0xEF, 0x00, 0xD0, 0xFF, 0xFF, 0x8D, 0xFF,
+    0x05, 0xDF, 0x00, 0xE0, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0x8D, 0xFF, 0x06, 0x6F, 0x00, 0xF4, 0xFF,
+    0x0C, 0x00, 0xFD, 0xFF, 0xFF, 0x8C, 0xFF, 0x06, 0x0D, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0xF3, 0xFF,
+    0xFF, 0x8C, 0xFF, 0x01, 0x03, 0x40, 0x80, 0xFF, 0x02, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0x8B, 0xFF,
+    0x02, 0x5F, 0x00, 0xD0, 0x81, 0xFF, 0x02, 0x09, 0x00, 0xF5, 0xFF, 0xFF, 0x8A, 0xFF, 0x02, 0x05,
+    0x00, 0xF9, 0x81, 0xFF, 0x03, 0x6F, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x88, 0xFF, 0x02, 0x3D, 0x00,
+    0x60, 0x83, 0xFF, 0x03, 0x06, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0x86, 0xFF, 0x00, 0x6D, 0x80, 0x00,
+    0x00, 0xF6, 0x83, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0x30, 0xD8, 0xFF, 0xFF, 0x83, 0xFF, 0x01,
+    0xDF, 0x38, 0x80, 0x00, 0x00, 0x90, 0x85, 0xFF, 0x00, 0x4D, 0x81, 0x00, 0x03, 0x30, 0x65, 0x77,
+    0x87, 0xFD, 0x88, 0x02, 0x78, 0x67, 0x35, 0x81, 0x00, 0x01, 0x40, 0xFD, 0x86, 0xFF, 0x00, 0x4B,
+    0xFF, 0x00, 0x87, 0x00, 0x01, 0x40, 0xFC, 0x88, 0xFF, 0x01, 0x9E, 0x15, 0xFF, 0x00, 0x83, 0x00,
+    0x02, 0x10, 0x95, 0xFE, 0x83, 0xFF,
+};
+const Icon r_rect_icon = {300, 350, ICON_RLE, {0, 5, 10, 15}, r_rect_icon_data, 3286};
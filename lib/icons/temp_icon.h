@@ -0,0 +1,64 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from temp_img.h
+// raw 1800, rle 893, mask 1097, pal2 900 bytes
+const uint8_t temp_icon_data[893] = {
+    0x89, 0xFF, 0x03, 0x9F, 0x14, 0x21, 0xC5, 0x97, 0xFF, 0x01, 0xBF, 0x01, 0x81, 0x00, 0x00, 0xF5,
+    0x96, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x30, 0x95, 0xFF, 0x00, 0xDF, 0x81, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0xF6, 0x94, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x04, 0xF9, 0xDF, 0x04, 0x00, 0xD0,
+    0x94, 0xFF, 0x02, 0x0F, 0x00, 0xB0, 0x80, 0xFF, 0x02, 0x4F, 0x00, 0x70, 0x80, 0xFF, 0x00, 0xAD,
+    0x81, 0xAA, 0x00, 0xCA, 0x8D, 0xFF, 0x02, 0x0C, 0x00, 0xF3, 0x80, 0xFF, 0x04, 0xCF, 0x00, 0x40,
+    0xFF, 0xBF, 0x83, 0x00, 0x00, 0xF9, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF5, 0x80, 0xFF, 0x04, 0xEF,
+    0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF,
+    0x03, 0x00, 0x30, 0xFF, 0xAF, 0x83, 0x00, 0x00, 0xF7, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81,
+    0xFF, 0x01, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x8A, 0x81, 0x77, 0x00, 0x97, 0x8D, 0xFF, 0x02, 0x0C,
+    0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01,
+    0x00, 0x30, 0x94, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x02,
+    0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF, 0x25, 0x81, 0x22, 0x01, 0x42, 0xFD,
+    0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x8F, 0x83, 0x00, 0x00,
+    0xF5, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x03, 0x00, 0x30, 0xFF, 0x7F, 0x83, 0x00,
+    0x00, 0xF4, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0xEF, 0x03,
+    0x81, 0x00, 0x01, 0x10, 0xFC, 0x8C, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30,
+    0x94, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x02, 0x0C, 0x00,
+    0xF6, 0x81, 0xFF, 0x01, 0x00, 0x30, 0x94, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0xCF, 0xEA, 0xFF, 0x00,
+    0x30, 0x80, 0xFF, 0x00, 0xAC, 0x81, 0xAA, 0x00, 0xBA, 0x8D, 0xFF, 0x09, 0x0C, 0x00, 0xF6, 0x0A,
+    0x20, 0xFF, 0x00, 0x30, 0xFF, 0xBF, 0x83, 0x00, 0x00, 0xF9, 0x8C, 0xFF, 0x09, 0x0C, 0x00, 0xF6,
+    0x06, 0x00, 0xFC, 0x00, 0x30, 0xFF, 0x6F, 0x83, 0x00, 0x00, 0xF3, 0x8C, 0xFF, 0x09, 0x0C, 0x00,
+    0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0xFF, 0xAF, 0x83, 0x00, 0x00, 0xF8, 0x8C, 0xFF, 0x07, 0x0C,
+    0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x8B, 0x81, 0x77, 0x00, 0xA7, 0x8D,
+    0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x94, 0xFF, 0x07, 0x0C, 0x00, 0xF6,
+    0x06, 0x00, 0xFB, 0x00, 0x30, 0x94, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30,
+    0x94, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF, 0x23,
+    0x80, 0x22, 0x01, 0x32, 0xFD, 0x8C, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30,
+    0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0xF5, 0x8C, 0xFF, 0x07, 0x0C, 0x00, 0xF6, 0x06, 0x00,
+    0xFB, 0x00, 0x30, 0x80, 0xFF, 0x00, 0x5F, 0x82, 0x00, 0x00, 0xF5, 0x8C, 0xFF, 0x07, 0x0C, 0x00,
+    0xF6, 0x06, 0x00, 0xFB, 0x00, 0x30, 0x80, 0xFF, 0x01, 0xDF, 0x13, 0x80, 0x11, 0x01, 0x31, 0xFD,
+    0x8B, 0xFF, 0x06, 0xBF, 0x02, 0x00, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x00, 0xF6, 0x92, 0xFF,
+    0x00, 0x08, 0x80, 0x00, 0x03, 0xF6, 0x06, 0x00, 0xFB, 0x80, 0x00, 0x01, 0x20, 0xFD, 0x90, 0xFF,
+    0x00, 0x7F, 0x80, 0x00, 0x05, 0x10, 0xFA, 0x06, 0x00, 0xFB, 0x05, 0x80, 0x00, 0x00, 0xD1, 0x90,
+    0xFF, 0x00, 0x09, 0x80, 0x00, 0x09, 0xF8, 0xEF, 0x04, 0x00, 0xF9, 0xDF, 0x04, 0x00, 0x20, 0xFE,
+    0x8E, 0xFF, 0x00, 0xCF, 0x80, 0x00, 0x02, 0xD2, 0xCF, 0x04, 0x80, 0x00, 0x02, 0x10, 0xF8, 0x7F,
+    0x80, 0x00, 0x00, 0xF5, 0x8E, 0xFF, 0x04, 0x3F, 0x00, 0x10, 0xFD, 0x08, 0x82, 0x00, 0x04, 0x20,
+    0xFD, 0x08, 0x00, 0xB0, 0x8E, 0xFF, 0x03, 0x0A, 0x00, 0xC0, 0x6F, 0x84, 0x00, 0x03, 0xC0, 0x5F,
+    0x00, 0x20, 0x8E, 0xFF, 0x03, 0x04, 0x00, 0xF7, 0x09, 0x84, 0x00, 0x01, 0x10, 0xEE, 0x80, 0x00,
+    0x00, 0xFB, 0x8C, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xEE, 0x86, 0x00, 0x03, 0xF6, 0x07, 0x00,
+    0xF6, 0x8C, 0xFF, 0x03, 0xAF, 0x00, 0x40, 0x7F, 0x86, 0x00, 0x03, 0xE0, 0x0D, 0x00, 0xF1, 0x8C,
+    0xFF, 0x03, 0x6F, 0x00, 0x90, 0x2F, 0x86, 0x00, 0x03, 0xA0, 0x2F, 0x00, 0xE0, 0x8C, 0xFF, 0x03,
+    0x5F, 0x00, 0xC0, 0x0F, 0x86, 0x00, 0x03, 0x60, 0x5F, 0x00, 0xC0, 0x8C, 0xFF, 0x03, 0x4F, 0x00,
+    0xD0, 0x0D, 0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0, 0x8C, 0xFF, 0x03, 0x4F, 0x00, 0xD0, 0x0D,
+    0x86, 0x00, 0x03, 0x50, 0x6F, 0x00, 0xB0, 0x8C, 0xFF, 0x03, 0x5F, 0x00, 0xC0, 0x0F, 0x86, 0x00,
+    0x03, 0x60, 0x4F, 0x00, 0xC0, 0x8C, 0xFF, 0x03, 0x7F, 0x00, 0x90, 0x3F, 0x86, 0x00, 0x03, 0xA0,
+    0x1F, 0x00, 0xE0, 0x8C, 0xFF, 0x03, 0xAF, 0x00, 0x40, 0x8F, 0x86, 0x00, 0x03, 0xF1, 0x0D, 0x00,
+    0xF2, 0x8C, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x01, 0xEE, 0x01, 0x85, 0x00, 0x03, 0xF7, 0x06, 0x00,
+    0xF6, 0x8D, 0xFF, 0x03, 0x04, 0x00, 0xF5, 0x0A, 0x84, 0x00, 0x01, 0x20, 0xDF, 0x80, 0x00, 0x00,
+    0xFC, 0x8D, 0xFF, 0x03, 0x0B, 0x00, 0xB0, 0x7F, 0x84, 0x00, 0x03, 0xD1, 0x4F, 0x00, 0x30, 0x8E,
+    0xFF, 0x04, 0x4F, 0x00, 0x10, 0xFC, 0x09, 0x82, 0x00, 0x04, 0x30, 0xFE, 0x06, 0x00, 0xB0, 0x8E,
+    0xFF, 0x00, 0xDF, 0x80, 0x00, 0x02, 0xB1, 0xEF, 0x16, 0x80, 0x00, 0x02, 0x30, 0xFA, 0x6F, 0x80,
+    0x00, 0x00, 0xF5, 0x8F, 0xFF, 0x00, 0x0A, 0x80, 0x00, 0x08, 0xE7, 0xFF, 0xAC, 0xB9, 0xFE, 0xBF,
+    0x02, 0x00, 0x20, 0x90, 0xFF, 0x00, 0x9F, 0x81, 0x00, 0x04, 0xB6, 0xFE, 0xFF, 0x9D, 0x03, 0x80,
+    0x00, 0x00, 0xE2, 0x91, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x30, 0xFE,
+    0x91, 0xFF, 0x01, 0xCF, 0x03, 0x85, 0x00, 0x00, 0xF7, 0x93, 0xFF, 0x01, 0x9F, 0x02, 0x83, 0x00,
+    0x00, 0xD5, 0x95, 0xFF, 0x05, 0xDF, 0x48, 0x12, 0x11, 0x63, 0xFA, 0x8C, 0xFF,
+};
+const Icon temp_icon = {60, 60, ICON_RLE, {0, 5, 10, 15}, temp_icon_data, 893};
@@ -0,0 +1,68 @@
+#pragma once
+#include "icon.h"
+
+// Generated by tools/icon_convert.py from time_img.h
+// raw 1800, rle 945, mask 916, pal2 900 bytes
+const uint8_t time_icon_data[945] = {
+    0x89, 0xFF, 0x02, 0xAD, 0x46, 0x02, 0x80, 0x00, 0x02, 0x20, 0x64, 0xDA, 0x92, 0xFF, 0x01, 0xDF,
+    0x27, 0x86, 0x00, 0x01, 0x72, 0xFC, 0x8F, 0xFF, 0x01, 0xAF, 0x03, 0x81, 0x00, 0x00, 0x31, 0x80,
+    0x44, 0x00, 0x13, 0x81, 0x00, 0x01, 0x30, 0xFA, 0x8D, 0xFF, 0x01, 0xAF, 0x02, 0x80, 0x00, 0x01,
+    0x84, 0xEC, 0x82, 0xFF, 0x01, 0xCE, 0x48, 0x80, 0x00, 0x01, 0x20, 0xFA, 0x8B, 0xFF, 0x04, 0xDF,
+    0x03, 0x00, 0x30, 0xE9, 0x86, 0xFF, 0x04, 0x9E, 0x03, 0x00, 0x30, 0xFD, 0x8A, 0xFF, 0x03, 0x08,
+    0x00, 0x40, 0xFC, 0x88, 0xFF, 0x03, 0xCF, 0x04, 0x00, 0x80, 0x89, 0xFF, 0x03, 0x4E, 0x00, 0x20,
+    0xFB, 0x83, 0xFF, 0x01, 0x9F, 0xF9, 0x83, 0xFF, 0x03, 0xBF, 0x02, 0x00, 0xE4, 0x87, 0xFF, 0x03,
+    0xEF, 0x02, 0x00, 0xF7, 0x84, 0xFF, 0x01, 0x0B, 0xB0, 0x84, 0xFF, 0x03, 0x7F, 0x00, 0x20, 0xFE,
+    0x86, 0xFF, 0x02, 0x2E, 0x00, 0xB1, 0x85, 0xFF, 0x01, 0x0A, 0xA0, 0x85, 0xFF, 0x02, 0x1C, 0x00,
+    0xE2, 0x85, 0xFF, 0x03, 0xEF, 0x02, 0x20, 0xFD, 0x85, 0xFF, 0x01, 0x4F, 0xE4, 0x85, 0xFF, 0x03,
+    0xDF, 0x02, 0x20, 0xFE, 0x84, 0xFF, 0x02, 0x2E, 0x00, 0xE2, 0x90, 0xFF, 0x02, 0x2E, 0x00, 0xE2,
+    0x84, 0xFF, 0x02, 0x04, 0x20, 0xFE, 0x90, 0xFF, 0x02, 0xEF, 0x02, 0x40, 0x83, 0xFF, 0x02, 0x8F,
+    0x00, 0xD1, 0x92, 0xFF, 0x02, 0x1D, 0x00, 0xF8, 0x82, 0xFF, 0x05, 0x0D, 0x00, 0xFB, 0xFF, 0x6F,
+    0x90, 0x8C, 0xFF, 0x05, 0x09, 0xF6, 0xFF, 0xBF, 0x00, 0xD0, 0x82, 0xFF, 0x01, 0x03, 0x70, 0x80,
+    0xFF, 0x02, 0x0F, 0x00, 0xFE, 0x8A, 0xFF, 0x02, 0xEF, 0x00, 0xF0, 0x80, 0xFF, 0x01, 0x07, 0x30,
+    0x81, 0xFF, 0x02, 0xAF, 0x00, 0xF2, 0x80, 0xFF, 0x01, 0x9F, 0x10, 0x8C, 0xFF, 0x01, 0x02, 0xF8,
+    0x80, 0xFF, 0x02, 0x2F, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x81, 0xFF, 0x00, 0xFE,
+    0x84, 0xFF, 0x01, 0x6F, 0xF6, 0x84, 0xFF, 0x00, 0xEF, 0x81, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x80,
+    0xFF, 0x01, 0x0A, 0x40, 0x89, 0xFF, 0x01, 0x0A, 0xA0, 0x89, 0xFF, 0x01, 0x04, 0xA0, 0x80, 0xFF,
+    0x01, 0x03, 0xC0, 0x89, 0xFF, 0x01, 0x09, 0x90, 0x89, 0xFF, 0x05, 0x0C, 0x30, 0xFF, 0xDF, 0x00,
+    0xF3, 0x89, 0xFF, 0x01, 0x09, 0x90, 0x89, 0xFF, 0x05, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0xF9, 0x89,
+    0xFF, 0x01, 0x09, 0x90, 0x89, 0xFF, 0x05, 0x9F, 0x00, 0xF7, 0x2F, 0x00, 0xFE, 0x89, 0xFF, 0x01,
+    0x09, 0x90, 0x89, 0xFF, 0x04, 0xEF, 0x00, 0xF2, 0x0D, 0x40, 0x8A, 0xFF, 0x01, 0x09, 0x90, 0x8A,
+    0xFF, 0x03, 0x04, 0xD0, 0x0A, 0x80, 0x8A, 0xFF, 0x01, 0x09, 0x90, 0x8A, 0xFF, 0x03, 0x08, 0xA0,
+    0x06, 0xC0, 0x8A, 0xFF, 0x01, 0x09, 0x90, 0x8A, 0xFF, 0x03, 0x0C, 0x60, 0x04, 0xE0, 0x8A, 0xFF,
+    0x01, 0x09, 0x90, 0x8A, 0xFF, 0x03, 0x0E, 0x40, 0x02, 0xF1, 0x8A, 0xFF, 0x01, 0x09, 0x90, 0x8A,
+    0xFF, 0x03, 0x1F, 0x20, 0x00, 0xF3, 0x8A, 0xFF, 0x01, 0x09, 0x90, 0x8A, 0xFF, 0x00, 0x3F, 0x80,
+    0x00, 0x03, 0xF4, 0xFF, 0xBF, 0xFA, 0x87, 0xFF, 0x01, 0x09, 0x90, 0x87, 0xFF, 0x03, 0xAF, 0xFB,
+    0xFF, 0x4F, 0x80, 0x00, 0x03, 0xF4, 0xFF, 0x09, 0x40, 0x87, 0xFF, 0x01, 0x09, 0x70, 0x87, 0xFF,
+    0x03, 0x04, 0x90, 0xFF, 0x4F, 0x80, 0x00, 0x03, 0xF4, 0xFF, 0x09, 0x40, 0x87, 0xFF, 0x02, 0x0C,
+    0x00, 0xF9, 0x86, 0xFF, 0x03, 0x04, 0x90, 0xFF, 0x4F, 0x80, 0x00, 0x03, 0xF4, 0xFF, 0xBF, 0xEA,
+    0x87, 0xFF, 0x02, 0x8F, 0x00, 0x80, 0x86, 0xFF, 0x03, 0xAF, 0xFB, 0xFF, 0x4F, 0x80, 0x00, 0x00,
+    0xF3, 0x8B, 0xFF, 0x02, 0x09, 0x00, 0xF8, 0x88, 0xFF, 0x03, 0x3F, 0x00, 0x02, 0xF1, 0x8B, 0xFF,
+    0x02, 0x8F, 0x00, 0x80, 0x88, 0xFF, 0x03, 0x1F, 0x20, 0x04, 0xE0, 0x8C, 0xFF, 0x02, 0x08, 0x00,
+    0xF8, 0x87, 0xFF, 0x03, 0x0E, 0x40, 0x06, 0xC0, 0x8C, 0xFF, 0x02, 0x8F, 0x00, 0x80, 0x87, 0xFF,
+    0x03, 0x0C, 0x60, 0x0A, 0x80, 0x8D, 0xFF, 0x02, 0x08, 0x00, 0xF8, 0x86, 0xFF, 0x03, 0x08, 0xA0,
+    0x0D, 0x40, 0x8D, 0xFF, 0x02, 0x8F, 0x00, 0x80, 0x86, 0xFF, 0x04, 0x04, 0xD0, 0x2F, 0x00, 0xFE,
+    0x8D, 0xFF, 0x02, 0x08, 0x00, 0xF8, 0x85, 0xFF, 0x04, 0x00, 0xF2, 0x7F, 0x00, 0xF9, 0x8D, 0xFF,
+    0x02, 0x8F, 0x00, 0x80, 0x84, 0xFF, 0x05, 0x9F, 0x00, 0xF7, 0xCF, 0x00, 0xF3, 0x8E, 0xFF, 0x02,
+    0x08, 0x00, 0xF8, 0x83, 0xFF, 0x05, 0x3F, 0x00, 0xFC, 0xFF, 0x03, 0xC0, 0x8E, 0xFF, 0x02, 0x8F,
+    0x00, 0x80, 0x83, 0xFF, 0x01, 0x0C, 0x30, 0x80, 0xFF, 0x01, 0x0A, 0x40, 0x8F, 0xFF, 0x02, 0x08,
+    0x00, 0xF8, 0x82, 0xFF, 0x01, 0x04, 0xA0, 0x80, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x81, 0xFF, 0x00,
+    0xFE, 0x8A, 0xFF, 0x02, 0x8F, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x80, 0xFF, 0x02,
+    0xAF, 0x00, 0xF2, 0x80, 0xFF, 0x01, 0x9F, 0x20, 0x8B, 0xFF, 0x01, 0x08, 0x60, 0x81, 0xFF, 0x02,
+    0x2F, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0x03, 0x70, 0x80, 0xFF, 0x02, 0x0F, 0x00, 0xFE, 0x8A, 0xFF,
+    0x01, 0xAF, 0xE6, 0x81, 0xFF, 0x01, 0x07, 0x30, 0x82, 0xFF, 0x05, 0x0D, 0x00, 0xFC, 0xFF, 0x6F,
+    0x80, 0x8F, 0xFF, 0x02, 0xCF, 0x00, 0xD0, 0x82, 0xFF, 0x02, 0x8F, 0x00, 0xD1, 0x92, 0xFF, 0x02,
+    0x1D, 0x00, 0xF8, 0x83, 0xFF, 0x02, 0x04, 0x20, 0xFE, 0x90, 0xFF, 0x02, 0xEF, 0x02, 0x40, 0x84,
+    0xFF, 0x02, 0x2E, 0x00, 0xE2, 0x90, 0xFF, 0x02, 0x3E, 0x00, 0xE2, 0x84, 0xFF, 0x03, 0xEF, 0x02,
+    0x20, 0xFD, 0x85, 0xFF, 0x01, 0x4F, 0xF4, 0x85, 0xFF, 0x03, 0xDF, 0x02, 0x20, 0xFD, 0x85, 0xFF,
+    0x02, 0x2E, 0x00, 0xB1, 0x85, 0xFF, 0x01, 0x0A, 0xA0, 0x85, 0xFF, 0x02, 0x1C, 0x00, 0xE2, 0x86,
+    0xFF, 0x03, 0xEF, 0x02, 0x00, 0xF7, 0x84, 0xFF, 0x01, 0x0B, 0xB0, 0x84, 0xFF, 0x03, 0x7F, 0x00,
+    0x20, 0xFD, 0x87, 0xFF, 0x03, 0x4E, 0x00, 0x20, 0xFB, 0x83, 0xFF, 0x01, 0x9F, 0xF9, 0x83, 0xFF,
+    0x03, 0xBF, 0x02, 0x00, 0xE4, 0x89, 0xFF, 0x03, 0x08, 0x00, 0x40, 0xFC, 0x88, 0xFF, 0x03, 0xCF,
+    0x04, 0x00, 0x80, 0x8A, 0xFF, 0x04, 0xDF, 0x03, 0x00, 0x30, 0xE9, 0x86, 0xFF, 0x04, 0x9F, 0x03,
+    0x00, 0x30, 0xFD, 0x8B, 0xFF, 0x01, 0xAF, 0x02, 0x80, 0x00, 0x01, 0x84, 0xEC, 0x82, 0xFF, 0x01,
+    0xCE, 0x48, 0x80, 0x00, 0x01, 0x20, 0xFA, 0x8D, 0xFF, 0x01, 0xAF, 0x03, 0x81, 0x00, 0x00, 0x31,
+    0x80, 0x44, 0x00, 0x13, 0x81, 0x00, 0x01, 0x30, 0xFA, 0x8F, 0xFF, 0x01, 0xCF, 0x27, 0x86, 0x00,
+    0x01, 0x72, 0xFC, 0x92, 0xFF, 0x02, 0xAD, 0x46, 0x02, 0x80, 0x00, 0x02, 0x20, 0x64, 0xDA, 0x89,
+    0xFF,
+};
+const Icon time_icon = {60, 60, ICON_RLE, {0, 5, 10, 15}, time_icon_data, 945};
@@ -0,0 +1,90 @@
+#include <string.h>
+
+#include "battery_model.h"
+
+#define BATTERY_MODEL_MAGIC 0x42544D31
+#define BATTERY_MODEL_MIN_SAMPLES 4.0f
+
+static void reset(BatteryModel *model)
+{
+  memset(model, 0, sizeof(*model));
+  model->magic = BATTERY_MODEL_MAGIC;
+}
+
+void battery_model_update(BatteryModel *model, float volts, int temperature, float elapsed_h)
+{
+  if (model->magic != BATTERY_MODEL_MAGIC)
+  {
+    reset(model);
+  }
+
+  const BatterySample *latest = battery_model_latest(model);
+  uint16_t millivolts = (uint16_t)(volts * 1000.0f + 0.5f);
+  if (latest && millivolts > latest->millivolts + BATTERY_MODEL_CHARGE_MV)
+  {
+    reset(model);
+  }
+
+  BatterySample *sample = &model->history[model->head];
+  sample->millivolts = millivolts;
+  sample->temperature = (int8_t)temperature;
+  sample->awake_s = model->last_awake_ms / 1000 > 255 ? 255 : model->last_awake_ms / 1000;
+  model->head = (model->head + 1) % BATTERY_HISTORY_LEN;
+  if (model->count < BATTERY_HISTORY_LEN)
+  {
+    ++model->count;
+  }
+
+  // -- Move the time origin to the new sample (t -> t - dt), then forget and add it at t = 0.
+  float dt = elapsed_h;
+  model->stt = model->stt - 2 * dt * model->st + dt * dt * model->s0;
+  model->stv = model->stv - dt * model->sv;
+  model->st = model->st - dt * model->s0;
+
+  model->s0 *= BATTERY_MODEL_FORGET;
+  model->st *= BATTERY_MODEL_FORGET;
+  model->stt *= BATTERY_MODEL_FORGET;
+  model->sv *= BATTERY_MODEL_FORGET;
+  model->stv *= BATTERY_MODEL_FORGET;
+
+  float normalized = volts + BATTERY_MODEL_MV_PER_C * (25 - temperature) / 1000.0f;
+  model->s0 += 1;
+  model->sv += normalized;
+}
+
+void battery_model_sleep(BatteryModel *model, unsigned long awake_ms)
+{
+  model->last_awake_ms = awake_ms > 0xFFFF ? 0xFFFF : (uint16_t)awake_ms;
+}
+
+float battery_model_days_left(const BatteryModel *model)
+{
+  if (model->magic != BATTERY_MODEL_MAGIC || model->count < BATTERY_MODEL_MIN_SAMPLES)
+  {
+    return -1;
+  }
+
+  float det = model->s0 * model->stt - model->st * model->st;
+  if (det <= 0)
+  {
+    return -1;
+  }
+  float slope = (model->s0 * model->stv - model->st * model->sv) / det;    // volts per hour
+  float intercept = (model->stt * model->sv - model->st * model->stv) / det; // fitted volts now
+  if (slope >= 0)
+  {
+    return -1;
+  }
+
+  float hours = (intercept - BATTERY_EMPTY_MV / 1000.0f) / -slope;
+  return hours > 0 ? hours / 24.0f : 0;
+}
+
+const BatterySample *battery_model_latest(const BatteryModel *model)
+{
+  if (model->count == 0)
+  {
+    return NULL;
+  }
+  return &model->history[(model->head + BATTERY_HISTORY_LEN - 1) % BATTERY_HISTORY_LEN];
+}
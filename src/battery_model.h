@@ -0,0 +1,56 @@
+#ifndef BATTERY_MODEL_H_
+#define BATTERY_MODEL_H_
+
+#include <stdint.h>
+
+#define BATTERY_HISTORY_LEN 48
+// -- Voltage at which the board browns out and the estimate reaches zero.
+#define BATTERY_EMPTY_MV 3300
+// -- Per-sample forgetting factor of the fit, roughly a 50 wake window.
+#define BATTERY_MODEL_FORGET 0.98f
+// -- Li-ion terminal voltage sags in the cold; samples are normalized to 25 °C.
+#define BATTERY_MODEL_MV_PER_C 1.5f
+// -- A jump up larger than this means the battery was charged, start over.
+#define BATTERY_MODEL_CHARGE_MV 80
+
+typedef struct
+{
+  uint16_t millivolts;
+  int8_t temperature; // °C
+  uint8_t awake_s;    // awake time of the wake before this sample
+} BatterySample;
+
+/**
+ * Kept in RTC memory. The discharge fit is a forgetting least squares
+ * line of voltage over time, with time measured relative to the newest
+ * sample so the sums stay small and each wake costs a handful of flops.
+ */
+typedef struct
+{
+  uint32_t magic;
+  BatterySample history[BATTERY_HISTORY_LEN];
+  uint8_t head;
+  uint8_t count;
+  uint16_t last_awake_ms;
+  float s0, st, stt, sv, stv; // weighted sums over t (hours, <= 0) and v (volts)
+} BatteryModel;
+
+/**
+ * Add a sample taken elapsed_h hours after the previous one.
+ */
+void battery_model_update(BatteryModel *model, float volts, int temperature, float elapsed_h);
+
+/**
+ * Remember how long this wake lasted, stored with the next sample.
+ */
+void battery_model_sleep(BatteryModel *model, unsigned long awake_ms);
+
+/**
+ * Estimated days until BATTERY_EMPTY_MV, or a negative value while the
+ * fit has too few samples or the voltage is not falling.
+ */
+float battery_model_days_left(const BatteryModel *model);
+
+const BatterySample *battery_model_latest(const BatteryModel *model);
+
+#endif
@@ -0,0 +1,497 @@
+/**
+ * Micro benchmarks of the plain C++ paths, see bench.h. The "bench_native"
+ * environment runs them on the host from main() below
+ * (pio run -e bench_native -t exec), the "bench" environment runs them on
+ * the device after the hardware bound ones in bench_device.cpp.
+ */
+#if defined(WEATHER_BENCH) || defined(WEATHER_BENCH_NATIVE)
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_timer.h>
+#define BENCH_PRINTF Serial.printf
+#define BENCH_REPEAT 1
+#else
+#define BENCH_PRINTF printf
+// -- The host is a few hundred times faster, more rounds keep the timer resolution out of the results.
+#define BENCH_REPEAT 50
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp32/rom/miniz.h"
+
+// -- ArduinoJson comes from lib_deps, a bare host build runs the rest without it.
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+#define HAVE_ARDUINO_JSON 1
+#else
+#define HAVE_ARDUINO_JSON 0
+#endif
+
+#include <epd_driver.h>
+
+#include "bench.h"
+#include "display_list.h"
+#include "fb_diff.h"
+#include "font_lookup.h"
+#include "frame_store.h"
+#include "glyph_blit.h"
+#include "icon.h"
+#include "image_blit.h"
+#include "layout.h"
+#include "ruuvi.h"
+#include "ruuvi_raw.h"
+
+#include "opensans16b_lut.h"
+#include "opensans24b.h"
+#include "temp_img.h"
+#include "r_rect_img.h"
+#include "temp_icon.h"
+#include "r_rect_icon.h"
+
+#if HAVE_ARDUINO_JSON
+static const char json_payload[] =
+    "{\"name\":\"Olohuone\",\"mac\":\"CB:B8:33:4C:88:4F\",\"temperature\":24.3,\"humidity\":53.49,"
+    "\"pressure\":100044,\"accelerationX\":0.004,\"accelerationY\":-0.004,\"accelerationZ\":1.036,"
+    "\"batteryVoltage\":2.977,\"txPower\":4,\"movementCounter\":66,\"measurementSequenceNumber\":205,"
+    "\"timestamp\":1681200000}";
+static StaticJsonDocument<768> doc;
+#endif
+static const char raw_payload[] = "0201061BFF99040512FC5394C37C0004FFFC040CAC364200CDCBB8334C884F";
+
+static tinfl_decompressor decompressor;
+static uint8_t glyph_buffer[4096];
+
+int64_t bench_now_us()
+{
+#ifdef ARDUINO
+  return esp_timer_get_time();
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+void bench_report(const char *name, int iterations, int64_t elapsed_us)
+{
+  BENCH_PRINTF("{\"bench\":\"%s\",\"iterations\":%d,\"us_per_op\":%.4f}\n", name, iterations, (double)elapsed_us / iterations);
+}
+
+static void fill_reading(RuuviReading *reading)
+{
+  memset(reading, 0, sizeof(*reading));
+  strlcpy(reading->name, "Olohuone", RUUVI_NAME_LEN);
+  reading->temperature = -1234;
+  reading->humidity = 5349;
+  reading->pressure = 100044;
+  reading->battery = 2977;
+  reading->timestamp = 1681200000;
+}
+
+static void bench_payloads()
+{
+  const int n = 2000 * BENCH_REPEAT;
+#if HAVE_ARDUINO_JSON
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    deserializeJson(doc, json_payload);
+  }
+  bench_report("json_parse", n, bench_now_us() - start);
+
+  uint8_t packed[256];
+  size_t packed_length = serializeMsgPack(doc, packed, sizeof(packed));
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    deserializeMsgPack(doc, (const char *)packed, packed_length);
+  }
+  bench_report("msgpack_parse", n, bench_now_us() - start);
+#endif
+
+  RuuviReading reading;
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    ruuvi_decode_hex(raw_payload, &reading);
+  }
+  bench_report("rawv2_decode", n, bench_now_us() - start);
+}
+
+static void bench_format()
+{
+  const int n = 2000 * BENCH_REPEAT;
+  RuuviReading reading;
+  fill_reading(&reading);
+  TagText text;
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    format_tag_text(&reading, reading.timestamp, &text);
+  }
+  bench_report("format_tag_text", n, bench_now_us() - start);
+}
+
+// -- Code point to glyph, epdiy's interval scan against the generated tables. Finnish letters sit in the second interval.
+static void bench_glyph_lookup()
+{
+  static const uint32_t code_points[] = {'O', 'l', 'o', 'h', 'u', 'o', 'n', 'e', ' ', 0xC4, 0xE4, 'n', 'e', 'k', 'o', 's',
+                                         'k', 'i', ' ', '2', '4', '.', '3', 0xB0, 'C', 0xD6, 0xF6, 0xE5, ' ', '%', 'V', 0x20AC};
+  const int count = sizeof(code_points) / sizeof(code_points[0]);
+  const int n = 2000 * BENCH_REPEAT;
+  volatile const EpdGlyph *sink;
+  // -- Read on every lookup, so an inlined lookup can not be hoisted out of the loop.
+  volatile uint32_t offset = 0;
+
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    for (int c = 0; c < count; c++)
+    {
+      sink = epd_get_glyph(&OpenSans16B, code_points[c] + offset);
+    }
+  }
+  bench_report("glyph_lookup_epdiy", n * count, bench_now_us() - start);
+
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    for (int c = 0; c < count; c++)
+    {
+      sink = font_lookup_glyph(&OpenSans16BLookup, code_points[c] + offset);
+    }
+  }
+  bench_report("glyph_lookup_table", n * count, bench_now_us() - start);
+  (void)sink;
+}
+
+// -- Measuring the strings of a tag column from the glyph metrics, then again through the cache as on the second draw.
+static void bench_text_measure()
+{
+  static const char *texts[] = {"Olohuone", "  24.30", "  53.49", "1000.44", "   2.98", "12.04.2023 10:40:00"};
+  const int count = sizeof(texts) / sizeof(texts[0]);
+  const int n = 500 * BENCH_REPEAT;
+  TextBounds bounds;
+
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    for (int t = 0; t < count; t++)
+    {
+      font_measure(&OpenSans16BLookup, texts[t], &bounds);
+    }
+  }
+  bench_report("text_measure", n * count, bench_now_us() - start);
+
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    for (int t = 0; t < count; t++)
+    {
+      font_measure_cached(&OpenSans16BLookup, texts[t], &bounds);
+    }
+  }
+  bench_report("text_measure_cached", n * count, bench_now_us() - start);
+}
+
+// -- Per glyph row, the generic per pixel path against the word wise black on white kernel.
+static void bench_glyph_blit(uint8_t *framebuffer)
+{
+  const EpdGlyph *glyph = epd_get_glyph(&OpenSans24B, '8');
+  size_t in = glyph->compressed_size;
+  size_t out = glyph->height * ((glyph->width + 1) / 2);
+  tinfl_init(&decompressor);
+  tinfl_decompress(&decompressor, OpenSans24B.bitmap + glyph->data_offset, &in, glyph_buffer, glyph_buffer, &out,
+                   TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+
+  const int n = 2000 * BENCH_REPEAT;
+  const struct
+  {
+    const char *name;
+    int x;
+    bool dark;
+  } cases[] = {
+      {"glyph_rows_generic", 100, false},
+      {"glyph_rows_dark_even_x", 100, true},
+      {"glyph_rows_dark_odd_x", 101, true},
+  };
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+  {
+    int64_t start = bench_now_us();
+    for (int i = 0; i < n; i++)
+    {
+      if (cases[c].dark)
+      {
+        glyph_blit_dark(framebuffer, EPD_WIDTH, 0, EPD_HEIGHT, cases[c].x, 100, glyph_buffer, glyph->width, glyph->height);
+      }
+      else
+      {
+        glyph_blit_generic(framebuffer, EPD_WIDTH, 0, EPD_HEIGHT, cases[c].x, 100, glyph_buffer, glyph->width, glyph->height);
+      }
+    }
+    bench_report(cases[c].name, n * glyph->height, bench_now_us() - start);
+  }
+}
+
+// -- The project blitter at aligned, unaligned and clipped positions. bench_device.cpp has epdiy's copy for comparison.
+static void bench_blits(uint8_t *framebuffer)
+{
+  const int n = 200 * BENCH_REPEAT;
+  const struct
+  {
+    const char *name;
+    EpdRect area;
+    const uint8_t *data;
+  } cases[] = {
+      {"icon_even_x", {20, 105, 60, 60}, temp_img_data},
+      {"icon_odd_x", {21, 105, 60, 60}, temp_img_data},
+      {"icon_clipped", {930, 500, 60, 60}, temp_img_data},
+      {"frame_even_x", {10, 100, 300, 350}, r_rect_img_data},
+      {"frame_odd_x", {11, 100, 300, 350}, r_rect_img_data},
+  };
+  const struct
+  {
+    const char *prefix;
+    ImageBlitMode mode;
+  } blitters[] = {
+      {"blit_opaque_", IMAGE_OPAQUE},
+      {"blit_transparent_", IMAGE_TRANSPARENT_WHITE},
+  };
+  char name[48];
+  for (size_t b = 0; b < sizeof(blitters) / sizeof(blitters[0]); b++)
+  {
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+      const EpdRect *area = &cases[c].area;
+      int iterations = area->width > 100 ? n / 10 : n;
+      int64_t start = bench_now_us();
+      for (int i = 0; i < iterations; i++)
+      {
+        image_blit(framebuffer, EPD_WIDTH, 0, EPD_HEIGHT, area->x, area->y, cases[c].data, area->width, area->height, blitters[b].mode);
+      }
+      snprintf(name, sizeof(name), "%s%s", blitters[b].prefix, cases[c].name);
+      bench_report(name, iterations, bench_now_us() - start);
+    }
+  }
+}
+
+// -- Compressed icons decoded row by row, to compare with blit_transparent_icon_even_x and frame_even_x.
+static void bench_icons(uint8_t *framebuffer)
+{
+  const int n = 200 * BENCH_REPEAT;
+  const struct
+  {
+    const char *name;
+    const Icon *icon;
+  } cases[] = {
+      {"icon_temp", &temp_icon},
+      {"icon_r_rect", &r_rect_icon},
+  };
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+  {
+    const Icon *icon = cases[c].icon;
+    int iterations = icon->width > 100 ? n / 10 : n;
+    int64_t start = bench_now_us();
+    for (int i = 0; i < iterations; i++)
+    {
+      icon_blit(icon, framebuffer, EPD_WIDTH, 0, EPD_HEIGHT, 20, 100, IMAGE_TRANSPARENT_WHITE);
+    }
+    bench_report(cases[c].name, iterations, bench_now_us() - start);
+    BENCH_PRINTF("%s: %u bytes, %u raw\n", cases[c].name, (unsigned)icon->size, (unsigned)((icon->width + 1) / 2 * icon->height));
+  }
+}
+
+static void bench_frame(uint8_t *framebuffer)
+{
+  const int n = 5 * BENCH_REPEAT;
+  RuuviReading reading;
+  fill_reading(&reading);
+
+  int64_t items_us = 0;
+  int64_t static_us = 0;
+  int64_t columns_us = 0;
+  fb = framebuffer;
+  for (int i = 0; i < n; i++)
+  {
+    memset(fb, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    int64_t items_start = bench_now_us();
+    draw_static_layout_items();
+    items_us += bench_now_us() - items_start;
+
+    int64_t start = bench_now_us();
+    draw_static_layout();
+    int64_t middle = bench_now_us();
+    for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+    {
+      draw_tag_column(tag, &reading, reading.timestamp);
+    }
+    int64_t end = bench_now_us();
+    static_us += middle - start;
+    columns_us += end - middle;
+  }
+  // -- Every icon and label drawn one by one against the background composed at build time.
+  bench_report("frame_static_layout_items", n, items_us);
+  bench_report("frame_static_layout", n, static_us);
+  bench_report("frame_tag_columns", n, columns_us);
+  bench_report("frame_total", n, static_us + columns_us);
+}
+
+static size_t encoded_length;
+
+static void count_sink(const uint8_t *data, size_t length, void *context)
+{
+  memcpy((uint8_t *)context + encoded_length, data, length);
+  encoded_length += length;
+}
+
+// -- Runs after bench_frame, so framebuffer holds a full drawn frame.
+static void bench_frame_store(const uint8_t *framebuffer)
+{
+  const int n = 5 * BENCH_REPEAT;
+  const size_t length = EPD_WIDTH * EPD_HEIGHT / 2;
+  uint8_t *encoded = (uint8_t *)malloc(length + length / 128 + 1);
+  uint8_t *restored = (uint8_t *)malloc(length);
+
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    encoded_length = 0;
+    frame_rle_encode(framebuffer, length, count_sink, encoded);
+  }
+  bench_report("frame_rle_encode", n, bench_now_us() - start);
+
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    frame_rle_decode(encoded, encoded_length, restored, length);
+  }
+  bench_report("frame_rle_decode", n, bench_now_us() - start);
+
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    frame_hash(restored, length);
+  }
+  bench_report("frame_hash", n, bench_now_us() - start);
+  BENCH_PRINTF("Frame RLE size: %u of %u bytes\n", (unsigned)encoded_length, (unsigned)length);
+
+  free(restored);
+  free(encoded);
+}
+
+// -- The whole frame compare that decides the refresh, unchanged and with one tag column redrawn.
+static void bench_fb_diff(const uint8_t *framebuffer)
+{
+  const int n = 20 * BENCH_REPEAT;
+  const size_t length = EPD_WIDTH * EPD_HEIGHT / 2;
+  uint8_t *changed = (uint8_t *)malloc(length);
+  memcpy(changed, framebuffer, length);
+  volatile uint32_t sink;
+
+  int64_t start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    sink = fb_diff(framebuffer, changed, EPD_WIDTH, EPD_HEIGHT, 0).pixels;
+  }
+  bench_report("fb_diff_same", n, bench_now_us() - start);
+
+  for (int y = 160; y < 420; y++)
+  {
+    memset(changed + y * EPD_WIDTH / 2 + 100, 0x00, 60);
+  }
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    sink = fb_diff(framebuffer, changed, EPD_WIDTH, EPD_HEIGHT, 0).pixels;
+  }
+  bench_report("fb_diff_column", n, bench_now_us() - start);
+
+  start = bench_now_us();
+  for (int i = 0; i < n; i++)
+  {
+    sink = fb_diff_area(framebuffer, changed, EPD_WIDTH, 10, 100, 300, 350, 0).pixels;
+  }
+  bench_report("fb_diff_area_column", n, bench_now_us() - start);
+  (void)sink;
+  free(changed);
+}
+
+// -- Same frame as bench_frame, recorded as a display list and rasterized band by band.
+static void bench_band()
+{
+  const int n = 5 * BENCH_REPEAT;
+  RuuviReading reading;
+  fill_reading(&reading);
+  DisplayList *list = (DisplayList *)malloc(sizeof(DisplayList));
+  uint8_t *band = (uint8_t *)malloc(EPD_WIDTH / 2 * DISPLAY_BAND_HEIGHT);
+
+  int64_t record_us = 0;
+  int64_t render_us = 0;
+  uint8_t *framebuffer = fb;
+  fb = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    int64_t start = bench_now_us();
+    display_list_clear(list);
+    layout_list = list;
+    draw_static_layout();
+    for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+    {
+      draw_tag_column(tag, &reading, reading.timestamp);
+    }
+    layout_list = NULL;
+    int64_t middle = bench_now_us();
+    for (int band_y = 0; band_y < EPD_HEIGHT; band_y += DISPLAY_BAND_HEIGHT)
+    {
+      int height = EPD_HEIGHT - band_y < DISPLAY_BAND_HEIGHT ? EPD_HEIGHT - band_y : DISPLAY_BAND_HEIGHT;
+      display_list_render_band(list, band_y, height, band);
+    }
+    record_us += middle - start;
+    render_us += bench_now_us() - middle;
+  }
+  fb = framebuffer;
+  bench_report("band_record", n, record_us);
+  bench_report("band_render", n, render_us);
+  bench_report("band_total", n, record_us + render_us);
+  BENCH_PRINTF("Band mode memory: %u bytes list + %u bytes band, full framebuffer mode: %u bytes per framebuffer\n",
+               (unsigned)sizeof(DisplayList), (unsigned)(EPD_WIDTH / 2 * DISPLAY_BAND_HEIGHT), (unsigned)(EPD_WIDTH / 2 * EPD_HEIGHT));
+
+  free(band);
+  free(list);
+}
+
+void bench_portable(uint8_t *framebuffer)
+{
+  memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+  bench_payloads();
+  bench_format();
+  bench_glyph_lookup();
+  bench_text_measure();
+  bench_glyph_blit(framebuffer);
+  bench_blits(framebuffer);
+  bench_icons(framebuffer);
+  bench_frame(framebuffer);
+  bench_frame_store(framebuffer);
+  bench_fb_diff(framebuffer);
+  bench_band();
+}
+
+#ifndef ARDUINO
+int main()
+{
+  uint8_t *framebuffer = (uint8_t *)malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+  // -- Timestamps are formatted in local time, pinned so runs compare.
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  printf("Benchmark start\n");
+  bench_portable(framebuffer);
+  printf("Benchmark done\n");
+  free(framebuffer);
+  return 0;
+}
+#endif
+
+#endif
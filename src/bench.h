@@ -0,0 +1,25 @@
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+
+/**
+ * Micro benchmarks of the parse, format and drawing hot paths. The plain
+ * C++ ones are in bench.cpp and run on the host (env:bench_native), the
+ * ones that need the ESP32 ROM or epdiy are in bench_device.cpp
+ * (env:bench). Every result is printed as one JSON line:
+ *   {"bench":"json_parse","iterations":2000,"us_per_op":41.2500}
+ * tools/bench_compare.py compares two captured runs.
+ */
+
+int64_t bench_now_us();
+
+void bench_report(const char *name, int iterations, int64_t elapsed_us);
+
+/**
+ * Run every portable benchmark, framebuffer is a scratch 960x540 4bpp
+ * frame and is left holding a fully drawn one.
+ */
+void bench_portable(uint8_t *framebuffer);
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * The benchmarks that need the device, see bench.h: glyph decoding with the
+ * ROM inflater and epdiy's framebuffer copy. Built only in the "bench"
+ * environment (pio run -e bench -t upload -t monitor), which replaces
+ * main.cpp and runs the portable benchmarks of bench.cpp afterwards.
+ */
+#ifdef WEATHER_BENCH
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include "esp32/rom/miniz.h"
+
+#include <epd_driver.h>
+
+#include "bench.h"
+#include "layout.h"
+
+#include "opensans12b.h"
+#include "opensans16b.h"
+#include "opensans24b.h"
+#include "temp_img.h"
+#include "r_rect_img.h"
+
+static tinfl_decompressor decompressor;
+static uint8_t glyph_buffer[4096];
+
+static void bench_glyphs(const char *name, const EpdFont *font)
+{
+  int glyphs = 0;
+  int64_t start = bench_now_us();
+  for (uint32_t i = 0; i < font->interval_count; i++)
+  {
+    const EpdUnicodeInterval *interval = &font->intervals[i];
+    for (uint32_t code_point = interval->first; code_point <= interval->last; code_point++)
+    {
+      const EpdGlyph *glyph = &font->glyph[interval->offset + code_point - interval->first];
+      size_t in = glyph->compressed_size;
+      size_t out = glyph->height * ((glyph->width + 1) / 2);
+      if (out > sizeof(glyph_buffer))
+      {
+        continue;
+      }
+      tinfl_init(&decompressor);
+      tinfl_decompress(&decompressor, font->bitmap + glyph->data_offset, &in, glyph_buffer, glyph_buffer, &out,
+                       TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+      ++glyphs;
+    }
+  }
+  bench_report(name, glyphs, bench_now_us() - start);
+}
+
+// -- epdiy's copy, the same cases as the blit_opaque_ and blit_transparent_ results of bench.cpp.
+static void bench_epdiy_blits()
+{
+  const int n = 200;
+  const struct
+  {
+    const char *name;
+    EpdRect area;
+    const uint8_t *data;
+  } cases[] = {
+      {"blit_epdiy_icon_even_x", {20, 105, 60, 60}, temp_img_data},
+      {"blit_epdiy_icon_odd_x", {21, 105, 60, 60}, temp_img_data},
+      {"blit_epdiy_icon_clipped", {930, 500, 60, 60}, temp_img_data},
+      {"blit_epdiy_frame_even_x", {10, 100, 300, 350}, r_rect_img_data},
+      {"blit_epdiy_frame_odd_x", {11, 100, 300, 350}, r_rect_img_data},
+  };
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+  {
+    const EpdRect *area = &cases[c].area;
+    int iterations = area->width > 100 ? n / 10 : n;
+    int64_t start = bench_now_us();
+    for (int i = 0; i < iterations; i++)
+    {
+      epd_copy_to_framebuffer(*area, (uint8_t *)cases[c].data, fb);
+    }
+    bench_report(cases[c].name, iterations, bench_now_us() - start);
+  }
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(500);
+  epd_init(EPD_OPTIONS_DEFAULT);
+  epd_set_rotation(EPD_ROT_LANDSCAPE);
+  fb = (uint8_t *)heap_caps_malloc(EPD_WIDTH * EPD_HEIGHT / 2, MALLOC_CAP_SPIRAM);
+  memset(fb, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+
+  Serial.println("Benchmark start");
+  bench_glyphs("glyph_decode_12b", &OpenSans12B);
+  bench_glyphs("glyph_decode_16b", &OpenSans16B);
+  bench_glyphs("glyph_decode_24b", &OpenSans24B);
+  bench_epdiy_blits();
+  bench_portable(fb);
+  Serial.println("Benchmark done");
+}
+
+void loop()
+{
+  delay(1000);
+}
+
+#endif
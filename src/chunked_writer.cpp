@@ -0,0 +1,147 @@
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "chunked_writer.h"
+
+ChunkedWriter::ChunkedWriter(WebServer &server) : server(server), length(0)
+{
+}
+
+void ChunkedWriter::begin(const char *content_type)
+{
+  length = 0;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, content_type, "");
+}
+
+void ChunkedWriter::flush()
+{
+  if (length > 0)
+  {
+    server.sendContent(buffer, length);
+    length = 0;
+  }
+}
+
+void ChunkedWriter::put(char c)
+{
+  if (length == CHUNK_SIZE)
+  {
+    flush();
+  }
+  buffer[length++] = c;
+}
+
+void ChunkedWriter::print(const char *text)
+{
+  while (*text)
+  {
+    put(*text++);
+  }
+}
+
+void ChunkedWriter::write(const uint8_t *data, size_t size)
+{
+  if (length + size <= CHUNK_SIZE)
+  {
+    memcpy(buffer + length, data, size);
+    length += size;
+    return;
+  }
+  // -- Too big to buffer, send pending data and this block as their own chunks.
+  flush();
+  server.sendContent((const char *)data, size);
+}
+
+void ChunkedWriter::printf(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buffer + length, CHUNK_SIZE - length, format, args);
+  va_end(args);
+  if (n < 0)
+  {
+    return;
+  }
+  if ((size_t)n < CHUNK_SIZE - length)
+  {
+    length += n;
+    return;
+  }
+  // -- Did not fit behind the pending data; retry into an empty buffer.
+  flush();
+  if ((size_t)n < CHUNK_SIZE)
+  {
+    va_start(args, format);
+    vsnprintf(buffer, CHUNK_SIZE, format, args);
+    va_end(args);
+    length = n;
+    return;
+  }
+  // -- Longer than a chunk, formatted on the heap and sent as its own chunk.
+  char *text = (char *)malloc(n + 1);
+  if (text == NULL)
+  {
+    va_start(args, format);
+    vsnprintf(buffer, CHUNK_SIZE, format, args);
+    va_end(args);
+    length = CHUNK_SIZE - 1;
+    Serial.printf("Chunk of %d bytes cut to %d, out of memory\n", n, CHUNK_SIZE - 1);
+    return;
+  }
+  va_start(args, format);
+  vsnprintf(text, n + 1, format, args);
+  va_end(args);
+  write((const uint8_t *)text, n);
+  free(text);
+}
+
+void ChunkedWriter::html(const char *text)
+{
+  for (; *text; text++)
+  {
+    switch (*text)
+    {
+    case '<':
+      print("&lt;");
+      break;
+    case '>':
+      print("&gt;");
+      break;
+    case '&':
+      print("&amp;");
+      break;
+    case '"':
+      print("&quot;");
+      break;
+    default:
+      put(*text);
+    }
+  }
+}
+
+void ChunkedWriter::label(const char *text)
+{
+  for (; *text; text++)
+  {
+    if (*text == '\\' || *text == '"')
+    {
+      put('\\');
+      put(*text);
+    }
+    else if (*text == '\n')
+    {
+      print("\\n");
+    }
+    else
+    {
+      put(*text);
+    }
+  }
+}
+
+void ChunkedWriter::end()
+{
+  flush();
+  server.sendContent("", 0);
+}
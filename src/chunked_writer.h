@@ -0,0 +1,37 @@
+#ifndef CHUNKED_WRITER_H_
+#define CHUNKED_WRITER_H_
+
+#include <WebServer.h>
+
+#define CHUNK_SIZE 256
+
+/**
+ * Streams a response as HTTP chunks from a fixed buffer so large pages
+ * never build a String on the heap.
+ */
+class ChunkedWriter
+{
+public:
+  explicit ChunkedWriter(WebServer &server);
+
+  void begin(const char *content_type);
+  void print(const char *text);
+  void write(const uint8_t *data, size_t size);
+  // -- Output longer than a chunk is formatted on the heap and sent as its own chunk.
+  void printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  // -- Text escaped for HTML bodies.
+  void html(const char *text);
+  // -- Text escaped for Prometheus label values.
+  void label(const char *text);
+  void end();
+
+private:
+  void put(char c);
+  void flush();
+
+  WebServer &server;
+  char buffer[CHUNK_SIZE];
+  size_t length;
+};
+
+#endif
@@ -0,0 +1,411 @@
+#include <string.h>
+#include <esp_heap_caps.h>
+#include "esp32/rom/miniz.h"
+
+#include "display_list.h"
+#include "glyph_blit.h"
+
+static tinfl_decompressor decompressor;
+static uint8_t glyph_buffer[2048];
+// -- Allocated on the first draw and kept, so steady refreshes leave the heap alone.
+static uint8_t *band_buffer = NULL;
+
+#define DISPLAY_SUMMARY_MAGIC 0x44535331
+
+static uint32_t hash_bytes(uint32_t hash, const void *data, size_t length)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t item_hash(const DisplayItem *item)
+{
+  uint32_t hash = hash_bytes(2166136261u, &item->type, sizeof(item->type));
+  hash = hash_bytes(hash, &item->mode, sizeof(item->mode));
+  hash = hash_bytes(hash, &item->source, sizeof(item->source));
+  return hash_bytes(hash, item->text, strlen(item->text));
+}
+
+void display_list_clear(DisplayList *list)
+{
+  list->count = 0;
+  list->dropped = 0;
+}
+
+bool display_list_add_image(DisplayList *list, int x, int y, const Icon *icon, ImageBlitMode mode)
+{
+  if (list->count >= DISPLAY_LIST_MAX_ITEMS)
+  {
+    ++list->dropped;
+    return false;
+  }
+  DisplayItem *item = &list->items[list->count++];
+  item->type = DISPLAY_IMAGE;
+  item->mode = mode;
+  item->x = x;
+  item->y = y;
+  item->width = icon->width;
+  item->height = icon->height;
+  item->cursor_x = 0;
+  item->baseline = 0;
+  item->source = icon;
+  item->text[0] = '\0';
+  item->hash = item_hash(item);
+  return true;
+}
+
+// -- Fill in a text item: bounds from the glyph metrics and the pen position after alignment.
+static void layout_text(DisplayItem *item, const FontLookup *font, const char *text, int x, int y, int flags,
+                        const TextBounds *bounds)
+{
+  strlcpy(item->text, text, DISPLAY_TEXT_LEN);
+
+  // -- Measured from the glyph metrics only, nothing is decompressed here.
+  TextBounds measured;
+  if (!bounds)
+  {
+    font_measure_cached(font, item->text, &measured);
+    bounds = &measured;
+  }
+  int left = bounds->left;
+  int right = bounds->right;
+  int top = y + bounds->top;
+  int bottom = y + bounds->bottom;
+  // -- Aligned by the inked width, as epdiy does.
+  if (flags & EPD_DRAW_ALIGN_RIGHT)
+  {
+    x -= right - left;
+  }
+  else if (flags & EPD_DRAW_ALIGN_CENTER)
+  {
+    x -= (right - left) / 2;
+  }
+
+  item->type = DISPLAY_TEXT;
+  item->mode = 0;
+  item->x = x + left;
+  item->y = top;
+  item->width = right - left;
+  item->height = bottom - top;
+  item->cursor_x = x;
+  item->baseline = y;
+  item->source = font;
+  item->hash = item_hash(item);
+}
+
+bool display_list_add_text(DisplayList *list, const FontLookup *font, const char *text, int x, int y, int flags,
+                           const TextBounds *bounds)
+{
+  if (list->count >= DISPLAY_LIST_MAX_ITEMS)
+  {
+    ++list->dropped;
+    return false;
+  }
+  layout_text(&list->items[list->count++], font, text, x, y, flags, bounds);
+  return true;
+}
+
+// -- Where each image item's decoding stopped, so the next band carries on instead of decoding from the top.
+static IconReader icon_readers[DISPLAY_LIST_MAX_ITEMS];
+
+static void render_image(const DisplayItem *item, IconReader *reader, int band_y, int band_height, uint8_t *band)
+{
+  icon_blit_from(reader, (const Icon *)item->source, band, EPD_WIDTH, band_y, band_height, item->x, item->y,
+                 (ImageBlitMode)item->mode);
+}
+
+static void render_text(const DisplayItem *item, int band_y, int band_height, uint8_t *band)
+{
+  const FontLookup *font = (const FontLookup *)item->source;
+  int cursor_x = item->cursor_x;
+  const char *s = item->text;
+  uint32_t cp;
+  while ((cp = font_next_code_point(&s)) != 0)
+  {
+    const EpdGlyph *glyph = font_lookup_glyph(font, cp);
+    if (!glyph)
+    {
+      continue;
+    }
+    int glyph_y = item->baseline - glyph->top;
+    int first_row = glyph_y > band_y ? glyph_y : band_y;
+    int end_row = glyph_y + glyph->height < band_y + band_height ? glyph_y + glyph->height : band_y + band_height;
+    int byte_width = (glyph->width + 1) / 2;
+    size_t size = byte_width * glyph->height;
+    if (first_row >= end_row || size == 0 || size > sizeof(glyph_buffer))
+    {
+      cursor_x += glyph->advance_x;
+      continue;
+    }
+
+    const uint8_t *bitmap = font->font->bitmap + glyph->data_offset;
+    if (font->font->compressed)
+    {
+      size_t in = glyph->compressed_size;
+      size_t out = size;
+      tinfl_init(&decompressor);
+      tinfl_status status = tinfl_decompress(&decompressor, bitmap, &in, glyph_buffer, glyph_buffer, &out,
+                                             TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+      // -- A glyph that does not inflate completely is left out rather than drawn from a stale buffer.
+      if (status != TINFL_STATUS_DONE)
+      {
+        cursor_x += glyph->advance_x;
+        continue;
+      }
+      bitmap = glyph_buffer;
+    }
+
+    // -- Text always sits on white, so the word wise kernel gives the same pixels as epdiy.
+    glyph_blit_dark(band, EPD_WIDTH, band_y, band_height, cursor_x + glyph->left, glyph_y, bitmap, glyph->width, glyph->height);
+    cursor_x += glyph->advance_x;
+  }
+}
+
+void display_list_write_text(const FontLookup *font, const char *text, int x, int y, int flags, const TextBounds *bounds,
+                             uint8_t *framebuffer)
+{
+  DisplayItem item;
+  layout_text(&item, font, text, x, y, flags, bounds);
+  render_text(&item, 0, EPD_HEIGHT, framebuffer);
+}
+
+bool display_list_render_band(const DisplayList *list, int band_y, int band_height, uint8_t *band)
+{
+  memset(band, 0xFF, EPD_WIDTH / 2 * band_height);
+  bool touched = false;
+  for (int i = 0; i < list->count; i++)
+  {
+    const DisplayItem *item = &list->items[i];
+    if (item->y >= band_y + band_height || item->y + item->height <= band_y)
+    {
+      continue;
+    }
+    touched = true;
+    if (item->type == DISPLAY_IMAGE)
+    {
+      render_image(item, &icon_readers[i], band_y, band_height, band);
+    }
+    else
+    {
+      render_text(item, band_y, band_height, band);
+    }
+  }
+  return touched;
+}
+
+enum EpdDrawError display_list_draw(const DisplayList *list)
+{
+  EpdRect screen = {
+      .x = 0,
+      .y = 0,
+      .width = EPD_WIDTH,
+      .height = EPD_HEIGHT,
+  };
+  return display_list_draw_area(list, screen);
+}
+
+enum EpdDrawError display_list_draw_area(const DisplayList *list, EpdRect area)
+{
+  EpdRect screen = {
+      .x = 0,
+      .y = 0,
+      .width = EPD_WIDTH,
+      .height = EPD_HEIGHT,
+  };
+  // -- Whole bytes only, so rows can be packed without shifting nibbles.
+  area.width += area.x & 1;
+  area.x &= ~1;
+  area.width += area.width & 1;
+  if (!display_rect_intersect(area, screen, &area))
+  {
+    return EPD_DRAW_SUCCESS;
+  }
+
+  if (!band_buffer)
+  {
+    band_buffer = (uint8_t *)heap_caps_malloc(EPD_WIDTH / 2 * DISPLAY_BAND_HEIGHT, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  if (!band_buffer)
+  {
+    return EPD_DRAW_FAILED_ALLOC;
+  }
+  uint8_t *band = band_buffer;
+  enum EpdDrawError err = EPD_DRAW_SUCCESS;
+  int end_y = area.y + area.height;
+  for (int band_y = area.y; band_y < end_y && err == EPD_DRAW_SUCCESS; band_y += DISPLAY_BAND_HEIGHT)
+  {
+    int height = end_y - band_y < DISPLAY_BAND_HEIGHT ? end_y - band_y : DISPLAY_BAND_HEIGHT;
+    // -- The area was cleared, bands without items stay white.
+    if (!display_list_render_band(list, band_y, height, band))
+    {
+      continue;
+    }
+    for (int row = 0; row < height; row++)
+    {
+      memmove(band + row * area.width / 2, band + row * EPD_WIDTH / 2 + area.x / 2, area.width / 2);
+    }
+    EpdRect band_area = {
+        .x = area.x,
+        .y = band_y,
+        .width = area.width,
+        .height = height,
+    };
+    err = epd_draw_image(band_area, band, EPD_BUILTIN_WAVEFORM);
+  }
+  return err;
+}
+
+void display_list_summarize(const DisplayList *list, DisplaySummary *summary)
+{
+  summary->magic = list->dropped ? 0 : DISPLAY_SUMMARY_MAGIC;
+  summary->count = list->count;
+  for (int i = 0; i < list->count; i++)
+  {
+    const DisplayItem *item = &list->items[i];
+    DisplayKey key = {item->x, item->y, item->width, item->height, item->hash};
+    summary->keys[i] = key;
+  }
+}
+
+bool display_summary_valid(const DisplaySummary *summary)
+{
+  return summary->magic == DISPLAY_SUMMARY_MAGIC && summary->count <= DISPLAY_LIST_MAX_ITEMS;
+}
+
+bool display_rect_intersect(EpdRect a, EpdRect b, EpdRect *out)
+{
+  int x0 = a.x > b.x ? a.x : b.x;
+  int y0 = a.y > b.y ? a.y : b.y;
+  int x1 = a.x + a.width < b.x + b.width ? a.x + a.width : b.x + b.width;
+  int y1 = a.y + a.height < b.y + b.height ? a.y + a.height : b.y + b.height;
+  if (x0 >= x1 || y0 >= y1)
+  {
+    return false;
+  }
+  out->x = x0;
+  out->y = y0;
+  out->width = x1 - x0;
+  out->height = y1 - y0;
+  return true;
+}
+
+EpdRect display_rect_union(EpdRect a, EpdRect b)
+{
+  int x0 = a.x < b.x ? a.x : b.x;
+  int y0 = a.y < b.y ? a.y : b.y;
+  int x1 = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+  int y1 = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+  EpdRect r = {
+      .x = x0,
+      .y = y0,
+      .width = x1 - x0,
+      .height = y1 - y0,
+  };
+  return r;
+}
+
+static bool rects_touch(EpdRect a, EpdRect b)
+{
+  return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+static bool key_equal(const DisplayKey *a, const DisplayKey *b)
+{
+  return a->hash == b->hash && a->x == b->x && a->y == b->y && a->width == b->width && a->height == b->height;
+}
+
+static void add_dirty(DirtyRects *dirty, EpdRect rect)
+{
+  if (rect.width <= 0 || rect.height <= 0)
+  {
+    return;
+  }
+  // -- Whole bytes, so display_list_draw_area covers exactly the rectangle.
+  rect.width += rect.x & 1;
+  rect.x &= ~1;
+  rect.width += rect.width & 1;
+  if (dirty->count == DISPLAY_DIRTY_MAX)
+  {
+    // -- Full: grow the rectangle that needs the least extra area.
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < dirty->count; i++)
+    {
+      EpdRect u = display_rect_union(dirty->rects[i], rect);
+      long growth = (long)u.width * u.height - (long)dirty->rects[i].width * dirty->rects[i].height;
+      if (best_growth < 0 || growth < best_growth)
+      {
+        best = i;
+        best_growth = growth;
+      }
+    }
+    rect = display_rect_union(dirty->rects[best], rect);
+    dirty->rects[best] = dirty->rects[--dirty->count];
+  }
+  // -- Absorb everything the new rectangle touches, repeat as it grows.
+  bool merged = true;
+  while (merged)
+  {
+    merged = false;
+    for (int i = 0; i < dirty->count; i++)
+    {
+      if (rects_touch(dirty->rects[i], rect))
+      {
+        rect = display_rect_union(dirty->rects[i], rect);
+        dirty->rects[i] = dirty->rects[--dirty->count];
+        merged = true;
+        break;
+      }
+    }
+  }
+  dirty->rects[dirty->count++] = rect;
+}
+
+void display_list_diff(const DisplaySummary *summary, const DisplayList *list, DirtyRects *dirty)
+{
+  dirty->count = 0;
+  bool matched[DISPLAY_LIST_MAX_ITEMS] = {false};
+  for (int i = 0; i < list->count; i++)
+  {
+    const DisplayItem *item = &list->items[i];
+    DisplayKey key = {item->x, item->y, item->width, item->height, item->hash};
+    bool found = false;
+    for (int j = 0; j < summary->count && !found; j++)
+    {
+      if (!matched[j] && key_equal(&key, &summary->keys[j]))
+      {
+        matched[j] = true;
+        found = true;
+      }
+    }
+    if (!found)
+    {
+      EpdRect rect = {
+          .x = item->x,
+          .y = item->y,
+          .width = item->width,
+          .height = item->height,
+      };
+      add_dirty(dirty, rect);
+    }
+  }
+  // -- Whatever is gone has to be erased.
+  for (int j = 0; j < summary->count; j++)
+  {
+    if (!matched[j])
+    {
+      const DisplayKey *key = &summary->keys[j];
+      EpdRect rect = {
+          .x = key->x,
+          .y = key->y,
+          .width = key->width,
+          .height = key->height,
+      };
+      add_dirty(dirty, rect);
+    }
+  }
+}
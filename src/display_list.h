@@ -0,0 +1,147 @@
+#ifndef DISPLAY_LIST_H_
+#define DISPLAY_LIST_H_
+
+#include <stdint.h>
+#include <epd_driver.h>
+#include "font_lookup.h"
+#include "icon.h"
+
+// -- Enough for the static layout, three tag columns and the status line.
+#define DISPLAY_LIST_MAX_ITEMS 64
+#define DISPLAY_TEXT_LEN 48
+
+// -- Rows per band in band rendering mode, a 960x32 band is 15 KB.
+#define DISPLAY_BAND_HEIGHT 32
+
+typedef enum
+{
+  DISPLAY_IMAGE,
+  DISPLAY_TEXT
+} DisplayItemType;
+
+/**
+ * One drawing operation. x, y, width and height are the bounds on screen,
+ * for text they are resolved from the cursor and alignment when added.
+ */
+typedef struct
+{
+  uint8_t type;
+  uint8_t mode;       // ImageBlitMode, images only
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  int16_t cursor_x;   // text only, pen position of the first glyph
+  int16_t baseline;   // text only
+  uint32_t hash;      // what is drawn, independent of where
+  const void *source; // Icon or FontLookup
+  char text[DISPLAY_TEXT_LEN];
+} DisplayItem;
+
+typedef struct
+{
+  DisplayItem items[DISPLAY_LIST_MAX_ITEMS];
+  int count;
+  int dropped; // items that did not fit since the last clear
+} DisplayList;
+
+// -- Bounds and content hash of one item, all that is kept of a frame across deep sleep.
+typedef struct
+{
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  uint32_t hash;
+} DisplayKey;
+
+// -- The frame on the panel, small enough for RTC memory (under 800 bytes).
+typedef struct
+{
+  uint32_t magic;
+  uint16_t count;
+  DisplayKey keys[DISPLAY_LIST_MAX_ITEMS];
+} DisplaySummary;
+
+#define DISPLAY_DIRTY_MAX 16
+
+typedef struct
+{
+  EpdRect rects[DISPLAY_DIRTY_MAX];
+  int count;
+} DirtyRects;
+
+void display_list_clear(DisplayList *list);
+
+/**
+ * Add an icon, decoded again every time a band or area is rendered.
+ * Returns false and counts the item in dropped when the list is full.
+ */
+bool display_list_add_image(DisplayList *list, int x, int y, const Icon *icon, ImageBlitMode mode);
+
+/**
+ * Add a single line of black text. x and y are the cursor as passed to
+ * epd_write_string, flags one of the EPD_DRAW_ALIGN_* values. bounds are
+ * the text's measurements when known at compile time, NULL to measure it
+ * through the cache.
+ */
+bool display_list_add_text(DisplayList *list, const FontLookup *font, const char *text, int x, int y, int flags,
+                           const TextBounds *bounds);
+
+/**
+ * Draw black text straight into a full framebuffer, with the rasterizer
+ * the bands use. The text must go on a white background.
+ */
+void display_list_write_text(const FontLookup *font, const char *text, int x, int y, int flags, const TextBounds *bounds,
+                             uint8_t *framebuffer);
+
+/**
+ * Rasterize every item that touches rows band_y to band_y + band_height - 1
+ * into band, a white 4bpp buffer of EPD_WIDTH x band_height. Returns
+ * false when nothing touched the band, it is then left white.
+ */
+bool display_list_render_band(const DisplayList *list, int band_y, int band_height, uint8_t *band);
+
+/**
+ * Draw the whole list onto a cleared panel band by band, without a full
+ * framebuffer. The panel must be powered on.
+ */
+enum EpdDrawError display_list_draw(const DisplayList *list);
+
+/**
+ * Same as display_list_draw limited to area, which must have been cleared.
+ * The area is widened to even x coordinates.
+ */
+enum EpdDrawError display_list_draw_area(const DisplayList *list, EpdRect area);
+
+/**
+ * Remember the bounds and hashes of the items in list. A list that dropped
+ * items does not describe the frame, the summary is then left invalid so
+ * the next refresh starts clean.
+ */
+void display_list_summarize(const DisplayList *list, DisplaySummary *summary);
+
+/**
+ * False until display_list_summarize has filled summary, e.g. after a power loss.
+ */
+bool display_summary_valid(const DisplaySummary *summary);
+
+/**
+ * Rectangles covering every item that was added, removed, moved or changed
+ * since summary was taken, widened to even x. Touching rectangles are
+ * merged, and when there are more than DISPLAY_DIRTY_MAX the closest ones
+ * are combined.
+ */
+void display_list_diff(const DisplaySummary *summary, const DisplayList *list, DirtyRects *dirty);
+
+/**
+ * Intersection of a and b, false when they do not overlap.
+ */
+bool display_rect_intersect(EpdRect a, EpdRect b, EpdRect *out);
+
+/**
+ * Smallest rectangle containing a and b.
+ */
+EpdRect display_rect_union(EpdRect a, EpdRect b);
+
+#endif
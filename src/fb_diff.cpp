@@ -0,0 +1,69 @@
+#include <string.h>
+
+#include "fb_diff.h"
+
+FbDiff fb_diff(const uint8_t *a, const uint8_t *b, int width, int height, int tolerance)
+{
+  return fb_diff_area(a, b, width, 0, 0, width, height, tolerance);
+}
+
+FbDiff fb_diff_area(const uint8_t *a, const uint8_t *b, int width, int area_x, int area_y, int area_width, int area_height, int tolerance)
+{
+  FbDiff diff = {0, 0, 0, 0, 0};
+  int stride = (width + 1) / 2;
+  int end_x = area_x + area_width;
+  int end_y = area_y + area_height;
+  int first = area_x / 2;
+  int count = (end_x + 1) / 2 - first;
+  int min_x = end_x, max_x = -1, min_y = end_y, max_y = -1;
+
+  for (int y = area_y; y < end_y; y++)
+  {
+    const uint8_t *row_a = a + y * stride;
+    const uint8_t *row_b = b + y * stride;
+    if (memcmp(row_a + first, row_b + first, count) == 0)
+    {
+      continue;
+    }
+    for (int i = first; i < first + count; i++)
+    {
+      if (row_a[i] == row_b[i])
+      {
+        continue;
+      }
+      for (int half = 0; half < 2; half++)
+      {
+        int x = i * 2 + half;
+        int shift = half * 4;
+        int delta = ((row_a[i] >> shift) & 0x0F) - ((row_b[i] >> shift) & 0x0F);
+        if (x < area_x || x >= end_x || (delta <= tolerance && -delta <= tolerance))
+        {
+          continue;
+        }
+        ++diff.pixels;
+        if (x < min_x)
+        {
+          min_x = x;
+        }
+        if (x > max_x)
+        {
+          max_x = x;
+        }
+        if (y < min_y)
+        {
+          min_y = y;
+        }
+        max_y = y;
+      }
+    }
+  }
+
+  if (diff.pixels > 0)
+  {
+    diff.x = min_x;
+    diff.y = min_y;
+    diff.width = max_x - min_x + 1;
+    diff.height = max_y - min_y + 1;
+  }
+  return diff;
+}
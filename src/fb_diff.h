@@ -0,0 +1,29 @@
+#ifndef FB_DIFF_H_
+#define FB_DIFF_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+  int x;
+  int y;
+  int width;
+  int height;
+  uint32_t pixels; // pixels that differ by more than the tolerance
+} FbDiff;
+
+/**
+ * Compare two 4bpp framebuffers (left pixel in the low nibble) and return
+ * the bounding box of pixels whose gray levels differ by more than
+ * tolerance (0-15). An empty result has width and height 0. Identical rows
+ * are skipped with memcmp, so mostly unchanged frames are cheap.
+ */
+FbDiff fb_diff(const uint8_t *a, const uint8_t *b, int width, int height, int tolerance);
+
+/**
+ * Same as fb_diff, limited to one rectangle of framebuffers that are
+ * width pixels wide. The result is in framebuffer coordinates.
+ */
+FbDiff fb_diff_area(const uint8_t *a, const uint8_t *b, int width, int area_x, int area_y, int area_width, int area_height, int tolerance);
+
+#endif
@@ -0,0 +1,151 @@
+#include <string.h>
+
+#include "font_lookup.h"
+
+#define TEXT_CACHE_SIZE 16
+// -- Longest string kept, as long as a display list text item.
+#define TEXT_CACHE_TEXT_LEN 48
+
+typedef struct
+{
+  const FontLookup *font;
+  uint32_t hash;
+  TextBounds bounds;
+  char text[TEXT_CACHE_TEXT_LEN];
+} TextCacheEntry;
+
+static TextCacheEntry text_cache[TEXT_CACHE_SIZE];
+TextCacheStats text_cache_stats;
+
+uint32_t font_next_code_point(const char **text)
+{
+  const uint8_t *s = (const uint8_t *)*text;
+  uint32_t cp = *s;
+  int extra = 0;
+  if (cp == 0)
+  {
+    return 0;
+  }
+  if (cp >= 0xF0)
+  {
+    cp &= 0x07;
+    extra = 3;
+  }
+  else if (cp >= 0xE0)
+  {
+    cp &= 0x0F;
+    extra = 2;
+  }
+  else if (cp >= 0xC0)
+  {
+    cp &= 0x1F;
+    extra = 1;
+  }
+  ++s;
+  while (extra-- > 0 && (*s & 0xC0) == 0x80)
+  {
+    cp = (cp << 6) | (*s++ & 0x3F);
+  }
+  *text = (const char *)s;
+  return cp;
+}
+
+
+const EpdGlyph *font_lookup_glyph(const FontLookup *lookup, uint32_t code_point)
+{
+  if (code_point < 0x100)
+  {
+    uint16_t index = lookup->latin1[code_point];
+    return index == FONT_LOOKUP_NONE ? NULL : &lookup->font->glyph[index];
+  }
+  int low = 0;
+  int high = lookup->extra_count - 1;
+  while (low <= high)
+  {
+    int middle = (low + high) / 2;
+    uint32_t found = lookup->extra[middle].code_point;
+    if (found == code_point)
+    {
+      return &lookup->font->glyph[lookup->extra[middle].glyph];
+    }
+    if (found < code_point)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle - 1;
+    }
+  }
+  return NULL;
+}
+
+void font_measure(const FontLookup *font, const char *text, TextBounds *bounds)
+{
+  int pen = 0;
+  int left = 0;
+  int right = 0;
+  int top = 0;
+  int bottom = 0;
+  uint32_t cp;
+  while ((cp = font_next_code_point(&text)) != 0)
+  {
+    const EpdGlyph *glyph = font_lookup_glyph(font, cp);
+    if (!glyph)
+    {
+      continue;
+    }
+    if (pen + glyph->left < left)
+    {
+      left = pen + glyph->left;
+    }
+    if (pen + glyph->left + glyph->width > right)
+    {
+      right = pen + glyph->left + glyph->width;
+    }
+    pen += glyph->advance_x;
+    if (-glyph->top < top)
+    {
+      top = -glyph->top;
+    }
+    if (-glyph->top + glyph->height > bottom)
+    {
+      bottom = -glyph->top + glyph->height;
+    }
+  }
+  bounds->left = left;
+  bounds->right = right;
+  bounds->top = top;
+  bounds->bottom = bottom;
+}
+
+void font_measure_cached(const FontLookup *font, const char *text, TextBounds *bounds)
+{
+  // -- FNV-1a over the string, the font pointer mixed in last.
+  uint32_t hash = 2166136261u;
+  size_t length = 0;
+  for (const char *s = text; *s; s++, length++)
+  {
+    hash = (hash ^ (uint8_t)*s) * 16777619u;
+  }
+  hash = (hash ^ (uint32_t)(uintptr_t)font) * 16777619u;
+
+  // -- The hash only picks the slot and rejects quickly, a hit needs the same string.
+  TextCacheEntry *entry = &text_cache[hash % TEXT_CACHE_SIZE];
+  if (entry->font == font && entry->hash == hash && strcmp(entry->text, text) == 0)
+  {
+    ++text_cache_stats.hits;
+    *bounds = entry->bounds;
+    return;
+  }
+  ++text_cache_stats.misses;
+  font_measure(font, text, bounds);
+  if (length >= TEXT_CACHE_TEXT_LEN)
+  {
+    return;
+  }
+  entry->font = font;
+  entry->hash = hash;
+  entry->bounds = *bounds;
+  memcpy(entry->text, text, length + 1);
+}
@@ -0,0 +1,131 @@
+#ifndef FONT_LOOKUP_H_
+#define FONT_LOOKUP_H_
+
+#include <stdint.h>
+#include <epd_driver.h>
+
+// -- Latin-1 entry of a code point the font has no glyph for.
+#define FONT_LOOKUP_NONE 0xFFFF
+
+typedef struct
+{
+  uint32_t code_point;
+  uint16_t glyph;
+} FontLookupEntry;
+
+/**
+ * Glyph tables of one font, generated by tools/font_lut.py into
+ * <font>_lut.h. Text rendering takes these instead of the bare EpdFont.
+ */
+typedef struct
+{
+  const EpdFont *font;
+  const uint16_t *latin1;       // glyph index per code point below 0x100
+  const FontLookupEntry *extra; // code points from 0x100 up, sorted
+  uint16_t extra_count;
+} FontLookup;
+
+/**
+ * Glyph of a code point, NULL when the font has none. A table index below
+ * 0x100, a binary search above. Same result as epd_get_glyph.
+ */
+const EpdGlyph *font_lookup_glyph(const FontLookup *lookup, uint32_t code_point);
+
+/**
+ * Next code point of a UTF-8 string, 0 at the end.
+ */
+uint32_t font_next_code_point(const char **text);
+
+/**
+ * Inked area of a line of text, relative to the pen start and the
+ * baseline, as epdiy measures it: the pen start and the baseline are
+ * always inside, top is negative above the baseline.
+ */
+typedef struct
+{
+  int16_t left;
+  int16_t right;
+  int16_t top;
+  int16_t bottom;
+} TextBounds;
+
+/**
+ * Measure text from the glyph metrics. Never inflates a glyph.
+ */
+void font_measure(const FontLookup *font, const char *text, TextBounds *bounds);
+
+/**
+ * font_measure through a small cache keyed by font and string, for strings
+ * that are measured again, like a value that is both recorded and drawn.
+ * Strings of 48 bytes or more are not kept.
+ */
+void font_measure_cached(const FontLookup *font, const char *text, TextBounds *bounds);
+
+typedef struct
+{
+  uint32_t hits;
+  uint32_t misses;
+} TextCacheStats;
+
+extern TextCacheStats text_cache_stats;
+
+/**
+ * Metrics of a glyph as emitted by tools/font_lut.py for compile time
+ * measurement, present is false where the font has no glyph.
+ */
+typedef struct
+{
+  int16_t advance_x;
+  int16_t left;
+  int16_t width;
+  int16_t top;
+  int16_t height;
+  bool present;
+} GlyphMetrics;
+
+// -- Compile time counterpart of font_measure for Latin-1 strings, see font_measure_constant.
+constexpr int16_t font_min(int a, int b)
+{
+  return a < b ? a : b;
+}
+
+constexpr int16_t font_max(int a, int b)
+{
+  return a > b ? a : b;
+}
+
+constexpr int font_utf8_length(const char *text)
+{
+  return (uint8_t)text[0] < 0x80 ? 1 : 2;
+}
+
+// -- Code points above 0xFF come out as 0x100 and fail to compile against a 256 entry table.
+constexpr uint32_t font_utf8_latin1(const char *text)
+{
+  return (uint8_t)text[0] < 0x80   ? (uint8_t)text[0]
+         : (uint8_t)text[0] < 0xC4 ? (((uint8_t)text[0] & 0x1F) << 6) | ((uint8_t)text[1] & 0x3F)
+                                   : 0x100;
+}
+
+constexpr TextBounds font_bounds_add(TextBounds bounds, int pen, GlyphMetrics glyph)
+{
+  return glyph.present ? TextBounds{font_min(bounds.left, pen + glyph.left), font_max(bounds.right, pen + glyph.left + glyph.width),
+                                    font_min(bounds.top, -glyph.top), font_max(bounds.bottom, -glyph.top + glyph.height)}
+                       : bounds;
+}
+
+constexpr TextBounds font_measure_from(const GlyphMetrics *metrics, const char *text, int pen, TextBounds bounds)
+{
+  return *text == 0 ? bounds
+                    : font_measure_from(metrics, text + font_utf8_length(text),
+                                        pen + metrics[font_utf8_latin1(text)].advance_x,
+                                        font_bounds_add(bounds, pen, metrics[font_utf8_latin1(text)]));
+}
+
+// -- Bounds of a constant string, e.g. font_measure_constant(OpenSans16BMetrics, " hpa").
+constexpr TextBounds font_measure_constant(const GlyphMetrics *metrics, const char *text)
+{
+  return font_measure_from(metrics, text, 0, TextBounds{0, 0, 0, 0});
+}
+
+#endif
@@ -0,0 +1,275 @@
+#include <string.h>
+
+#include "frame_store.h"
+
+#define FRAME_STORE_MAGIC 0x46524D31
+// -- RTC state layout, bump when FrameStoreState changes.
+#define FRAME_STORE_STATE_MAGIC 0x46525332
+#define FRAME_RLE_MAX_LITERAL 128
+#define FRAME_RLE_MAX_RUN 129
+
+FrameStoreStats frame_store_stats;
+
+uint32_t frame_hash(const uint8_t *data, size_t length)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+typedef struct
+{
+  uint8_t buffer[256];
+  size_t used;
+  size_t total;
+  FrameSink sink;
+  void *context;
+} RleWriter;
+
+static void rle_flush(RleWriter *writer)
+{
+  if (writer->used > 0)
+  {
+    writer->sink(writer->buffer, writer->used, writer->context);
+    writer->total += writer->used;
+    writer->used = 0;
+  }
+}
+
+static void rle_emit(RleWriter *writer, const uint8_t *data, size_t length)
+{
+  if (writer->used + length > sizeof(writer->buffer))
+  {
+    rle_flush(writer);
+  }
+  memcpy(writer->buffer + writer->used, data, length);
+  writer->used += length;
+}
+
+static size_t run_length(const uint8_t *data, size_t length, size_t i)
+{
+  size_t run = 1;
+  while (i + run < length && run < FRAME_RLE_MAX_RUN && data[i + run] == data[i])
+  {
+    ++run;
+  }
+  return run;
+}
+
+size_t frame_rle_encode(const uint8_t *data, size_t length, FrameSink sink, void *context)
+{
+  RleWriter writer;
+  writer.used = 0;
+  writer.total = 0;
+  writer.sink = sink;
+  writer.context = context;
+
+  size_t i = 0;
+  while (i < length)
+  {
+    size_t run = run_length(data, length, i);
+    if (run >= 2)
+    {
+      uint8_t packet[2] = {(uint8_t)(0x80 + run - 2), data[i]};
+      rle_emit(&writer, packet, 2);
+      i += run;
+      continue;
+    }
+    // -- Gather literals until the next repeat or the packet is full.
+    size_t start = i;
+    while (i < length && i - start < FRAME_RLE_MAX_LITERAL && (i + 1 >= length || data[i + 1] != data[i]))
+    {
+      ++i;
+    }
+    uint8_t control = (uint8_t)(i - start - 1);
+    rle_emit(&writer, &control, 1);
+    rle_emit(&writer, data + start, i - start);
+  }
+  rle_flush(&writer);
+  return writer.total;
+}
+
+bool frame_rle_decode(const uint8_t *data, size_t length, uint8_t *out, size_t out_length)
+{
+  size_t in = 0;
+  size_t pos = 0;
+  while (in < length)
+  {
+    uint8_t control = data[in++];
+    if (control & 0x80)
+    {
+      size_t run = control - 0x7E;
+      if (in >= length || pos + run > out_length)
+      {
+        return false;
+      }
+      memset(out + pos, data[in++], run);
+      pos += run;
+    }
+    else
+    {
+      size_t literal = control + 1;
+      if (in + literal > length || pos + literal > out_length)
+      {
+        return false;
+      }
+      memcpy(out + pos, data + in, literal);
+      in += literal;
+      pos += literal;
+    }
+  }
+  return pos == out_length;
+}
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+
+// -- Every file starts with magic, sequence and the hash of the raw frame.
+typedef struct
+{
+  uint32_t magic;
+  uint32_t sequence;
+  uint32_t hash;
+} FrameHeader;
+
+RTC_DATA_ATTR FrameStoreState frame_store_state;
+
+static void slot_path(char *path, size_t size, uint32_t slot)
+{
+  snprintf(path, size, "/frame%u.rle", (unsigned)slot);
+}
+
+// -- Also takes the header of a save cut short, which still has magic 0.
+static bool read_header(uint32_t slot, FrameHeader *header)
+{
+  char path[16];
+  slot_path(path, sizeof(path), slot);
+  File file = LittleFS.open(path, "r");
+  if (!file)
+  {
+    return false;
+  }
+  bool ok = file.read((uint8_t *)header, sizeof(*header)) == sizeof(*header) &&
+            (header->magic == FRAME_STORE_MAGIC || header->magic == 0);
+  file.close();
+  return ok;
+}
+
+// -- After a power loss the RTC state is gone, find the newest slot on flash. When that one was
+// -- cut short it does not verify, and the next load misses.
+static void recover_state()
+{
+  memset(&frame_store_state, 0, sizeof(frame_store_state));
+  frame_store_state.magic = FRAME_STORE_STATE_MAGIC;
+  frame_store_state.slot = FRAME_STORE_SLOTS - 1;
+  bool found = false;
+  for (uint32_t slot = 0; slot < FRAME_STORE_SLOTS; slot++)
+  {
+    FrameHeader header;
+    if (read_header(slot, &header) && (!found || header.sequence > frame_store_state.sequence))
+    {
+      found = true;
+      frame_store_state.sequence = header.sequence;
+      frame_store_state.slot = slot;
+      frame_store_state.hash = header.hash;
+    }
+  }
+}
+
+bool frame_store_begin()
+{
+  if (!LittleFS.begin(true))
+  {
+    return false;
+  }
+  if (frame_store_state.magic != FRAME_STORE_STATE_MAGIC)
+  {
+    recover_state();
+  }
+  return true;
+}
+
+static bool load_slot(uint32_t slot, uint8_t *framebuffer, size_t length, FrameHeader *header)
+{
+  char path[16];
+  slot_path(path, sizeof(path), slot);
+  File file = LittleFS.open(path, "r");
+  if (!file || file.size() < sizeof(*header))
+  {
+    return false;
+  }
+  size_t encoded_length = file.size() - sizeof(*header);
+  uint8_t *encoded = (uint8_t *)heap_caps_malloc(encoded_length, MALLOC_CAP_SPIRAM);
+  bool ok = encoded != NULL && file.read((uint8_t *)header, sizeof(*header)) == sizeof(*header) &&
+            header->magic == FRAME_STORE_MAGIC && file.read(encoded, encoded_length) == encoded_length &&
+            frame_rle_decode(encoded, encoded_length, framebuffer, length) && frame_hash(framebuffer, length) == header->hash;
+  file.close();
+  free(encoded);
+  frame_store_stats.stored_bytes = encoded_length;
+  return ok;
+}
+
+bool frame_store_load(uint8_t *framebuffer, size_t length)
+{
+  unsigned long started = micros();
+  if (frame_store_state.sequence == 0 || frame_store_state.failed)
+  {
+    return false;
+  }
+  // -- Only the newest frame will do. The sequence check keeps an older frame left in a
+  // -- reused slot from passing for it.
+  FrameHeader header;
+  bool ok = load_slot(frame_store_state.slot, framebuffer, length, &header) &&
+            header.sequence == frame_store_state.sequence;
+  frame_store_stats.restore_us = micros() - started;
+  return ok;
+}
+
+static void file_sink(const uint8_t *data, size_t length, void *context)
+{
+  ((File *)context)->write(data, length);
+}
+
+bool frame_store_save(const uint8_t *framebuffer, size_t length)
+{
+  unsigned long started = micros();
+  uint32_t hash = frame_hash(framebuffer, length);
+  if (frame_store_state.sequence > 0 && !frame_store_state.failed && hash == frame_store_state.hash)
+  {
+    frame_store_stats.save_skipped = true;
+    frame_store_stats.save_us = 0;
+    return true;
+  }
+
+  uint32_t slot = (frame_store_state.slot + 1) % FRAME_STORE_SLOTS;
+  char path[16];
+  slot_path(path, sizeof(path), slot);
+  File file = LittleFS.open(path, "w");
+  if (!file)
+  {
+    frame_store_state.failed = true;
+    return false;
+  }
+  // -- Data first and the header last: until the header is written the file has no magic and
+  // -- never verifies.
+  FrameHeader header = {0, frame_store_state.sequence + 1, hash};
+  file.write((const uint8_t *)&header, sizeof(header));
+  frame_store_stats.stored_bytes = frame_rle_encode(framebuffer, length, file_sink, &file);
+  bool ok = file.size() == sizeof(header) + frame_store_stats.stored_bytes;
+  header.magic = FRAME_STORE_MAGIC;
+  ok = ok && file.seek(0) && file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  file.close();
+  // -- Failed or not the slot and sequence move on, so the next save never counts as older
+  // -- than this one, and the next load misses instead of restoring the previous frame.
+  frame_store_state.sequence = header.sequence;
+  frame_store_state.slot = slot;
+  frame_store_state.hash = hash;
+  frame_store_state.failed = !ok;
+  frame_store_stats.save_skipped = false;
+  frame_store_stats.save_us = micros() - started;
+  return ok;
+}
@@ -0,0 +1,77 @@
+#ifndef FRAME_STORE_H_
+#define FRAME_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -- Files the frame rotates through, so a rewrite never lands on the same file twice in a row.
+#define FRAME_STORE_SLOTS 4
+
+/**
+ * Receives the encoded frame piece by piece.
+ */
+typedef void (*FrameSink)(const uint8_t *data, size_t length, void *context);
+
+// -- Which file holds the newest frame, kept across deep sleep.
+typedef struct
+{
+  uint32_t magic;
+  uint32_t sequence;
+  uint32_t slot;
+  uint32_t hash;
+  bool failed;      // the last save did not complete, the panel shows a frame that is not stored
+} FrameStoreState;
+
+extern FrameStoreState frame_store_state;
+
+// -- Cost of the last save and restore.
+typedef struct
+{
+  uint32_t save_us;      // hash, compress and write, 0 when skipped
+  uint32_t restore_us;   // read, expand and verify
+  uint32_t stored_bytes; // compressed size on flash
+  bool save_skipped;     // frame was already stored
+} FrameStoreStats;
+
+extern FrameStoreStats frame_store_stats;
+
+/**
+ * FNV-1a over a framebuffer, used to detect unchanged frames and to verify
+ * a restored one.
+ */
+uint32_t frame_hash(const uint8_t *data, size_t length);
+
+/**
+ * Run length encode a framebuffer. A control byte below 0x80 is followed by
+ * control + 1 literal bytes, one from 0x80 up repeats the next byte
+ * control - 0x7E times. Returns the encoded size.
+ */
+size_t frame_rle_encode(const uint8_t *data, size_t length, FrameSink sink, void *context);
+
+/**
+ * Expand an encoded frame into out. Fails unless it fills exactly
+ * out_length bytes.
+ */
+bool frame_rle_decode(const uint8_t *data, size_t length, uint8_t *out, size_t out_length);
+
+/**
+ * Mount the filesystem. Call once before load or save.
+ */
+bool frame_store_begin();
+
+/**
+ * Restore the newest stored frame into framebuffer. Returns false when it
+ * does not verify (a write cut short, corrupted flash) or the last save
+ * failed, framebuffer is then undefined. An older frame is never restored:
+ * the panel shows the newest one, and a diff against anything else would
+ * leave stale pixels undriven.
+ */
+bool frame_store_load(uint8_t *framebuffer, size_t length);
+
+/**
+ * Store framebuffer in the next slot unless it equals the stored frame.
+ * When it fails nothing is restored until a later save succeeds.
+ */
+bool frame_store_save(const uint8_t *framebuffer, size_t length);
+
+#endif
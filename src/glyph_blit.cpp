@@ -0,0 +1,109 @@
+#include <string.h>
+
+#include "glyph_blit.h"
+
+// -- Widest glyph in the fonts is well below this, wider ones take the generic path.
+#define GLYPH_BLIT_MAX_BYTES 2048
+
+static uint8_t shifted[GLYPH_BLIT_MAX_BYTES];
+
+static void row_range(int first_row, int rows, int y, int height, int *start, int *end)
+{
+  *start = y > first_row ? y : first_row;
+  *end = y + height < first_row + rows ? y + height : first_row + rows;
+}
+
+void glyph_blit_generic(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                        const uint8_t *bitmap, int width, int height)
+{
+  int stride = (buffer_width + 1) / 2;
+  int byte_width = (width + 1) / 2;
+  int start, end;
+  row_range(first_row, rows, y, height, &start, &end);
+  for (int row = start; row < end; row++)
+  {
+    const uint8_t *src = bitmap + (row - y) * byte_width;
+    uint8_t *dst = buffer + (row - first_row) * stride;
+    for (int i = 0; i < width; i++)
+    {
+      uint8_t coverage = (i & 1) ? src[i / 2] >> 4 : src[i / 2] & 0x0F;
+      int xx = x + i;
+      if (coverage == 0 || xx < 0 || xx >= buffer_width)
+      {
+        continue;
+      }
+      uint8_t *p = dst + xx / 2;
+      uint8_t color = 15 - coverage;
+      *p = (xx & 1) ? (*p & 0x0F) | (color << 4) : (*p & 0xF0) | color;
+    }
+  }
+}
+
+// -- dst &= ~src over length bytes, a word at a time. Neither side is aligned.
+static inline void and_not(uint8_t *dst, const uint8_t *src, int length)
+{
+  int i = 0;
+  for (; i + 4 <= length; i += 4)
+  {
+    uint32_t d, s;
+    memcpy(&d, dst + i, 4);
+    memcpy(&s, src + i, 4);
+    d &= ~s;
+    memcpy(dst + i, &d, 4);
+  }
+  for (; i < length; i++)
+  {
+    dst[i] &= ~src[i];
+  }
+}
+
+void glyph_blit_dark(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                     const uint8_t *bitmap, int width, int height)
+{
+  int byte_width = (width + 1) / 2;
+  int shifted_width = (width + 2) / 2;
+  if (x < 0 || x + width > buffer_width || (x & 1 && shifted_width * height > GLYPH_BLIT_MAX_BYTES))
+  {
+    glyph_blit_generic(buffer, buffer_width, first_row, rows, x, y, bitmap, width, height);
+    return;
+  }
+
+  int stride = (buffer_width + 1) / 2;
+  int start, end;
+  row_range(first_row, rows, y, height, &start, &end);
+  if (start >= end)
+  {
+    return;
+  }
+
+  const uint8_t *src = bitmap + (start - y) * byte_width;
+  int src_stride = byte_width;
+  int length = byte_width;
+  if (x & 1)
+  {
+    // -- Move every pixel one nibble to the right, the empty low nibble leaves the left neighbour alone.
+    uint8_t *out = shifted;
+    for (int row = start; row < end; row++, src += byte_width)
+    {
+      uint8_t carry = 0;
+      for (int i = 0; i < byte_width; i++)
+      {
+        *out++ = (uint8_t)(src[i] << 4) | carry;
+        carry = src[i] >> 4;
+      }
+      if (shifted_width > byte_width)
+      {
+        *out++ = carry;
+      }
+    }
+    src = shifted;
+    src_stride = shifted_width;
+    length = shifted_width;
+  }
+
+  uint8_t *dst = buffer + (start - first_row) * stride + x / 2;
+  for (int row = start; row < end; row++, src += src_stride, dst += stride)
+  {
+    and_not(dst, src, length);
+  }
+}
@@ -0,0 +1,36 @@
+#ifndef GLYPH_BLIT_H_
+#define GLYPH_BLIT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Glyph bitmaps as stored in the fonts, inflated: 4bpp coverage, rows of
+ * (width + 1) / 2 bytes, left pixel in the low nibble.
+ *
+ * Both kernels draw black text into a 4bpp buffer that is buffer_width
+ * pixels wide and holds the rows first_row to first_row + rows - 1.
+ * Glyph rows outside the buffer are skipped.
+ */
+
+/**
+ * Per pixel path, the same result as epdiy's default font properties:
+ * covered pixels are set to 15 - coverage, uncovered ones are left alone.
+ * Clips horizontally as well.
+ */
+void glyph_blit_generic(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                        const uint8_t *bitmap, int width, int height);
+
+/**
+ * Fast path for text on a white background. Every destination byte is
+ * ANDed with the inverted coverage, four bytes at a time, which gives the
+ * same pixels as glyph_blit_generic where the background is white. Glyphs
+ * at odd x use rows shifted by one nibble, prepared once per glyph. Falls
+ * back to glyph_blit_generic when the glyph crosses the left or right edge.
+ * Rows of odd width must end in an empty high nibble, as epdiy's
+ * fontconvert.py pads them.
+ */
+void glyph_blit_dark(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                     const uint8_t *bitmap, int width, int height);
+
+#endif
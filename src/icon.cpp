@@ -0,0 +1,139 @@
+#include <string.h>
+
+#include "icon.h"
+
+#define ICON_MAX_ROW_BYTES 512
+
+static uint8_t row_buffer[ICON_MAX_ROW_BYTES];
+
+static void rle_read(RleReader *reader, uint8_t *out, int length)
+{
+  while (length > 0)
+  {
+    if (reader->run == 0)
+    {
+      if (reader->in >= reader->end)
+      {
+        memset(out, 0xFF, length);
+        return;
+      }
+      uint8_t control = *reader->in++;
+      reader->repeat = control & 0x80;
+      reader->run = reader->repeat ? control - 0x7E : control + 1;
+      if (reader->repeat)
+      {
+        // -- A repeat packet cut off before its value repeats white.
+        reader->value = reader->in < reader->end ? *reader->in++ : 0xFF;
+      }
+    }
+    int count = reader->run < length ? reader->run : length;
+    if (reader->repeat)
+    {
+      memset(out, reader->value, count);
+    }
+    else
+    {
+      // -- Literals past the end of the data, like missing packets, are white.
+      int available = reader->end - reader->in;
+      int copied = count < available ? count : available;
+      memcpy(out, reader->in, copied);
+      memset(out + copied, 0xFF, count - copied);
+      reader->in += copied;
+    }
+    out += count;
+    length -= count;
+    reader->run -= count;
+  }
+}
+
+static void mask_read(MaskReader *reader, int width, uint8_t *out)
+{
+  int mask_stride = (width + 7) / 8;
+  memset(out, 0xFF, (width + 1) / 2);
+  for (int i = 0; i < width; i++)
+  {
+    if (!(reader->mask[i / 8] & (1 << (i % 8))))
+    {
+      continue;
+    }
+    uint8_t gray = reader->grays[reader->gray_index / 2];
+    gray = (reader->gray_index & 1) ? gray >> 4 : gray & 0x0F;
+    ++reader->gray_index;
+    out[i / 2] = (i & 1) ? (out[i / 2] & 0x0F) | (gray << 4) : (out[i / 2] & 0xF0) | gray;
+  }
+  reader->mask += mask_stride;
+}
+
+static void pal2_read(const Icon *icon, const uint8_t *in, uint8_t *out)
+{
+  for (int i = 0; i < icon->width; i += 2)
+  {
+    uint8_t low = icon->palette[(in[i / 4] >> (i % 4 * 2)) & 0x03];
+    uint8_t high = i + 1 < icon->width ? icon->palette[(in[(i + 1) / 4] >> ((i + 1) % 4 * 2)) & 0x03] : 0;
+    out[i / 2] = low | (high << 4);
+  }
+}
+
+void icon_blit(const Icon *icon, uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y, ImageBlitMode mode)
+{
+  IconReader reader;
+  memset(&reader, 0, sizeof(reader));
+  icon_blit_from(&reader, icon, buffer, buffer_width, first_row, rows, x, y, mode);
+}
+
+void icon_blit_from(IconReader *reader, const Icon *icon, uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                    ImageBlitMode mode)
+{
+  int stride = (icon->width + 1) / 2;
+  int start = y > first_row ? y : first_row;
+  int end = y + icon->height < first_row + rows ? y + icon->height : first_row + rows;
+  if (start >= end || stride > ICON_MAX_ROW_BYTES)
+  {
+    return;
+  }
+
+  if (icon->encoding == ICON_RAW)
+  {
+    image_blit(buffer, buffer_width, first_row, rows, x, y, icon->data, icon->width, icon->height, mode);
+    return;
+  }
+
+  // -- The sequential encodings are decoded from the top, or from where the reader stopped
+  // -- when that is not below the first row wanted.
+  if (reader->icon != icon || reader->row > start - y)
+  {
+    int mask_bytes = (icon->width + 7) / 8 * icon->height;
+    RleReader rle = {icon->data, icon->data + icon->size, 0, false, 0xFF};
+    MaskReader masked = {icon->data, icon->data + mask_bytes, 0};
+    reader->icon = icon;
+    reader->row = 0;
+    reader->rle = rle;
+    reader->masked = masked;
+  }
+  // -- Rows of the palette encoding are found directly.
+  int row_from = icon->encoding == ICON_PAL2 ? start : y + reader->row;
+  for (int row = row_from; row < end; row++)
+  {
+    switch (icon->encoding)
+    {
+    case ICON_RLE:
+      rle_read(&reader->rle, row_buffer, stride);
+      ++reader->row;
+      break;
+    case ICON_MASK:
+      mask_read(&reader->masked, icon->width, row_buffer);
+      ++reader->row;
+      break;
+    case ICON_PAL2:
+      pal2_read(icon, icon->data + (row - y) * ((icon->width + 3) / 4), row_buffer);
+      break;
+    default:
+      return;
+    }
+    if (row >= start)
+    {
+      image_blit(buffer + (row - first_row) * ((buffer_width + 1) / 2), buffer_width, row, 1, x, row, row_buffer, icon->width, 1,
+                 mode);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#ifndef ICON_H_
+#define ICON_H_
+
+#include <stdint.h>
+#include "image_blit.h"
+
+// -- Encodings written by tools/icon_convert.py, fastest to decode first.
+typedef enum
+{
+  ICON_RAW,  // 4bpp rows of (width + 1) / 2 bytes, left pixel in the low nibble
+  ICON_RLE,  // the raw bytes run length coded like the frame store
+  ICON_MASK, // 1bpp rows of non-white pixels, then their 4bpp gray levels in order
+  ICON_PAL2  // 2bpp rows of indices into palette, first pixel in the low bits
+} IconEncoding;
+
+typedef struct
+{
+  uint16_t width;
+  uint16_t height;
+  uint8_t encoding;
+  uint8_t palette[4]; // ICON_PAL2 only
+  const uint8_t *data;
+  uint32_t size;
+} Icon;
+
+// -- Streams ICON_RLE packets, which may run across row ends.
+typedef struct
+{
+  const uint8_t *in;
+  const uint8_t *end;
+  int run;      // bytes left in the current packet
+  bool repeat;  // run of value rather than literals
+  uint8_t value;
+} RleReader;
+
+// -- Pixels of the mask encoding: bit reader over the mask, nibble reader over the grays.
+typedef struct
+{
+  const uint8_t *mask;
+  const uint8_t *grays;
+  uint32_t gray_index;
+} MaskReader;
+
+/**
+ * Where decoding of a sequentially encoded icon (ICON_RLE, ICON_MASK) has
+ * got to. Zeroed it starts at the top. Kept from band to band so each row
+ * is decoded once; asking for a row above it starts over.
+ */
+typedef struct
+{
+  const Icon *icon;
+  int row; // next icon row to decode
+  RleReader rle;
+  MaskReader masked;
+} IconReader;
+
+/**
+ * Decode icon row by row and draw it at x, y into a 4bpp buffer, clipped the
+ * same way as image_blit. No more than one row (at most 1024 pixels) is
+ * expanded at a time.
+ */
+void icon_blit(const Icon *icon, uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y, ImageBlitMode mode);
+
+/**
+ * icon_blit continuing from reader, for drawing the same icon band after
+ * band from the top down.
+ */
+void icon_blit_from(IconReader *reader, const Icon *icon, uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                    ImageBlitMode mode);
+
+#endif
@@ -0,0 +1,115 @@
+#include <string.h>
+
+#include "image_blit.h"
+
+#define IMAGE_BLIT_MAX_BYTES 512
+
+static uint8_t shifted[IMAGE_BLIT_MAX_BYTES];
+// -- Per byte: nibbles that are white (0xF) in the image and keep the destination.
+static uint8_t white_mask[256];
+static bool white_mask_ready = false;
+
+static void init_white_mask()
+{
+  for (int i = 0; i < 256; i++)
+  {
+    white_mask[i] = ((i & 0x0F) == 0x0F ? 0x0F : 0) | ((i & 0xF0) == 0xF0 ? 0xF0 : 0);
+  }
+  white_mask_ready = true;
+}
+
+static inline void merge(uint8_t *dst, uint8_t src, uint8_t keep, ImageBlitMode mode)
+{
+  if (mode == IMAGE_TRANSPARENT_WHITE)
+  {
+    keep |= white_mask[src];
+  }
+  *dst = (*dst & keep) | (src & ~keep);
+}
+
+/**
+ * Write pixels start to end - 1 of a buffer row from src, where src[k]
+ * holds the pixels of buffer byte start / 2 + k.
+ */
+static void blit_row(uint8_t *row, const uint8_t *src, int start, int end, ImageBlitMode mode)
+{
+  int first = start / 2;
+  int last = (end - 1) / 2;
+  // -- Nibbles outside start..end in the first and last byte are kept.
+  uint8_t first_keep = (start & 1) ? 0x0F : 0x00;
+  uint8_t last_keep = (end & 1) ? 0xF0 : 0x00;
+  if (first == last)
+  {
+    merge(row + first, src[0], first_keep | last_keep, mode);
+    return;
+  }
+  int middle = first + 1;
+  if (!first_keep && mode == IMAGE_OPAQUE)
+  {
+    middle = first;
+  }
+  else
+  {
+    merge(row + first, src[0], first_keep, mode);
+  }
+  int middle_end = last_keep ? last : last + 1;
+  if (middle_end > middle)
+  {
+    if (mode == IMAGE_OPAQUE)
+    {
+      memcpy(row + middle, src + (middle - first), middle_end - middle);
+    }
+    else
+    {
+      for (int i = middle; i < middle_end; i++)
+      {
+        merge(row + i, src[i - first], 0, mode);
+      }
+    }
+  }
+  if (last_keep)
+  {
+    merge(row + last, src[last - first], last_keep, mode);
+  }
+}
+
+void image_blit(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                const uint8_t *image, int width, int height, ImageBlitMode mode)
+{
+  if (!white_mask_ready)
+  {
+    init_white_mask();
+  }
+  int stride = (buffer_width + 1) / 2;
+  int image_stride = (width + 1) / 2;
+  int start_x = x > 0 ? x : 0;
+  int end_x = x + width < buffer_width ? x + width : buffer_width;
+  int start_y = y > first_row ? y : first_row;
+  int end_y = y + height < first_row + rows ? y + height : first_row + rows;
+  if (start_x >= end_x || start_y >= end_y || stride > IMAGE_BLIT_MAX_BYTES)
+  {
+    return;
+  }
+
+  int first = start_x / 2;
+  int last = (end_x - 1) / 2;
+  for (int yy = start_y; yy < end_y; yy++)
+  {
+    const uint8_t *src = image + (yy - y) * image_stride;
+    uint8_t *row = buffer + (yy - first_row) * stride;
+    if (!(x & 1))
+    {
+      blit_row(row, src + (first - x / 2), start_x, end_x, mode);
+      continue;
+    }
+    // -- Odd x: buffer byte b holds image pixels 2b - x and 2b - x + 1, the high nibble of one image byte and the low one of the next.
+    for (int b = first; b <= last; b++)
+    {
+      int j = (2 * b - x) >> 1;
+      uint8_t low = j >= 0 ? src[j] >> 4 : 0;
+      uint8_t high = j + 1 < image_stride ? (uint8_t)(src[j + 1] << 4) : 0;
+      shifted[b - first] = low | high;
+    }
+    blit_row(row, shifted, start_x, end_x, mode);
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef IMAGE_BLIT_H_
+#define IMAGE_BLIT_H_
+
+#include <stdint.h>
+
+typedef enum
+{
+  IMAGE_OPAQUE,           // every pixel is copied, like epd_copy_to_framebuffer
+  IMAGE_TRANSPARENT_WHITE // white (0xF) pixels leave the destination alone
+} ImageBlitMode;
+
+/**
+ * Copy a 4bpp image (rows of (width + 1) / 2 bytes, left pixel in the low
+ * nibble) to x, y in a 4bpp buffer that is buffer_width pixels wide (at
+ * most 1024) and holds rows first_row to first_row + rows - 1. Clipped on
+ * every side.
+ *
+ * At even x the image bytes line up with the buffer and opaque rows are
+ * copied with memcpy. At odd x every row is shifted by one nibble first.
+ * Only the nibbles at the ends of a row are merged one by one.
+ */
+void image_blit(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y,
+                const uint8_t *image, int width, int height, ImageBlitMode mode);
+
+#endif
@@ -0,0 +1,261 @@
+#include <Arduino.h>
+#include <time.h>
+
+#include <epd_driver.h>
+
+#include "frame_store.h"
+#include "layout.h"
+
+// Icons and fornts
+#include "opensans12b_lut.h"
+#include "opensans16b_lut.h"
+#include "opensans24b_lut.h"
+
+#include "temp_icon.h"
+#include "hum_icon.h"
+#include "pres_icon.h"
+#include "batt_icon.h"
+//#include "time_icon.h"
+
+#include "r_rect_icon.h"
+#include "background_img.h"
+
+uint8_t *fb;
+DisplayList *layout_list;
+
+// -- Record into layout_list when set, draw into fb unless band rendering left it NULL.
+// -- Constant strings pass bounds from font_measure_constant, NULL measures through the cache.
+static void write_text(const FontLookup *font, const char *text, int cursor_x, int cursor_y, EpdFontProperties *font_props,
+                       const TextBounds *bounds)
+{
+  if (layout_list)
+  {
+    display_list_add_text(layout_list, font, text, cursor_x, cursor_y, font_props->flags, bounds);
+  }
+  if (!fb)
+  {
+    return;
+  }
+  // -- Black on the white background takes the fast glyph path, anything else goes through epdiy.
+  if (font_props->fg_color == 0 && font_props->bg_color == 15 && !(font_props->flags & EPD_DRAW_BACKGROUND))
+  {
+    display_list_write_text(font, text, cursor_x, cursor_y, font_props->flags, bounds, fb);
+  }
+  else
+  {
+    epd_write_string(font->font, text, &cursor_x, &cursor_y, fb, font_props);
+  }
+}
+
+static void copy_image(int x, int y, const Icon *icon, ImageBlitMode mode)
+{
+  if (layout_list)
+  {
+    display_list_add_image(layout_list, x, y, icon, mode);
+  }
+  if (fb)
+  {
+    icon_blit(icon, fb, EPD_WIDTH, 0, EPD_HEIGHT, x, y, mode);
+  }
+}
+
+static int cursor_x;
+static int cursor_y;
+
+void draw_sensors_top(const char *sensor_text, int cursor_x, int cursor_y)
+{
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_CENTER;
+
+  write_text(&OpenSans24BLookup, sensor_text, cursor_x, cursor_y, &font_props, NULL);
+}
+
+void draw_sensors_frame(int cursor_x, int cursor_y)
+{
+  copy_image(cursor_x, cursor_y, &r_rect_icon, IMAGE_OPAQUE);
+}
+
+void draw_sensors_label(int img_cursor_x, int img_cursor_y, const Icon *icon, const char *label_text, const TextBounds *label_bounds,
+                        int text_cursor_x, int text_cursor_y)
+{
+  // -- Icons sit inside the frames, their white background is left out.
+  copy_image(img_cursor_x, img_cursor_y, icon, IMAGE_TRANSPARENT_WHITE);
+
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_LEFT;
+  cursor_x = text_cursor_x;
+  cursor_y = text_cursor_y;
+  write_text(&OpenSans16BLookup, label_text, cursor_x, cursor_y, &font_props, label_bounds);
+}
+
+void draw_sensors_value(const char *sensor_value, int cursor_x, int cursor_y)
+{
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_RIGHT;
+
+  write_text(&OpenSans16BLookup, sensor_value, cursor_x, cursor_y, &font_props, NULL);
+}
+
+void draw_sensors_datetime(const char *sensor_value, int cursor_x, int cursor_y)
+{
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_RIGHT;
+
+  write_text(&OpenSans12BLookup, sensor_value, cursor_x, cursor_y, &font_props, NULL);
+}
+
+void draw_bottom_battery(const char *battery_value, int cursor_x, int cursor_y)
+{
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_LEFT;
+
+  write_text(&OpenSans12BLookup, battery_value, cursor_x, cursor_y, &font_props, NULL);
+}
+
+/**
+ * Input time in epoch format and return tm time format
+ * by Renzo Mischianti <www.mischianti.org>
+ */
+static tm getDateTimeByParams(long time)
+{
+  struct tm *newtime;
+  const time_t tim = time;
+  newtime = localtime(&tim);
+  if (!newtime)
+  {
+    tm zero = {};
+    return zero;
+  }
+  return *newtime;
+}
+
+// -- Icon and unit label of each sensor row, the labels measured at compile time.
+typedef struct
+{
+  int y;
+  const Icon *icon;
+  const char *label;
+  TextBounds label_bounds;
+  int baseline;
+} SensorRow;
+
+static const SensorRow sensor_rows[] = {
+    {105, &temp_icon, " °C", font_measure_constant(OpenSans16BMetrics, " °C"), 148},
+    {175, &hum_icon, " %", font_measure_constant(OpenSans16BMetrics, " %"), 218},
+    {245, &pres_icon, " hpa", font_measure_constant(OpenSans16BMetrics, " hpa"), 288},
+    {315, &batt_icon, " V", font_measure_constant(OpenSans16BMetrics, " V"), 358},
+};
+
+void draw_static_layout_items()
+{
+  int x;
+  for (x = 10; x <= 650; x = x + 320)
+  {
+    draw_sensors_frame(x, 100);
+  }
+  x = 0;
+  for (x = 20; x <= 660; x = x + 320)
+  {
+    for (size_t row = 0; row < sizeof(sensor_rows) / sizeof(sensor_rows[0]); row++)
+    {
+      const SensorRow *sensor = &sensor_rows[row];
+      draw_sensors_label(x, sensor->y, sensor->icon, sensor->label, &sensor->label_bounds, x + 195, sensor->baseline);
+    }
+  }
+}
+
+void draw_static_layout()
+{
+  // -- Only record the items, the pixels come composited from background_img.h.
+  uint8_t *target = fb;
+  fb = NULL;
+  if (layout_list)
+  {
+    draw_static_layout_items();
+  }
+  fb = target;
+  if (fb)
+  {
+    frame_rle_decode(background_img_data, sizeof(background_img_data), fb, EPD_WIDTH * EPD_HEIGHT / 2);
+  }
+}
+
+void format_tag_text(const RuuviReading *reading, long local_time, TagText *text)
+{
+  dtostrf(reading->temperature / 100.0, 7, 2, text->values[0]);
+  dtostrf(reading->humidity / 100.0, 7, 2, text->values[1]);
+  dtostrf(reading->pressure * 0.01, 7, 2, text->values[2]);
+  dtostrf(reading->battery / 1000.0, 7, 2, text->values[3]);
+
+  // -- Straight into the fixed buffer, no heap String on every redraw.
+  tm newtime = getDateTimeByParams(local_time);
+  strftime(text->datetime, sizeof(text->datetime), "%d/%m/%y %H:%M:%S", &newtime);
+}
+
+// -- Tag names are cut to the width of the frame under them, at a whole character, and end in "...".
+#define TAG_NAME_MAX_WIDTH 300
+
+static void fit_tag_name(const char *name, char *out, size_t size)
+{
+  TextBounds bounds;
+  strlcpy(out, name, size);
+  font_measure(&OpenSans24BLookup, out, &bounds);
+  size_t length = strlen(out);
+  while (bounds.right - bounds.left > TAG_NAME_MAX_WIDTH && length > 0)
+  {
+    // -- Back to the lead byte of the last character, then over the spaces before it.
+    do
+    {
+      --length;
+    } while (length > 0 && ((uint8_t)out[length] & 0xC0) == 0x80);
+    while (length > 0 && out[length - 1] == ' ')
+    {
+      --length;
+    }
+    strlcpy(out + length, "...", size - length);
+    font_measure(&OpenSans24BLookup, out, &bounds);
+  }
+}
+
+void draw_tag_column(int tag, const RuuviReading *reading, long local_time)
+{
+  TagText text;
+  format_tag_text(reading, local_time, &text);
+  char name[RUUVI_NAME_LEN + 3];
+  fit_tag_name(reading->name, name, sizeof(name));
+
+  cursor_x = TAG_COLUMN_X(tag);
+  cursor_y = 60;
+  draw_sensors_top(name, cursor_x, 60);
+  draw_sensors_value(text.values[0], cursor_x + 55, 148);
+  draw_sensors_value(text.values[1], cursor_x + 55, 218);
+  draw_sensors_value(text.values[2], cursor_x + 55, 288);
+  draw_sensors_value(text.values[3], cursor_x + 55, 358);
+  draw_sensors_datetime(text.datetime, cursor_x + 100, 428);
+}
+
+void draw_tag_spread(int tag, const ReadingStats *stats)
+{
+  if (stats->count < 2)
+  {
+    return;
+  }
+  char text[40];
+  snprintf(text, sizeof(text), "%u readings, ±%.2f °C", (unsigned)stats->count, reading_stats_stddev(stats, READING_TEMPERATURE) / 100.0);
+
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_CENTER;
+  // -- Between the descenders of the name and the top of the frame.
+  write_text(&OpenSans12BLookup, text, TAG_COLUMN_X(tag), 92, &font_props, NULL);
+}
+
+void draw_timeout_message()
+{
+  EpdFontProperties font_props = epd_font_properties_default();
+  font_props.flags = EPD_DRAW_ALIGN_CENTER;
+  cursor_x = 480;
+  cursor_y = 270;
+
+  static constexpr TextBounds bounds = font_measure_constant(OpenSans16BMetrics, "Timeout: no ruuvitag data from MQTT!");
+  write_text(&OpenSans16BLookup, "Timeout: no ruuvitag data from MQTT!", cursor_x, cursor_y, &font_props, &bounds);
+}
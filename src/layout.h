@@ -0,0 +1,63 @@
+#ifndef LAYOUT_H_
+#define LAYOUT_H_
+
+#include <stdint.h>
+#include "ruuvi.h"
+#include "display_list.h"
+#include "icon.h"
+#include "reading_stats.h"
+
+// -- Horizontal center of a tag column.
+#define TAG_COLUMN_X(tag) (160 + 320 * (tag))
+
+// -- Framebuffer all drawing goes to.
+extern uint8_t *fb;
+// -- When set, the draw helpers also record into this list. Band rendering leaves fb NULL.
+extern DisplayList *layout_list;
+
+void draw_sensors_top(const char *sensor_text, int cursor_x, int cursor_y);
+void draw_sensors_frame(int cursor_x, int cursor_y);
+void draw_sensors_label(int img_cursor_x, int img_cursor_y, const Icon *icon, const char *label_text, const TextBounds *label_bounds,
+                        int text_cursor_x, int text_cursor_y);
+void draw_sensors_value(const char *sensor_value, int cursor_x, int cursor_y);
+void draw_sensors_datetime(const char *sensor_value, int cursor_x, int cursor_y);
+void draw_bottom_battery(const char *battery_value, int cursor_x, int cursor_y);
+
+/**
+ * Frames, icons and unit labels, the part that is the same on every wake,
+ * drawn one by one.
+ */
+void draw_static_layout_items();
+
+/**
+ * The same static layer expanded in one pass from the background composed
+ * at build time by tools/compose_background.py. Overwrites the whole
+ * framebuffer, so it has to come before anything else is drawn. The items
+ * are still recorded into layout_list.
+ */
+void draw_static_layout();
+
+// -- Formatted texts of one tag column: temperature, humidity, pressure, battery and time.
+typedef struct
+{
+  char values[4][32];
+  char datetime[32];
+} TagText;
+
+void format_tag_text(const RuuviReading *reading, long local_time, TagText *text);
+
+/**
+ * Name, values and measurement time of one tag. local_time is the
+ * timestamp already converted to the display time zone.
+ */
+void draw_tag_column(int tag, const RuuviReading *reading, long local_time);
+
+/**
+ * Number of averaged readings and the spread of the temperature, under
+ * the tag name. Nothing below two readings.
+ */
+void draw_tag_spread(int tag, const ReadingStats *stats);
+
+void draw_timeout_message();
+
+#endif
@@ -13,6 +13,8 @@
 #include "pins.h"
 // #include "driver/gpio.h"
 #include <esp_sleep.h>
+#include <esp_wifi.h>
+#include <esp_heap_caps.h>
 
 #include <Timezone.h>
 #include <MQTT.h>
@@ -30,18 +32,22 @@
 #include <epd_driver.h>
 #include <epd_highlevel.h>
 
-// Icons and fornts
-#include "opensans12b.h"
-#include "opensans16b.h"
-#include "opensans24b.h"
-
-#include "temp_img.h"
-#include "hum_img.h"
-#include "pres_img.h"
-#include "batt_img.h"
-//#include "time_img.h"
-
-#include "r_rect_img.h"
+#include "layout.h"
+#include "ruuvi.h"
+#include "ruuvi_raw.h"
+#include "ruuvi_payload.h"
+#include "sleep_clock.h"
+#include "sleep_policy.h"
+#include "battery_model.h"
+#include "telemetry.h"
+#include "chunked_writer.h"
+#include "snapshot.h"
+#include "fb_diff.h"
+#include "pipeline.h"
+#include "frame_store.h"
+#include "refresh_policy.h"
+#include "stream_scheduler.h"
+#include "reading_stats.h"
 
 #define uS_TO_S_FACTOR 1000000 /* Conversion factor for micro seconds to seconds */
 #define TIME_TO_SLEEP 60 * 30  /* Time ESP32 will go to sleep (in seconds) */
@@ -54,9 +60,10 @@ const char thingName[] = "testThing";
 const char wifiInitialApPassword[] = "smrtTHNG8266";
 
 #define STRING_LEN 128
+#define NUMBER_LEN 8
 
 // -- Configuration specific key. The value should be modified if config structure was changed.
-#define CONFIG_VERSION "mqt1"
+#define CONFIG_VERSION "mqt3"
 
 // -- When CONFIG_PIN is pulled to ground on startup, the Thing will use the initial
 //      password to buld an AP. (E.g. in case of lost password)
@@ -71,9 +78,14 @@ Battery18650Stats battery(BATT_PIN,1.79);
 
 // -- Method declarations.
 void handleRoot();
+void handleMetrics();
+void handleSnapshot();
 void mqttMessageReceived(MQTTClient *client, char topic[], char payload[], int payload_length);
 bool connectMqtt();
+void networkTask(void *parameter);
 bool connectMqttOptions();
+void drawStatusLine();
+void publishStatus();
 // -- Callback methods.
 void wifiConnected();
 void configSaved();
@@ -111,6 +123,20 @@ IotWebConfTextParameter ruuvitag1Param = IotWebConfTextParameter("Ruuvitag #1",
 IotWebConfTextParameter ruuvitag2Param = IotWebConfTextParameter("Ruuvitag #2", "ruuvitag2", ruuvitag2Value, STRING_LEN);
 IotWebConfTextParameter ruuvitag3Param = IotWebConfTextParameter("Ruuvitag #3", "ruuvitag3", ruuvitag3Value, STRING_LEN);
 
+// -- Always on mode for displays on USB power: no deep sleep, regions refresh as readings arrive.
+char alwaysOnValue[STRING_LEN];
+char coalesceMsValue[NUMBER_LEN];
+char refreshesPerMinuteValue[NUMBER_LEN];
+char fullRefreshMinutesValue[NUMBER_LEN];
+char showSpreadValue[STRING_LEN];
+
+IotWebConfParameterGroup displayGroup = IotWebConfParameterGroup("display", "Display");
+IotWebConfCheckboxParameter alwaysOnParam = IotWebConfCheckboxParameter("Always on (USB power)", "alwaysOn", alwaysOnValue, STRING_LEN, false);
+IotWebConfNumberParameter coalesceMsParam = IotWebConfNumberParameter("Coalesce window (ms)", "coalesceMs", coalesceMsValue, NUMBER_LEN, "2000", "0..60000", "min='0' max='60000' step='100'");
+IotWebConfNumberParameter refreshesPerMinuteParam = IotWebConfNumberParameter("Refreshes per minute", "refreshesPerMinute", refreshesPerMinuteValue, NUMBER_LEN, "6", "1..30", "min='1' max='30' step='1'");
+IotWebConfCheckboxParameter showSpreadParam = IotWebConfCheckboxParameter("Show spread of averaged readings", "showSpread", showSpreadValue, STRING_LEN, false);
+IotWebConfNumberParameter fullRefreshMinutesParam = IotWebConfNumberParameter("Full refresh every (min)", "fullRefreshMinutes", fullRefreshMinutesValue, NUMBER_LEN, "60", "0..1440", "min='0' max='1440' step='1'");
+
 bool needMqttConnect = false;
 bool needReset = false;
 int pinState = HIGH;
@@ -120,17 +146,63 @@ unsigned long lastMqttConnectionAttempt = 0;
 //const char *ruuvitags[] = {"ruuvitag/F9:81:78:B2:70:BE", "ruuvitag/ED:30:75:FE:CD:37", "ruuvitag/CD:8C:07:25:4B:54"};
 
 String ruuvitags[3];
-int ruuvitagIndex = 0;
 
-const char *ruuvi_name;
-const char *ruuvi_mac;
-float ruuvi_temperature;
-float ruuvi_humidity;
-long ruuvi_pressure;
-float ruuvi_batteryVoltage;
-unsigned long ruuvi_timestamp;
+RuuviReading readings[RUUVI_TAG_COUNT];
+// -- Readings averaged per tag while awake, and the averages behind the columns on the panel.
+ReadingStats tagStats[RUUVI_TAG_COUNT];
+ReadingStats shownStats[RUUVI_TAG_COUNT];
+
+// -- Parsed readings handed from the network task to the render loop.
+typedef struct
+{
+  int tag;
+  RuuviReading reading;
+} TagUpdate;
+
+SpscQueue<TagUpdate, 8> tagQueue;
+// -- Bit per tag: configured topics and columns drawn in this wake.
+volatile uint8_t expectedTags = 0;
+uint8_t drawnTags = 0;
+volatile bool networkStop = false;
+volatile bool networkStopped = false;
+PipelineHandle networkTaskHandle = NULL;
+// -- millis() when the radio was switched off during the sleep path, 0 while it is still up.
+volatile unsigned long radioOffMs = 0;
+PipelineHandle radioTeardownHandle = NULL;
+
+// -- Adaptive sleep interval, kept across deep sleep.
+RTC_DATA_ATTR SleepPolicyState sleepPolicy;
+// -- Battery discharge history and fit, kept across deep sleep.
+RTC_DATA_ATTR BatteryModel batteryModel;
+// -- Fast update counters and ghosting score per screen region.
+RTC_DATA_ATTR RefreshPolicyState refreshPolicy;
 
 bool enableSleep = false;
+bool alwaysOn = false;
+bool showSpread = false;
+StreamScheduler streamScheduler;
+
+// -- What the web handlers on core 0 show of the state loop() owns on core 1. loop() publishes
+// -- a copy whenever it changed any of it, the handlers format a copy of their own.
+typedef struct
+{
+  RuuviReading readings[RUUVI_TAG_COUNT];
+  uint32_t averaged[RUUVI_TAG_COUNT]; // readings behind each column on the panel
+  float spread[RUUVI_TAG_COUNT];      // their temperature standard deviation, 0.01 °C
+  uint32_t received_ms[RUUVI_TAG_COUNT];
+  FbDiff changed;
+  bool frame_restored;
+  FrameStoreStats frame_store;
+  RefreshPolicyState refresh_policy;
+  StreamScheduler stream;
+  int dropped;
+  uint32_t refreshes;
+} StatusSnapshot;
+
+portMUX_TYPE statusMux = portMUX_INITIALIZER_UNLOCKED;
+StatusSnapshot publishedStatus;
+// -- Held by loop() while it draws into the framebuffer and by /snapshot while it copies it.
+SemaphoreHandle_t frameLock = NULL;
 
 StaticJsonDocument<768> doc;
 
@@ -141,11 +213,13 @@ EpdiyHighlevelState hl;
 // ambient temperature around device
 int ambient_temperature = 21;
 
-int cursor_x;
-int cursor_y;
-
-uint8_t *fb;
 enum EpdDrawError err;
+// -- The back buffer holds the frame stored before the last sleep, so only changed pixels are driven.
+bool frameRestored = false;
+// -- Everything drawn in this wake, and what the panel showed after the last refresh.
+DisplayList displayList;
+RTC_DATA_ATTR DisplaySummary displaySummary;
+DirtyRects dirtyRects;
 
 // CHOOSE HERE YOU IF YOU WANT PORTRAIT OR LANDSCAPE
 // both orientations possible
@@ -158,70 +232,11 @@ const int dstOffset = 3600; // kesäajan tunnin siirtymä
 const int stdOffset = 0;    // talviajan tunnin siirtymä
 
 float esp_battery_voltage;
+int esp_battery_level;
+float esp_battery_days;
 
 /*End of E-Paper*/
 
-void draw_sensors_top(const char *sensor_text, int cursor_x, int cursor_y)
-{
-  EpdFontProperties font_props = epd_font_properties_default();
-  font_props.flags = EPD_DRAW_ALIGN_CENTER;
-
-  epd_write_string(&OpenSans24B, sensor_text, &cursor_x, &cursor_y, fb, &font_props);
-}
-
-void draw_sensors_frame(int cursor_x, int cursor_y, int width, int height)
-{
-  EpdRect r_rect_img_area = {
-      .x = cursor_x,
-      .y = cursor_y,
-      .width = width,
-      .height = height,
-  };
-  epd_copy_to_framebuffer(r_rect_img_area, (uint8_t *)r_rect_img_data, fb);
-}
-
-void draw_sensors_label(int img_cursor_x, int img_cursor_y, int img_width, int img_height, const uint8_t *img_data, const char *label_text, int text_cursor_x, int text_cursor_y)
-{
-  EpdRect img_area = {
-      .x = img_cursor_x,
-      .y = img_cursor_y,
-      .width = img_width,
-      .height = img_height,
-  };
-
-  epd_copy_to_framebuffer(img_area, (uint8_t *)img_data, fb);
-
-  EpdFontProperties font_props = epd_font_properties_default();
-  font_props.flags = EPD_DRAW_ALIGN_LEFT;
-  cursor_x = text_cursor_x;
-  cursor_y = text_cursor_y;
-  epd_write_string(&OpenSans16B, label_text, &cursor_x, &cursor_y, fb, &font_props);
-}
-
-void draw_sensors_value(const char *sensor_value, int cursor_x, int cursor_y)
-{
-  EpdFontProperties font_props = epd_font_properties_default();
-  font_props.flags = EPD_DRAW_ALIGN_RIGHT;
-
-  epd_write_string(&OpenSans16B, sensor_value, &cursor_x, &cursor_y, fb, &font_props);
-}
-
-void draw_sensors_datetime(const char *sensor_value, int cursor_x, int cursor_y)
-{
-  EpdFontProperties font_props = epd_font_properties_default();
-  font_props.flags = EPD_DRAW_ALIGN_RIGHT;
-
-  epd_write_string(&OpenSans12B, sensor_value, &cursor_x, &cursor_y, fb, &font_props);
-}
-
-void draw_bottom_battery(const char *battery_value, int cursor_x, int cursor_y)
-{
-  EpdFontProperties font_props = epd_font_properties_default();
-  font_props.flags = EPD_DRAW_ALIGN_LEFT;
-
-  epd_write_string(&OpenSans12B, battery_value, &cursor_x, &cursor_y, fb, &font_props);
-}
-
 void setup()
 {
   delay(500);
@@ -231,35 +246,54 @@ void setup()
   Serial.println("Starting up...");
   //
 
+  telemetry_wake();
+  sleep_clock_wake();
+  sleep_policy_init(&sleepPolicy, TIME_TO_SLEEP);
+  uint32_t elapsed_s = sleep_policy_wake(&sleepPolicy, (uint32_t)sleep_clock_slept_s());
+  refresh_policy_init(&refreshPolicy);
+
   // First setup epd to use later
   epd_init(EPD_OPTIONS_DEFAULT);
+  display_list_clear(&displayList);
+  layout_list = &displayList;
+#ifdef WEATHER_BAND_RENDER
+  // -- No framebuffers, the frame is recorded and drawn band by band before sleeping.
+  epd_set_rotation(orientation);
+#else
   hl = epd_hl_init(WAVEFORM);
   epd_set_rotation(orientation);
   fb = epd_hl_get_framebuffer(&hl);
   epd_hl_set_all_white(&hl);
+  frameRestored = frame_store_begin() && frame_store_load(hl.back_fb, EPD_WIDTH * EPD_HEIGHT / 2);
+  if (!frameRestored)
+  {
+    memset(hl.back_fb, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+  }
+  Serial.print("Frame restore: ");
+  Serial.print(frameRestored ? "ok" : "none");
+  Serial.print(" in ");
+  Serial.print(frame_store_stats.restore_us);
+  Serial.println(" us");
+#endif
+  // -- Expanding the background overwrites the framebuffer, so it goes first.
+  uint32_t layoutStarted = micros();
+  draw_static_layout();
+  Serial.print("Static layout: ");
+  Serial.print(micros() - layoutStarted);
+  Serial.println(" us");
 
   Serial.print("Battery: ");
   Serial.println(battery.getBatteryChargeLevel());
-  String batt_buff = "Battery: " + String(battery.getBatteryChargeLevel(true)) + "% " + String(battery.getBatteryVolts()) + " V";
   esp_battery_voltage = battery.getBatteryVolts();
-  char buff[32];
-  batt_buff.toCharArray(buff, batt_buff.length() + 1);
-  draw_bottom_battery(buff, 20, 520);
+  esp_battery_level = battery.getBatteryChargeLevel(true);
+  ambient_temperature = epd_ambient_temperature();
+  // -- The time actually spent away, not the interval asked for, which alignment or a timeout changes.
+  battery_model_update(&batteryModel, esp_battery_voltage, ambient_temperature, elapsed_s / 3600.0f);
+  esp_battery_days = battery_model_days_left(&batteryModel);
+
+  drawStatusLine();
 
   epd_poweroff();
-  int x;
-  for (x = 10; x <= 650; x = x + 320)
-  {
-    draw_sensors_frame(x, 100, 300, 350);
-  }
-  x = 0;
-  for (x = 20; x <= 660; x = x + 320)
-  {
-    draw_sensors_label(x, 105, 60, 60, temp_img_data, " °C", x + 195, 148);
-    draw_sensors_label(x, 175, 60, 60, hum_img_data, " %", x + 195, 218);
-    draw_sensors_label(x, 245, 60, 60, pres_img_data, " hpa", x + 195, 288);
-    draw_sensors_label(x, 315, 60, 60, batt_img_data, " V", x + 195, 358);
-  }
 
   mqttGroup.addItem(&mqttServerParam);
   mqttGroup.addItem(&mqttUserNameParam);
@@ -267,11 +301,17 @@ void setup()
   ruuviGroup.addItem(&ruuvitag1Param);
   ruuviGroup.addItem(&ruuvitag2Param);
   ruuviGroup.addItem(&ruuvitag3Param);
+  displayGroup.addItem(&alwaysOnParam);
+  displayGroup.addItem(&coalesceMsParam);
+  displayGroup.addItem(&refreshesPerMinuteParam);
+  displayGroup.addItem(&fullRefreshMinutesParam);
+  displayGroup.addItem(&showSpreadParam);
 
   // iotWebConf.setStatusPin(STATUS_PIN);
   iotWebConf.setConfigPin(CONFIG_PIN);
   iotWebConf.addParameterGroup(&mqttGroup);
   iotWebConf.addParameterGroup(&ruuviGroup);
+  iotWebConf.addParameterGroup(&displayGroup);
   iotWebConf.setConfigSavedCallback(&configSaved);
   iotWebConf.setFormValidator(&formValidator);
   iotWebConf.setWifiConnectionCallback(&wifiConnected);
@@ -292,8 +332,27 @@ void setup()
   ruuvitags[1] = ruuvitag2Value;
   ruuvitags[2] = ruuvitag3Value;
 
+  alwaysOn = alwaysOnParam.isChecked();
+  showSpread = showSpreadParam.isChecked();
+  if (alwaysOn)
+  {
+    StreamConfig streamConfig = {
+        .coalesce_ms = (uint32_t)atoi(coalesceMsValue),
+        .max_per_minute = (uint32_t)atoi(refreshesPerMinuteValue),
+        .full_refresh_ms = (uint32_t)atoi(fullRefreshMinutesValue) * 60000,
+    };
+    stream_scheduler_init(&streamScheduler, &streamConfig, millis());
+    // -- The frame drawn in setup goes to the panel with the first poll.
+    stream_scheduler_mark(&streamScheduler, millis());
+    Serial.println("Always on mode");
+  }
+
   // -- Set up required URL handlers on the web server.
   server.on("/", handleRoot);
+  server.on("/status", handleRoot);
+  server.on("/metrics", handleMetrics);
+  server.on("/snapshot.pgm", handleSnapshot);
+  server.on("/snapshot.png", handleSnapshot);
   server.on("/config", []
             { iotWebConf.handleConfig(); });
   server.onNotFound([]()
@@ -303,171 +362,480 @@ void setup()
   mqttClient.onMessageAdvanced(mqttMessageReceived);
 
   Serial.println("Ready.");
+  telemetry_mark(PHASE_SETUP);
+
+  // -- Networking moves to core 0, loop() keeps rendering on core 1.
+  frameLock = xSemaphoreCreateMutex();
+  publishStatus();
+  pipeline_start(networkTask, "network", 8192, NULL, 0, &networkTaskHandle);
 }
 
-/**
- * Input time in epoch format and return tm time format
- * by Renzo Mischianti <www.mischianti.org>
- */
-static tm getDateTimeByParams(long time)
+// -- Copy what the web handlers show. Called on core 1 after changing any of it.
+void publishStatus()
+{
+  StatusSnapshot status;
+  for (int i = 0; i < RUUVI_TAG_COUNT; i++)
+  {
+    status.readings[i] = readings[i];
+    status.averaged[i] = shownStats[i].count;
+    status.spread[i] = reading_stats_stddev(&shownStats[i], READING_TEMPERATURE);
+    status.received_ms[i] = telemetry.tag_received_ms[i];
+  }
+  status.changed = telemetry.changed;
+  status.frame_restored = frameRestored;
+  status.frame_store = frame_store_stats;
+  status.refresh_policy = refreshPolicy;
+  status.stream = streamScheduler;
+  status.dropped = displayList.dropped;
+  status.refreshes = telemetry_counters.refreshes;
+  portENTER_CRITICAL(&statusMux);
+  publishedStatus = status;
+  portEXIT_CRITICAL(&statusMux);
+}
+
+void readStatus(StatusSnapshot *status)
 {
-  struct tm *newtime;
-  const time_t tim = time;
-  newtime = localtime(&tim);
-  return *newtime;
+  portENTER_CRITICAL(&statusMux);
+  *status = publishedStatus;
+  portEXIT_CRITICAL(&statusMux);
 }
 
-/**
- * Input tm time format and return String with format pattern
- * by Renzo Mischianti <www.mischianti.org>
- */
-static String getDateTimeStringByParams(tm *newtime, char *pattern = (char *)"%d/%m/%Y %H:%M:%S")
+// -- Battery line along the bottom. No String, the always on mode redraws it without allocating.
+void drawStatusLine()
+{
+  char buff[48];
+  int length = snprintf(buff, sizeof(buff), "Battery: %d%% %.2f V", esp_battery_level, esp_battery_voltage);
+  if (esp_battery_days >= 0 && length > 0 && length < (int)sizeof(buff))
+  {
+    snprintf(buff + length, sizeof(buff) - length, "  ~%.0f days", esp_battery_days);
+  }
+  draw_bottom_battery(buff, 20, 520);
+}
+
+// -- Runs pinned to core 0 and owns WiFi, the web server and MQTT.
+void networkTask(void *parameter)
 {
-  char buffer[30];
-  strftime(buffer, 30, pattern, newtime);
-  return buffer;
+  while (!networkStop)
+  {
+    // -- doLoop should be called as frequently as possible.
+    iotWebConf.doLoop();
+    mqttClient.loop();
+
+    if (needMqttConnect)
+    {
+      if (connectMqtt())
+      {
+        needMqttConnect = false;
+      }
+    }
+    else if ((iotWebConf.getState() == iotwebconf::OnLine) && (!mqttClient.connected()))
+    {
+      Serial.println("MQTT reconnect");
+      connectMqtt();
+    }
+
+    if (needReset)
+    {
+      Serial.println("Rebooting after 1 second.");
+      iotWebConf.delay(1000);
+      ESP.restart();
+    }
+    vTaskDelay(1);
+  }
+  // -- Parked rather than deleted, stopNetwork() deletes it so that happens exactly once.
+  networkStopped = true;
+  vTaskSuspend(NULL);
 }
 
 /**
- * Input time in epoch format format and return String with format pattern
- * by Renzo Mischianti <www.mischianti.org>
+ * Ask the network task to finish its current iteration and wait at most
+ * timeout_ms for it. A task still busy after that (stuck in a connect) is
+ * deleted, so nothing uses the WiFi or MQTT clients once this returns.
+ * Returns false when it had to be deleted.
  */
-static String getEpochStringByParams(long time, char *pattern = (char *)"%d/%m/%Y %H:%M:%S")
+bool stopNetwork(unsigned long timeout_ms)
 {
-  //    struct tm *newtime;
-  tm newtime;
-  newtime = getDateTimeByParams(time);
-  return getDateTimeStringByParams(&newtime, pattern);
+  networkStop = true;
+  unsigned long started = millis();
+  while (!networkStopped && millis() - started < timeout_ms)
+  {
+    delay(1);
+  }
+  bool stopped = networkStopped;
+  if (networkTaskHandle)
+  {
+    vTaskDelete(networkTaskHandle);
+    networkTaskHandle = NULL;
+  }
+  return stopped;
 }
 
-void loop()
+void radioTeardown()
+{
+  mqttClient.disconnect();
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+  radioOffMs = millis();
+}
+
+// -- Shuts the radio down on core 0 while the panel is refreshed on core 1, then parks until deleted.
+void radioTeardownTask(void *parameter)
 {
-  // -- doLoop should be called as frequently as possible.
-  iotWebConf.doLoop();
-  mqttClient.loop();
+  radioTeardown();
+  vTaskSuspend(NULL);
+}
 
-  if (needMqttConnect)
+// -- Update each region that changed, fast while ghosting stays acceptable and clean otherwise.
+// -- dirty limits the comparison to the widgets that changed, NULL compares whole regions.
+void refreshRegions(const DirtyRects *dirty)
+{
+  for (int i = 0; i < REFRESH_REGION_COUNT; i++)
   {
-    if (connectMqtt())
+    const RefreshRegion *region = &refresh_regions[i];
+    EpdRect area = {
+        .x = region->x,
+        .y = region->y,
+        .width = region->width,
+        .height = region->height,
+    };
+    EpdRect changed = area;
+    if (dirty)
+    {
+      int parts = 0;
+      for (int j = 0; j < dirty->count; j++)
+      {
+        EpdRect part;
+        if (display_rect_intersect(dirty->rects[j], area, &part))
+        {
+          changed = parts++ ? display_rect_union(changed, part) : part;
+        }
+      }
+      if (parts == 0)
+      {
+        continue;
+      }
+    }
+    FbDiff diff = fb_diff_area(hl.front_fb, hl.back_fb, EPD_WIDTH, changed.x, changed.y, changed.width, changed.height, 0);
+    RefreshAction action = refresh_policy_decide(&refreshPolicy, i, diff.pixels, ambient_temperature);
+    if (action == REFRESH_CLEAN)
     {
-      needMqttConnect = false;
+      // -- The panel is white there now, the back buffer has to agree before the GC16 pass.
+      epd_clear_area(area);
+      for (int y = region->y; y < region->y + region->height; y++)
+      {
+        memset(hl.back_fb + y * EPD_WIDTH / 2 + region->x / 2, 0xFF, region->width / 2);
+      }
+      err = epd_hl_update_area(&hl, MODE_GC16, ambient_temperature, area);
     }
+    else if (action == REFRESH_FAST)
+    {
+      err = epd_hl_update_area(&hl, MODE_GL16, ambient_temperature, changed);
+    }
+  }
+}
+
+// -- Bring the panel up to date with the new frame, then store what it shows.
+// -- clean redraws the whole panel with GC16, persist saves the frame for the next wake.
+void refreshPanel(bool clean, bool persist)
+{
+  if (displayList.dropped)
+  {
+    Serial.print("Display list full, dropped ");
+    Serial.print(displayList.dropped);
+    Serial.println(" items");
+  }
+#ifdef WEATHER_BAND_RENDER
+  // -- Nothing to persist, the panel is described by the RTC summary alone.
+  (void)persist;
+  epd_poweron();
+  ambient_temperature = epd_ambient_temperature();
+  unsigned long refresh_started = millis();
+  // -- Only the widgets that differ from the last frame are cleared and rasterized again.
+  if (!clean && display_summary_valid(&displaySummary))
+  {
+    display_list_diff(&displaySummary, &displayList, &dirtyRects);
+    for (int i = 0; i < dirtyRects.count && err == EPD_DRAW_SUCCESS; i++)
+    {
+      epd_clear_area(dirtyRects.rects[i]);
+      err = display_list_draw_area(&displayList, dirtyRects.rects[i]);
+    }
+  }
+  else
+  {
+    dirtyRects.count = -1;
+    epd_clear();
+    err = display_list_draw(&displayList);
   }
-  else if ((iotWebConf.getState() == iotwebconf::OnLine) && (!mqttClient.connected()))
+  epd_poweroff();
+  refresh_policy_record(&refreshPolicy, millis() - refresh_started);
+  // -- A failed draw leaves the panel unknown, start from a clean panel next time.
+  display_list_summarize(&displayList, &displaySummary);
+  if (err != EPD_DRAW_SUCCESS)
   {
-    Serial.println("MQTT reconnect");
-    connectMqtt();
+    displaySummary.magic = 0;
   }
+  Serial.print("Band refresh: ");
+  Serial.print(displayList.count);
+  Serial.print(" items, ");
+  Serial.print(dirtyRects.count);
+  Serial.print(" dirty rects in ");
+  Serial.print(millis() - refresh_started);
+  Serial.println(" ms");
+#else
+  // -- Let the high voltage rails come up while the frame is compared.
+  epd_poweron();
+  telemetry.changed = fb_diff(hl.front_fb, hl.back_fb, EPD_WIDTH, EPD_HEIGHT, 0);
+  Serial.print("Changed: ");
+  Serial.print(telemetry.changed.pixels);
+  Serial.print(" px in ");
+  Serial.print(telemetry.changed.width);
+  Serial.print("x");
+  Serial.println(telemetry.changed.height);
+  ambient_temperature = epd_ambient_temperature();
+  unsigned long refresh_started = millis();
+  if (clean || !frameRestored)
+  {
+    epd_clear();
+    // -- The whole panel is white now, the back buffer has to agree before the GC16 pass.
+    memset(hl.back_fb, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    err = epd_hl_update_screen(&hl, MODE_GC16, ambient_temperature);
+    refresh_policy_cleaned_all(&refreshPolicy);
+    // -- The back buffer now matches the panel, later refreshes can diff against it.
+    frameRestored = true;
+  }
+  else if (display_summary_valid(&displaySummary))
+  {
+    display_list_diff(&displaySummary, &displayList, &dirtyRects);
+    Serial.print("Dirty rects: ");
+    Serial.println(dirtyRects.count);
+    refreshRegions(&dirtyRects);
+  }
+  else
+  {
+    refreshRegions(NULL);
+  }
+  epd_poweroff();
+  refresh_policy_record(&refreshPolicy, millis() - refresh_started);
+  Serial.print("Refresh: ");
+  Serial.print(millis() - refresh_started);
+  Serial.print(" ms, average ");
+  Serial.print(refresh_policy_average_ms(&refreshPolicy), 0);
+  Serial.println(" ms");
+  // -- The summary describes the stored frame, without it the next diff would be wrong.
+  display_list_summarize(&displayList, &displaySummary);
+  if (!persist)
+  {
+    return;
+  }
+  if (!frame_store_save(hl.back_fb, EPD_WIDTH * EPD_HEIGHT / 2))
+  {
+    displaySummary.magic = 0;
+  }
+  Serial.print("Frame store: ");
+  Serial.print(frame_store_stats.save_skipped ? "unchanged" : "saved");
+  Serial.print(", ");
+  Serial.print(frame_store_stats.stored_bytes);
+  Serial.print(" bytes in ");
+  Serial.print(frame_store_stats.save_us);
+  Serial.println(" us");
+#endif
+}
 
-  if (needReset)
+// -- Draw the average of what arrived for tag and keep it for the status page.
+void drawAveragedTag(int tag)
+{
+  shownStats[tag] = tagStats[tag];
+  reading_stats_mean(&shownStats[tag], &readings[tag]);
+  readings[tag].valid = true;
+  draw_tag_column(tag, &readings[tag], EE.toLocal(readings[tag].timestamp));
+  if (showSpread)
   {
-    Serial.println("Rebooting after 1 second.");
-    iotWebConf.delay(1000);
-    ESP.restart();
+    draw_tag_spread(tag, &shownStats[tag]);
   }
+}
 
-  // mqttClient.subscribe(ruuvitags[ruuvitagIndex]);
-  ruuvi_pressure = doc["pressure"];
+// -- Always on mode: take in readings as they arrive, redraw and refresh when the scheduler says so.
+void streamLoop()
+{
+  TagUpdate update;
+  bool idle = true;
+  while (tagQueue.pop(update))
+  {
+    idle = false;
+    reading_stats_add(&tagStats[update.tag], &update.reading, millis());
+    telemetry.tag_received_ms[update.tag] = millis();
+    stream_scheduler_mark(&streamScheduler, millis());
+  }
 
-  if (ruuvi_pressure != 0)
+  StreamAction action = stream_scheduler_poll(&streamScheduler, millis());
+  if (action == STREAM_IDLE)
   {
-    String str;
-    ruuvi_name = doc["name"];
-    ruuvi_mac = doc["mac"];
-    ruuvi_temperature = doc["temperature"];
-    ruuvi_humidity = doc["humidity"];
-    ruuvi_batteryVoltage = doc["batteryVoltage"];
-    ruuvi_timestamp = doc["timestamp"];
+    if (idle)
+    {
+      delay(1);
+    }
+    else
+    {
+      publishStatus();
+    }
+    return;
+  }
 
-    switch (ruuvitagIndex)
+  // -- The frame is rebuilt from the background, the diff against the panel picks the regions.
+  unsigned long started = millis();
+  xSemaphoreTake(frameLock, portMAX_DELAY);
+  display_list_clear(&displayList);
+  draw_static_layout();
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    // -- Everything since the previous refresh is averaged, the coalesce window is the collection window.
+    if (tagStats[tag].count)
     {
-    case 0:
-      cursor_x = 160;
-      break;
+      drawAveragedTag(tag);
+      reading_stats_reset(&tagStats[tag]);
+    }
+    else if (readings[tag].valid)
+    {
+      draw_tag_column(tag, &readings[tag], EE.toLocal(readings[tag].timestamp));
+      if (showSpread)
+      {
+        draw_tag_spread(tag, &shownStats[tag]);
+      }
+    }
+  }
+  drawStatusLine();
+  refreshPanel(action == STREAM_FULL, false);
+  xSemaphoreGive(frameLock);
+  ++telemetry_counters.refreshes;
+  publishStatus();
+  Serial.print(action == STREAM_FULL ? "Full refresh" : "Refresh");
+  Serial.print(" in ");
+  Serial.print(millis() - started);
+  Serial.print(" ms, heap free ");
+  Serial.println(ESP.getFreeHeap());
+}
 
-    case 1:
-      cursor_x = 480;
-      break;
+// -- The Arduino loop task runs on core 1 and does the rendering.
+void loop()
+{
+  if (alwaysOn)
+  {
+    streamLoop();
+    return;
+  }
 
-    case 2:
-      cursor_x = 800;
-      break;
+  TagUpdate update;
+  bool idle = true;
+  while (tagQueue.pop(update))
+  {
+    idle = false;
+    int tag = update.tag;
+    if (drawnTags & (1 << tag))
+    {
+      continue;
     }
-    cursor_y = 60;
-    draw_sensors_top(ruuvi_name, cursor_x, 60);
-
-    char buff[32];
-    dtostrf(ruuvi_temperature, 7, 2, buff);
-    draw_sensors_value(buff, cursor_x + 55, 148);
-    dtostrf(ruuvi_humidity, 7, 2, buff);
-    draw_sensors_value(buff, cursor_x + 55, 218);
-    dtostrf(ruuvi_pressure * 0.01, 7, 2, buff);
-    draw_sensors_value(buff, cursor_x + 55, 288);
-    dtostrf(ruuvi_batteryVoltage, 7, 2, buff);
-    draw_sensors_value(buff, cursor_x + 55, 358);
-
-    char timeformat[] = "%d/%m/%y %H:%M:%S";
-    String time_buff = getEpochStringByParams(EE.toLocal(ruuvi_timestamp),timeformat);
-    time_buff.toCharArray(buff,time_buff.length()+ 1);
-    draw_sensors_datetime(buff, cursor_x + 100, 428);
-    // if (isDST(t)) {
-    //   adjustTime(dstOffset); // siirrä aikaa kesäajan mukaisesti
-    // } else {
-    //   adjustTime(stdOffset); // siirrä aikaa talviajan mukaisesti
-    // }
-
-    // draw_sensors_value(t, cursor_x + 55, 428);
-
-    // String buff = getEpochStringByParams(EE.toLocal(ruuvi_timestamp),"%d/%m/%y %H:%M:%S");
-
-    // Serial.println(ruuvi_name);
-    // Serial.println(str + "temperature " + ruuvi_temperature + " C");
-    // Serial.println(str + "humidity " + ruuvi_humidity + " %");
-    // Serial.println(str + "pressure " + ruuvi_pressure + " hPa");
-    // Serial.println(str + "battery " + ruuvi_batteryVoltage + " V");
-    // Serial.println("-----------------");
-
-    doc.clear();
+    reading_stats_add(&tagStats[tag], &update.reading, millis());
+    telemetry.tag_received_ms[tag] = millis();
+  }
 
-    if (ruuvitagIndex < 2)
+  // -- A tag is averaged until its window runs out or the last expected tag has arrived,
+  // -- so the wake never lasts longer than it would with single readings.
+  uint8_t seenTags = 0;
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    if (tagStats[tag].count)
     {
-      mqttClient.unsubscribe(ruuvitags[ruuvitagIndex]);
-      ++ruuvitagIndex;
-      mqttClient.subscribe(ruuvitags[ruuvitagIndex]);
+      seenTags |= 1 << tag;
     }
-    else
+  }
+  bool allSeen = expectedTags && (seenTags & expectedTags) == expectedTags;
+  bool changed = !idle;
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    if ((drawnTags & (1 << tag)) || !(seenTags & (1 << tag)))
+    {
+      continue;
+    }
+    if (allSeen || reading_stats_window_closed(&tagStats[tag], millis()))
     {
-      enableSleep = true;
+      xSemaphoreTake(frameLock, portMAX_DELAY);
+      drawAveragedTag(tag);
+      xSemaphoreGive(frameLock);
+      sleep_policy_observe(&sleepPolicy, tag, &readings[tag]);
+      drawnTags |= 1 << tag;
+      changed = true;
     }
   }
-  // else
-  // {
-  //   mqttClient.subscribe(ruuvitags[ruuvitagIndex]);
-  // }
+  if (changed)
+  {
+    publishStatus();
+  }
+  if (allSeen && !enableSleep)
+  {
+    enableSleep = true;
+    telemetry_mark(PHASE_DATA);
+  }
 
   if (enableSleep || (millis() >  3*60*1000))
   {
+    if (!stopNetwork(2000))
+    {
+      Serial.println("Network task did not stop, deleted it");
+    }
+    unsigned long teardown_started = millis();
+#ifdef WEATHER_SEQUENTIAL_TEARDOWN
+    // -- Measurement build: the radio is down before the refresh starts, to time the wake
+    // -- without the overlap instead of estimating it.
+    radioTeardown();
+#else
+    if (!pipeline_start(radioTeardownTask, "radio_off", 4096, NULL, 0, &radioTeardownHandle))
+    {
+      radioTeardownHandle = NULL;
+      radioTeardown();
+    }
+#endif
     if (millis() > 3*60*1000) {
+      display_list_clear(&displayList);
+#ifndef WEATHER_BAND_RENDER
       epd_hl_set_all_white(&hl);
-      EpdFontProperties font_props = epd_font_properties_default();
-      font_props.flags = EPD_DRAW_ALIGN_CENTER;
-      cursor_x = 480;
-      cursor_y = 270;
-      
-      epd_write_string(&OpenSans16B, "Timeout: no ruuvitag data from MQTT!", &cursor_x, &cursor_y, fb, &font_props);
+#endif
+      draw_timeout_message();
+      ++telemetry_counters.timeouts;
       Serial.print("Timeout: ");
       Serial.println(millis());
     }
-    WiFi.disconnect();
-    epd_poweron();
-    epd_clear();
-    ambient_temperature = epd_ambient_temperature();
-    EpdDrawError err = epd_hl_update_screen(&hl, MODE_GC16, ambient_temperature);
-    epd_poweroff();
+    unsigned long refresh_started = millis();
+    refreshPanel(false, true);
+    uint32_t refresh_ms = millis() - refresh_started;
+    ++telemetry_counters.refreshes;
+    telemetry_mark(PHASE_REFRESH);
     Serial.print("Time passed: ");
     Serial.print(millis());
     Serial.println(" ms");
     epd_deinit();
+
+    // -- The radio has had the whole refresh to go down. If it has not, the teardown task is
+    // -- deleted before the driver is stopped so the two never run into each other.
+    while (radioOffMs == 0 && millis() - teardown_started < 1000)
+    {
+      delay(1);
+    }
+    if (radioTeardownHandle)
+    {
+      vTaskDelete(radioTeardownHandle);
+      radioTeardownHandle = NULL;
+    }
+    uint32_t teardown_ms;
+    if (radioOffMs == 0)
+    {
+      Serial.println("Radio teardown timed out, forcing WiFi off");
+      esp_wifi_stop();
+      teardown_ms = millis() - teardown_started;
+    }
+    else
+    {
+      teardown_ms = radioOffMs - teardown_started;
+    }
     
     gpio_reset_pin(GPIO_NUM_0);
     gpio_reset_pin(GPIO_NUM_2);
@@ -488,14 +856,39 @@ void loop()
     gpio_reset_pin(GPIO_NUM_38);
     gpio_reset_pin(GPIO_NUM_39);
     
+    battery_model_sleep(&batteryModel, millis());
+    uint32_t sleep_s = sleep_policy_interval(&sleepPolicy, TIME_TO_SLEEP, esp_battery_level, millis());
+    Serial.print("Next sleep: ");
+    Serial.print(sleep_s);
+    Serial.print(" s, projected battery life: ");
+    Serial.print(sleep_policy_battery_days(&sleepPolicy, esp_battery_level), 1);
+    Serial.println(" days");
+
+#ifdef WEATHER_SEQUENTIAL_TEARDOWN
+    telemetry_sleep(millis(), refresh_ms, teardown_ms, true);
+    const WakeTiming *timing = &telemetry_counters.last_wake;
+    Serial.printf("Awake %u ms: radio teardown %u ms, then refresh %u ms, measured one after the other\n",
+                  timing->awake_ms, timing->teardown_ms, timing->refresh_ms);
+#else
+    telemetry_sleep(millis(), refresh_ms, teardown_ms, false);
+    const WakeTiming *timing = &telemetry_counters.last_wake;
+    Serial.printf("Awake %u ms: refresh %u ms, radio teardown %u ms next to it, ~%u ms if run one after the other\n",
+                  timing->awake_ms, timing->refresh_ms, timing->teardown_ms, telemetry_sequential_ms(timing));
+#endif
+
     Serial.println("Time to sleep");
-    esp_sleep_enable_timer_wakeup(TIME_TO_SLEEP * uS_TO_S_FACTOR);
+    // -- Only the fixed interval is aligned to the clock, an adaptive one is slept as chosen.
+    esp_sleep_enable_timer_wakeup(sleep_clock_sleep_us(sleep_s, sleep_s == TIME_TO_SLEEP));
     esp_deep_sleep_start();
   }
+  if (idle)
+  {
+    delay(1);
+  }
 }
 
 /**
- * Handle web requests to "/" path.
+ * Handle web requests to "/" and "/status" paths.
  */
 void handleRoot()
 {
@@ -505,21 +898,237 @@ void handleRoot()
     // -- Captive portal request were already served.
     return;
   }
-  String s = "<!DOCTYPE html><html lang=\"en\"><head><meta name=\"viewport\" content=\"width=device-width, initial-scale=1, user-scalable=no\"/>";
-  s += "<title>IotWebConf 06 MQTT App</title></head><body>MQTT App demo";
-  s += "<ul>";
-  s += "<li>MQTT server: ";
-  s += mqttServerValue;
-  s += "</li>";
-  s += "</ul>";
-  s += "Go to <a href='config'>configure page</a> to change values.";
-  s += "</body></html>\n";
-
-  server.send(200, "text/html", s);
+  // -- Only the network task serves requests, one at a time, so the copy need not be on its stack.
+  static StatusSnapshot status;
+  readStatus(&status);
+  ChunkedWriter out(server);
+  out.begin("text/html");
+  out.print("<!DOCTYPE html><html lang=\"en\"><head><meta name=\"viewport\" content=\"width=device-width, initial-scale=1, user-scalable=no\"/>");
+  out.print("<title>Weather display status</title></head><body><h3>Weather display</h3>");
+  out.print("<ul><li>MQTT server: ");
+  out.html(mqttServerValue);
+  out.printf("</li><li>MQTT connected: %s</li></ul>", mqttClient.connected() ? "yes" : "no");
+
+  out.print("<table border=1><tr><th>#</th><th>Topic</th><th>Name</th><th>&deg;C</th><th>%</th><th>hPa</th><th>V</th><th>Age s</th><th>Received ms</th><th>Readings</th><th>&plusmn;&deg;C</th></tr>");
+  time_t now = time(NULL);
+  for (int i = 0; i < RUUVI_TAG_COUNT; i++)
+  {
+    const RuuviReading *reading = &status.readings[i];
+    out.printf("<tr><td>%d</td><td>", i + 1);
+    out.html(ruuvitags[i].c_str());
+    out.print("</td><td>");
+    if (reading->valid)
+    {
+      out.html(reading->name);
+      out.printf("</td><td>%.2f</td><td>%.2f</td><td>%.2f</td><td>%.3f</td><td>%ld</td><td>%u</td><td>%u</td><td>%.2f</td></tr>",
+                 reading->temperature / 100.0, reading->humidity / 100.0, reading->pressure / 100.0, reading->battery / 1000.0,
+                 (long)(now - reading->timestamp), status.received_ms[i], status.averaged[i], status.spread[i] / 100.0);
+    }
+    else
+    {
+      out.print("-</td><td></td><td></td><td></td><td></td><td></td><td></td><td></td><td></td></tr>");
+    }
+  }
+  out.print("</table>");
+
+  out.print("<h4>Wake phases (ms)</h4><ul>");
+  for (int i = 0; i < PHASE_COUNT; i++)
+  {
+    out.printf("<li>%s: %u</li>", wake_phase_names[i], telemetry.phase_ms[i]);
+  }
+  out.printf("<li>now: %lu</li></ul>", millis());
+
+  out.printf("<h4>Last frame</h4><ul><li>Changed: %u px in %dx%d at %d,%d</li>", status.changed.pixels,
+             status.changed.width, status.changed.height, status.changed.x, status.changed.y);
+  out.printf("<li>Restored: %s, %u bytes in %u us</li>", status.frame_restored ? "yes" : "no",
+             status.frame_store.stored_bytes, status.frame_store.restore_us);
+  out.printf("<li>Average refresh: %.0f ms over %u wakes</li>", refresh_policy_average_ms(&status.refresh_policy),
+             status.refresh_policy.wakes);
+  for (int i = 0; i < REFRESH_REGION_COUNT; i++)
+  {
+    out.printf("<li>Region %d: %u fast updates, ghosting %.1f</li>", i, status.refresh_policy.fast_updates[i],
+               status.refresh_policy.ghosting[i]);
+  }
+  out.print("</ul>");
+
+  if (alwaysOn)
+  {
+    out.printf("<h4>Always on</h4><ul><li>Updates: %u, coalesced: %u</li><li>Refreshes: %u, full: %u</li><li>Held by the rate cap: %u</li></ul>",
+               status.stream.updates, status.stream.coalesced, status.stream.refreshes, status.stream.full_refreshes,
+               status.stream.rate_limited);
+  }
+
+  out.print("<h4>Memory</h4><ul>");
+  out.printf("<li>Heap free: %u, min: %u</li>", ESP.getFreeHeap(), ESP.getMinFreeHeap());
+  out.printf("<li>PSRAM free: %u, min: %u</li></ul>", ESP.getFreePsram(), ESP.getMinFreePsram());
+
+  out.print("<h4>Counters</h4><ul>");
+  out.printf("<li>Wakes: %u</li><li>Refreshes: %u</li><li>Timeouts: %u</li>", telemetry_counters.wakes, status.refreshes, telemetry_counters.timeouts);
+  out.printf("<li>Messages: %u</li><li>Parse errors: %u</li><li>Queue drops: %u</li>", telemetry.messages,
+             telemetry.parse_errors, telemetry.queue_drops);
+  for (int i = 0; i < PAYLOAD_FORMAT_COUNT; i++)
+  {
+    out.printf("<li>%s: %u messages, %u bytes, %u us decode</li>", payload_format_names[i],
+               telemetry.payloads[i], telemetry.payload_bytes[i], telemetry.decode_us[i]);
+  }
+  out.print("</ul>");
+
+  out.print("<h4>Battery</h4><ul>");
+  out.printf("<li>Voltage: %.2f V</li><li>Level: %d %%</li><li>Days left: %.1f</li>", esp_battery_voltage, esp_battery_level, esp_battery_days);
+  out.printf("<li>Clock drift: %.0f ppm</li></ul>", sleep_clock_drift() * 1e6);
+
+  out.print("Go to <a href='config'>configure page</a> to change values.");
+  out.print("</body></html>\n");
+  out.end();
+}
+
+/**
+ * Handle web requests to "/metrics" path, Prometheus text format.
+ */
+void handleMetrics()
+{
+  static StatusSnapshot status;
+  readStatus(&status);
+  ChunkedWriter out(server);
+  out.begin("text/plain; version=0.0.4");
+
+  const char *names[] = {"temperature_celsius", "humidity_percent", "pressure_pascals", "battery_volts", "age_seconds",
+                         "readings_averaged", "temperature_spread_celsius"};
+  time_t now = time(NULL);
+  for (int m = 0; m < 7; m++)
+  {
+    out.printf("# TYPE ruuvi_%s gauge\n", names[m]);
+    for (int i = 0; i < RUUVI_TAG_COUNT; i++)
+    {
+      const RuuviReading *reading = &status.readings[i];
+      if (!reading->valid)
+      {
+        continue;
+      }
+      double values[] = {reading->temperature / 100.0, reading->humidity / 100.0, (double)reading->pressure, reading->battery / 1000.0, (double)(now - reading->timestamp),
+                         (double)status.averaged[i], status.spread[i] / 100.0};
+      out.printf("ruuvi_%s{tag=\"%d\",name=\"", names[m], i + 1);
+      out.label(reading->name);
+      out.printf("\"} %g\n", values[m]);
+    }
+  }
+
+  out.print("# TYPE display_phase_milliseconds gauge\n");
+  for (int i = 0; i < PHASE_COUNT; i++)
+  {
+    out.printf("display_phase_milliseconds{phase=\"%s\"} %u\n", wake_phase_names[i], telemetry.phase_ms[i]);
+  }
+  out.printf("# TYPE display_uptime_milliseconds gauge\ndisplay_uptime_milliseconds %lu\n", millis());
+  // -- The previous wake, the current one has not finished yet.
+  const WakeTiming *timing = &telemetry_counters.last_wake;
+  out.print("# TYPE display_last_wake_milliseconds gauge\n");
+  out.printf("display_last_wake_milliseconds{part=\"awake\"} %u\n", timing->awake_ms);
+  out.printf("display_last_wake_milliseconds{part=\"refresh\"} %u\n", timing->refresh_ms);
+  out.printf("display_last_wake_milliseconds{part=\"radio_teardown\"} %u\n", timing->teardown_ms);
+  out.printf("display_last_wake_milliseconds{part=\"%s\"} %u\n", timing->sequential ? "sequential" : "sequential_estimate",
+             telemetry_sequential_ms(timing));
+
+  out.printf("# TYPE display_list_dropped_items gauge\ndisplay_list_dropped_items %d\n", status.dropped);
+  out.printf("# TYPE display_changed_pixels gauge\ndisplay_changed_pixels %u\n", status.changed.pixels);
+  out.printf("# TYPE display_changed_area_pixels gauge\ndisplay_changed_area_pixels %d\n", status.changed.width * status.changed.height);
+  out.printf("# TYPE display_frame_restore_microseconds gauge\ndisplay_frame_restore_microseconds %u\n", status.frame_store.restore_us);
+  out.printf("# TYPE display_frame_stored_bytes gauge\ndisplay_frame_stored_bytes %u\n", status.frame_store.stored_bytes);
+  out.printf("# TYPE display_refresh_average_milliseconds gauge\ndisplay_refresh_average_milliseconds %.0f\n", refresh_policy_average_ms(&status.refresh_policy));
+  out.print("# TYPE display_region_fast_updates gauge\n");
+  for (int i = 0; i < REFRESH_REGION_COUNT; i++)
+  {
+    out.printf("display_region_fast_updates{region=\"%d\"} %u\n", i, status.refresh_policy.fast_updates[i]);
+  }
+
+  if (alwaysOn)
+  {
+    out.printf("# TYPE display_stream_updates_total counter\ndisplay_stream_updates_total %u\n", status.stream.updates);
+    out.printf("# TYPE display_stream_coalesced_total counter\ndisplay_stream_coalesced_total %u\n", status.stream.coalesced);
+    out.printf("# TYPE display_stream_refreshes_total counter\ndisplay_stream_refreshes_total{kind=\"partial\"} %u\n", status.stream.refreshes);
+    out.printf("display_stream_refreshes_total{kind=\"full\"} %u\n", status.stream.full_refreshes);
+    out.printf("# TYPE display_stream_rate_limited_total counter\ndisplay_stream_rate_limited_total %u\n", status.stream.rate_limited);
+  }
+
+  out.printf("# TYPE display_heap_free_bytes gauge\ndisplay_heap_free_bytes %u\n", ESP.getFreeHeap());
+  out.printf("# TYPE display_heap_min_free_bytes gauge\ndisplay_heap_min_free_bytes %u\n", ESP.getMinFreeHeap());
+  out.printf("# TYPE display_psram_free_bytes gauge\ndisplay_psram_free_bytes %u\n", ESP.getFreePsram());
+  out.printf("# TYPE display_psram_min_free_bytes gauge\ndisplay_psram_min_free_bytes %u\n", ESP.getMinFreePsram());
+
+  out.printf("# TYPE display_wakes_total counter\ndisplay_wakes_total %u\n", telemetry_counters.wakes);
+  out.printf("# TYPE display_refreshes_total counter\ndisplay_refreshes_total %u\n", status.refreshes);
+  out.printf("# TYPE display_timeouts_total counter\ndisplay_timeouts_total %u\n", telemetry_counters.timeouts);
+  out.printf("# TYPE display_messages_total counter\ndisplay_messages_total %u\n", telemetry.messages);
+  out.printf("# TYPE display_parse_errors_total counter\ndisplay_parse_errors_total %u\n", telemetry.parse_errors);
+  out.printf("# TYPE display_queue_drops_total counter\ndisplay_queue_drops_total %u\n", telemetry.queue_drops);
+  const char *payload_metrics[] = {"payloads_total", "payload_bytes_total", "decode_microseconds_total"};
+  const uint32_t *payload_values[] = {telemetry.payloads, telemetry.payload_bytes, telemetry.decode_us};
+  for (int m = 0; m < 3; m++)
+  {
+    out.printf("# TYPE display_%s counter\n", payload_metrics[m]);
+    for (int i = 0; i < PAYLOAD_FORMAT_COUNT; i++)
+    {
+      out.printf("display_%s{format=\"%s\"} %u\n", payload_metrics[m], payload_format_names[i], payload_values[m][i]);
+    }
+  }
+
+  out.printf("# TYPE display_battery_volts gauge\ndisplay_battery_volts %.3f\n", esp_battery_voltage);
+  out.printf("# TYPE display_battery_percent gauge\ndisplay_battery_percent %d\n", esp_battery_level);
+  out.printf("# TYPE display_battery_days_left gauge\ndisplay_battery_days_left %.1f\n", esp_battery_days);
+  out.printf("# TYPE display_clock_drift_ppm gauge\ndisplay_clock_drift_ppm %.0f\n", sleep_clock_drift() * 1e6);
+  out.end();
+}
+
+#ifndef WEATHER_BAND_RENDER
+static void sendSnapshotData(const uint8_t *data, size_t length, void *context)
+{
+  ((ChunkedWriter *)context)->write(data, length);
+}
+#endif
+
+/**
+ * Handle web requests to "/snapshot.pgm" and "/snapshot.png" paths,
+ * the current framebuffer converted one row at a time.
+ */
+void handleSnapshot()
+{
+#ifdef WEATHER_BAND_RENDER
+  server.send(503, "text/plain", "Snapshots need the full framebuffer, not available in band rendering mode");
+#else
+  // -- loop() may be drawing on core 1, the frame is copied between its draws and sent from the copy.
+  uint8_t *frame = (uint8_t *)heap_caps_malloc(EPD_WIDTH * EPD_HEIGHT / 2, MALLOC_CAP_SPIRAM);
+  if (!frame || xSemaphoreTake(frameLock, pdMS_TO_TICKS(2000)) != pdTRUE)
+  {
+    free(frame);
+    server.send(503, "text/plain", "Framebuffer busy, try again");
+    return;
+  }
+  memcpy(frame, fb, EPD_WIDTH * EPD_HEIGHT / 2);
+  xSemaphoreGive(frameLock);
+
+  bool png = server.uri().endsWith(".png");
+  ChunkedWriter out(server);
+  out.begin(png ? "image/png" : "image/x-portable-graymap");
+  if (png)
+  {
+    snapshot_write_png(frame, EPD_WIDTH, EPD_HEIGHT, sendSnapshotData, &out);
+  }
+  else
+  {
+    snapshot_write_pgm(frame, EPD_WIDTH, EPD_HEIGHT, sendSnapshotData, &out);
+  }
+  out.end();
+  free(frame);
+#endif
 }
 
 void wifiConnected()
 {
+  telemetry_mark(PHASE_WIFI);
+  // -- Modem sleep between DTIM beacons, the connection and the subscriptions stay up.
+  if (alwaysOn)
+  {
+    WiFi.setSleep(true);
+  }
   needMqttConnect = true;
 }
 
@@ -550,13 +1159,38 @@ bool connectMqtt()
   Serial.println("Connecting to MQTT server...");
   while (!connectMqttOptions())
   {
+    if (networkStop)
+    {
+      return false;
+    }
     iotWebConf.delay(500);
   }
   Serial.println("Connected!");
+  telemetry_mark(PHASE_MQTT);
+  if (sleep_clock_needs_sync())
+  {
+    Serial.println("Syncing clock from NTP");
+    sleep_clock_sntp_sync(ntpUDP, NTP_SERVER);
+  }
   if (esp_battery_voltage < 4.25) {
     mqttClient.publish("stats/ESP32/voltage",String(esp_battery_voltage));
+    if (esp_battery_days >= 0)
+    {
+      mqttClient.publish("stats/ESP32/days_left", String(esp_battery_days, 1));
+    }
+  }
+  // -- All tags at once, the render loop draws each column as its reading arrives. loop() reads
+  // -- expectedTags on core 1, so it is built here and stored once, never seen half built.
+  uint8_t subscribed = 0;
+  for (int i = 0; i < RUUVI_TAG_COUNT; i++)
+  {
+    if (ruuvitags[i].length() > 0)
+    {
+      mqttClient.subscribe(ruuvitags[i]);
+      subscribed |= 1 << i;
+    }
   }
-  mqttClient.subscribe(ruuvitags[ruuvitagIndex]);
+  expectedTags = subscribed;
   return true;
 }
 
@@ -580,5 +1214,46 @@ bool connectMqttOptions()
 
 void mqttMessageReceived(MQTTClient *client, char topic[], char payload[], int payload_length)
 {
-  deserializeJson(doc, payload, payload_length);
+  ++telemetry.messages;
+  if (payload_length <= 0)
+  {
+    return;
+  }
+  const char *topics[RUUVI_TAG_COUNT];
+  for (int i = 0; i < RUUVI_TAG_COUNT; i++)
+  {
+    topics[i] = ruuvitags[i].c_str();
+  }
+  int tag = ruuvi_topic_tag(topics, topic);
+  // -- Not one of ours, or a column that is already drawn in this wake.
+  if (tag < 0 || (!alwaysOn && (drawnTags & (1 << tag))))
+  {
+    return;
+  }
+
+  PayloadFormat format = ruuvi_payload_format(payload, payload_length);
+  unsigned long started = micros();
+  DeserializationError error = ruuvi_payload_parse(doc, payload, payload_length, format);
+  telemetry.decode_us[format] += micros() - started;
+  ++telemetry.payloads[format];
+  telemetry.payload_bytes[format] += payload_length;
+  if (error)
+  {
+    ++telemetry.parse_errors;
+    doc.clear();
+    return;
+  }
+
+  TagUpdate update;
+  memset(&update, 0, sizeof(update));
+  update.tag = tag;
+  if (ruuvi_payload_read(doc, &update.reading))
+  {
+    sleep_clock_observe(update.reading.timestamp, true);
+    if (!tagQueue.push(update))
+    {
+      ++telemetry.queue_drops;
+    }
+  }
+  doc.clear();
 }
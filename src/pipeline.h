@@ -0,0 +1,90 @@
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <thread>
+#endif
+
+/**
+ * Lock-free single producer, single consumer ring buffer. One slot is
+ * kept free to tell full from empty, so it holds N - 1 items.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+public:
+  SpscQueue() : head(0), tail(0) {}
+
+  // -- Producer side. Returns false when full.
+  bool push(const T &item)
+  {
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t next = (h + 1) % N;
+    if (next == tail.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    items[h] = item;
+    head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // -- Consumer side. Returns false when empty.
+  bool pop(T &item)
+  {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    item = items[t];
+    tail.store((t + 1) % N, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items[N];
+  std::atomic<size_t> head;
+  std::atomic<size_t> tail;
+};
+
+typedef void (*PipelineTask)(void *parameter);
+
+#ifdef ARDUINO
+typedef TaskHandle_t PipelineHandle;
+#else
+typedef std::thread::native_handle_type PipelineHandle;
+#endif
+
+/**
+ * Start a task pinned to core and, when handle is not NULL, store its
+ * handle there so the caller can stop or wait for it. On a host it runs as
+ * a detached std::thread and stack_size and core are ignored.
+ */
+inline bool pipeline_start(PipelineTask task, const char *name, uint32_t stack_size, void *parameter, int core,
+                           PipelineHandle *handle = NULL)
+{
+#ifdef ARDUINO
+  return xTaskCreatePinnedToCore(task, name, stack_size, parameter, 1, handle, core) == pdPASS;
+#else
+  (void)name;
+  (void)stack_size;
+  (void)core;
+  std::thread thread(task, parameter);
+  if (handle)
+  {
+    *handle = thread.native_handle();
+  }
+  thread.detach();
+  return true;
+#endif
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include <math.h>
+#include <string.h>
+
+#include "reading_stats.h"
+
+static void fields(const RuuviReading *reading, int32_t *values)
+{
+  values[READING_TEMPERATURE] = reading->temperature;
+  values[READING_HUMIDITY] = reading->humidity;
+  values[READING_PRESSURE] = reading->pressure;
+  values[READING_BATTERY] = reading->battery;
+}
+
+void reading_stats_reset(ReadingStats *stats)
+{
+  memset(stats, 0, sizeof(*stats));
+}
+
+void reading_stats_add(ReadingStats *stats, const RuuviReading *reading, uint32_t now_ms)
+{
+  int32_t values[READING_FIELD_COUNT];
+  fields(reading, values);
+  if (stats->count == 0)
+  {
+    stats->first_ms = now_ms;
+    memcpy(stats->shift, values, sizeof(stats->shift));
+  }
+  ++stats->count;
+
+  for (int i = 0; i < READING_FIELD_COUNT; i++)
+  {
+    // -- A float mean near 101325 Pa steps in 1/128 Pa, small next to a spread of a Pa. Relative to the first
+    // -- reading the values stay small and the steps with them.
+    float value = (float)(values[i] - stats->shift[i]);
+    float delta = value - stats->mean[i];
+    stats->mean[i] += delta / stats->count;
+    stats->m2[i] += delta * (value - stats->mean[i]);
+  }
+
+  // -- Gateways may deliver out of order, the newest measurement names the column.
+  if (stats->count == 1 || reading->timestamp >= stats->latest.timestamp)
+  {
+    stats->latest = *reading;
+  }
+}
+
+bool reading_stats_window_closed(const ReadingStats *stats, uint32_t now_ms)
+{
+  return stats->count && now_ms - stats->first_ms >= READING_STATS_WINDOW_MS;
+}
+
+void reading_stats_mean(const ReadingStats *stats, RuuviReading *reading)
+{
+  if (stats->count == 0)
+  {
+    return;
+  }
+  *reading = stats->latest;
+  reading->temperature = stats->shift[READING_TEMPERATURE] + lroundf(stats->mean[READING_TEMPERATURE]);
+  reading->humidity = stats->shift[READING_HUMIDITY] + lroundf(stats->mean[READING_HUMIDITY]);
+  reading->pressure = stats->shift[READING_PRESSURE] + lroundf(stats->mean[READING_PRESSURE]);
+  reading->battery = stats->shift[READING_BATTERY] + lroundf(stats->mean[READING_BATTERY]);
+}
+
+float reading_stats_stddev(const ReadingStats *stats, ReadingField field)
+{
+  if (stats->count < 2)
+  {
+    return 0.0f;
+  }
+  return sqrtf(stats->m2[field] / (stats->count - 1));
+}
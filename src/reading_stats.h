@@ -0,0 +1,57 @@
+#ifndef READING_STATS_H_
+#define READING_STATS_H_
+
+#include <stdint.h>
+#include "ruuvi.h"
+
+// -- A tag's readings are averaged for at most this long after its first one of the wake.
+#define READING_STATS_WINDOW_MS 5000
+
+// -- Fields that are averaged, the rest come from the newest reading.
+typedef enum
+{
+  READING_TEMPERATURE,
+  READING_HUMIDITY,
+  READING_PRESSURE,
+  READING_BATTERY,
+  READING_FIELD_COUNT
+} ReadingField;
+
+/**
+ * Running mean and variance of one tag's readings (Welford), in the
+ * fixed point units of RuuviReading. They are kept relative to the first
+ * reading, so float resolves fractions of a Pa at 100 kPa. Plain C++,
+ * replayable on a host.
+ */
+typedef struct
+{
+  uint32_t count;
+  uint32_t first_ms;                // millis() of the first reading
+  int32_t shift[READING_FIELD_COUNT]; // first reading, mean is relative to it
+  float mean[READING_FIELD_COUNT];
+  float m2[READING_FIELD_COUNT];    // sum of squared differences from the mean
+  RuuviReading latest;              // newest by timestamp, supplies the name and time
+} ReadingStats;
+
+void reading_stats_reset(ReadingStats *stats);
+
+void reading_stats_add(ReadingStats *stats, const RuuviReading *reading, uint32_t now_ms);
+
+/**
+ * Whether the collection window of a tag with readings has run out.
+ */
+bool reading_stats_window_closed(const ReadingStats *stats, uint32_t now_ms);
+
+/**
+ * The newest reading with the averaged fields replaced by their rounded
+ * means. Leaves reading alone when nothing was added.
+ */
+void reading_stats_mean(const ReadingStats *stats, RuuviReading *reading);
+
+/**
+ * Sample standard deviation of field in its fixed point units, 0 below
+ * two readings.
+ */
+float reading_stats_stddev(const ReadingStats *stats, ReadingField field);
+
+#endif
@@ -0,0 +1,67 @@
+#include <string.h>
+
+#include "refresh_policy.h"
+
+#define REFRESH_POLICY_MAGIC 0x52465031
+
+const RefreshRegion refresh_regions[REFRESH_REGION_COUNT] = {
+    {0, 0, 320, 460},
+    {320, 0, 320, 460},
+    {640, 0, 320, 460},
+    {0, 460, 960, 80},
+};
+
+void refresh_policy_init(RefreshPolicyState *state)
+{
+  if (state->magic == REFRESH_POLICY_MAGIC)
+  {
+    return;
+  }
+  memset(state, 0, sizeof(*state));
+  state->magic = REFRESH_POLICY_MAGIC;
+}
+
+static float ghosting_weight(int temperature)
+{
+  if (temperature >= REFRESH_POLICY_WARM_C)
+  {
+    return 1.0f;
+  }
+  return 1.0f + (REFRESH_POLICY_WARM_C - temperature) * REFRESH_POLICY_COLD_WEIGHT;
+}
+
+RefreshAction refresh_policy_decide(RefreshPolicyState *state, int region, uint32_t changed_pixels, int temperature)
+{
+  if (region < 0 || region >= REFRESH_REGION_COUNT || changed_pixels == 0)
+  {
+    return REFRESH_SKIP;
+  }
+
+  float ghosting = state->ghosting[region] + ghosting_weight(temperature);
+  if (state->fast_updates[region] + 1 > REFRESH_POLICY_MAX_FAST || ghosting > REFRESH_POLICY_MAX_GHOSTING)
+  {
+    state->fast_updates[region] = 0;
+    state->ghosting[region] = 0;
+    return REFRESH_CLEAN;
+  }
+  ++state->fast_updates[region];
+  state->ghosting[region] = ghosting;
+  return REFRESH_FAST;
+}
+
+void refresh_policy_cleaned_all(RefreshPolicyState *state)
+{
+  memset(state->fast_updates, 0, sizeof(state->fast_updates));
+  memset(state->ghosting, 0, sizeof(state->ghosting));
+}
+
+void refresh_policy_record(RefreshPolicyState *state, uint32_t refresh_ms)
+{
+  ++state->wakes;
+  state->refresh_ms += refresh_ms;
+}
+
+float refresh_policy_average_ms(const RefreshPolicyState *state)
+{
+  return state->wakes ? (float)state->refresh_ms / state->wakes : 0.0f;
+}
@@ -0,0 +1,72 @@
+#ifndef REFRESH_POLICY_H_
+#define REFRESH_POLICY_H_
+
+#include <stdint.h>
+#include "ruuvi.h"
+
+// -- One region per tag column plus the status line along the bottom.
+#define REFRESH_REGION_COUNT (RUUVI_TAG_COUNT + 1)
+
+// -- Fast updates a region may take before it gets a clean refresh.
+#define REFRESH_POLICY_MAX_FAST 8
+// -- Accumulated ghosting score that forces a clean refresh.
+#define REFRESH_POLICY_MAX_GHOSTING 10.0f
+// -- At and above this panel temperature a fast update scores 1, colder ones more.
+#define REFRESH_POLICY_WARM_C 20
+// -- Extra score per degree below REFRESH_POLICY_WARM_C.
+#define REFRESH_POLICY_COLD_WEIGHT 0.1f
+
+typedef enum
+{
+  REFRESH_SKIP,  // nothing changed
+  REFRESH_FAST,  // GL16 update of the changed pixels
+  REFRESH_CLEAN  // clear the region to white and redraw it with GC16
+} RefreshAction;
+
+typedef struct
+{
+  int x;
+  int y;
+  int width;
+  int height;
+} RefreshRegion;
+
+extern const RefreshRegion refresh_regions[REFRESH_REGION_COUNT];
+
+/**
+ * Kept in RTC memory across deep sleep. Plain C++, so a sequence of frames
+ * can be replayed on a host.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint16_t fast_updates[REFRESH_REGION_COUNT]; // since the last clean refresh
+  float ghosting[REFRESH_REGION_COUNT];        // temperature weighted fast updates since then
+  uint32_t wakes;                              // wakes with a refresh
+  uint32_t refresh_ms;                         // panel time over those wakes
+} RefreshPolicyState;
+
+void refresh_policy_init(RefreshPolicyState *state);
+
+/**
+ * Choose how to refresh region given the number of its pixels that
+ * changed and the panel temperature (°C), and account for it.
+ */
+RefreshAction refresh_policy_decide(RefreshPolicyState *state, int region, uint32_t changed_pixels, int temperature);
+
+/**
+ * Record that the whole panel was cleared, e.g. when its content was unknown.
+ */
+void refresh_policy_cleaned_all(RefreshPolicyState *state);
+
+/**
+ * Add the panel time of one wake.
+ */
+void refresh_policy_record(RefreshPolicyState *state, uint32_t refresh_ms);
+
+/**
+ * Average panel time per wake in milliseconds, 0 before the first wake.
+ */
+float refresh_policy_average_ms(const RefreshPolicyState *state);
+
+#endif
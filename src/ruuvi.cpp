@@ -0,0 +1,113 @@
+#include <math.h>
+#include <string.h>
+
+#include "ruuvi.h"
+
+static int32_t clamp(int32_t value, int32_t min, int32_t max)
+{
+  return value < min ? min : (value > max ? max : value);
+}
+
+int32_t ruuvi_fixed(float value, float scale, int32_t min, int32_t max)
+{
+  float scaled = value * scale;
+  if (!(scaled >= min)) // also catches NaN
+  {
+    return min;
+  }
+  if (scaled > max)
+  {
+    return max;
+  }
+  return (int32_t)lroundf(scaled);
+}
+
+void ruuvi_clamp(RuuviReading *reading)
+{
+  reading->temperature = clamp(reading->temperature, RUUVI_TEMPERATURE_MIN, RUUVI_TEMPERATURE_MAX);
+  reading->humidity = clamp(reading->humidity, 0, RUUVI_HUMIDITY_MAX);
+  reading->pressure = clamp(reading->pressure, 0, RUUVI_PRESSURE_MAX);
+  reading->battery = clamp(reading->battery, 0, RUUVI_BATTERY_MAX);
+  reading->name[RUUVI_NAME_LEN - 1] = '\0';
+}
+
+static bool font_has(uint32_t code_point)
+{
+  return (code_point >= 0x20 && code_point <= 0x7E) || (code_point >= 0xA0 && code_point <= 0xFF);
+}
+
+void ruuvi_sanitize_name(char *dst, const char *name, size_t size)
+{
+  const uint8_t *p = (const uint8_t *)name;
+  size_t length = 0;
+  while (*p && size > 0)
+  {
+    uint32_t code_point = '?';
+    int extra = 0;
+    if (*p < 0x80)
+    {
+      code_point = *p;
+    }
+    else if ((*p & 0xE0) == 0xC0)
+    {
+      code_point = *p & 0x1F;
+      extra = 1;
+    }
+    else if ((*p & 0xF0) == 0xE0)
+    {
+      code_point = *p & 0x0F;
+      extra = 2;
+    }
+    else if ((*p & 0xF8) == 0xF0)
+    {
+      code_point = *p & 0x07;
+      extra = 3;
+    }
+    ++p;
+
+    for (int i = 0; i < extra; i++)
+    {
+      if ((*p & 0xC0) != 0x80)
+      {
+        code_point = '?'; // truncated sequence, resume at the offending byte
+        break;
+      }
+      code_point = code_point << 6 | (*p++ & 0x3F);
+    }
+    if (!font_has(code_point))
+    {
+      code_point = '?';
+    }
+
+    int needed = code_point < 0x80 ? 1 : 2;
+    if (length + needed >= size)
+    {
+      break;
+    }
+    if (needed == 1)
+    {
+      dst[length++] = (char)code_point;
+    }
+    else
+    {
+      dst[length++] = (char)(0xC0 | code_point >> 6);
+      dst[length++] = (char)(0x80 | (code_point & 0x3F));
+    }
+  }
+  if (size > 0)
+  {
+    dst[length] = '\0';
+  }
+}
+
+int ruuvi_topic_tag(const char *const topics[RUUVI_TAG_COUNT], const char *topic)
+{
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    if (topics[tag][0] && strcmp(topics[tag], topic) == 0)
+    {
+      return tag;
+    }
+  }
+  return -1;
+}
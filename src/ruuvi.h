@@ -0,0 +1,59 @@
+#ifndef RUUVI_H_
+#define RUUVI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RUUVI_TAG_COUNT 3
+#define RUUVI_NAME_LEN 32
+
+// -- One tag reading in fixed point, converted to float only when drawn.
+typedef struct
+{
+  char name[RUUVI_NAME_LEN];
+  int32_t temperature;     // 0.01 °C
+  int32_t humidity;        // 0.01 %
+  int32_t pressure;        // Pa
+  int32_t battery;         // mV
+  uint32_t timestamp;      // epoch seconds
+  int16_t acceleration[3]; // mG, x y z
+  int8_t tx_power;         // dBm
+  uint8_t movement;
+  uint16_t sequence;
+  uint8_t mac[6];
+  bool valid;
+} RuuviReading;
+
+// -- Accepted ranges; anything outside is clamped before it is stored or drawn.
+#define RUUVI_TEMPERATURE_MIN -9999 // -99.99 °C
+#define RUUVI_TEMPERATURE_MAX 19999 // 199.99 °C
+#define RUUVI_HUMIDITY_MAX 10000    // 100.00 %
+#define RUUVI_PRESSURE_MAX 115534   // highest RAWv2 value, Pa
+#define RUUVI_BATTERY_MAX 9999      // mV
+
+/**
+ * Convert a untrusted float to fixed point: value * scale rounded and
+ * clamped to [min, max]. NaN and infinities give min.
+ */
+int32_t ruuvi_fixed(float value, float scale, int32_t min, int32_t max);
+
+/**
+ * Clamp all fields of reading to the ranges above so formatted values
+ * always fit their buffers and layout.
+ */
+void ruuvi_clamp(RuuviReading *reading);
+
+/**
+ * Copy name into dst (size bytes) as valid UTF-8 that only uses code
+ * points the embedded fonts have (0x20-0x7E, 0xA0-0xFF). Anything else,
+ * including broken sequences, becomes '?'. Never splits a sequence.
+ */
+void ruuvi_sanitize_name(char *dst, const char *name, size_t size);
+
+/**
+ * Column of the tag whose configured topic is exactly topic, -1 when
+ * none is. Empty configured topics never match.
+ */
+int ruuvi_topic_tag(const char *const topics[RUUVI_TAG_COUNT], const char *topic);
+
+#endif
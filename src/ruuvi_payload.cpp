@@ -0,0 +1,54 @@
+#include <stdlib.h>
+
+#include "ruuvi_payload.h"
+#include "ruuvi_raw.h"
+
+PayloadFormat ruuvi_payload_format(const char *payload, size_t length)
+{
+  if (length == 0)
+  {
+    return PAYLOAD_JSON;
+  }
+  uint8_t first = payload[0];
+  return ((first & 0xF0) == 0x80 || first == 0xDE || first == 0xDF) ? PAYLOAD_MSGPACK : PAYLOAD_JSON;
+}
+
+DeserializationError ruuvi_payload_parse(JsonDocument &doc, const char *payload, size_t length, PayloadFormat format)
+{
+  return format == PAYLOAD_MSGPACK ? deserializeMsgPack(doc, payload, length) : deserializeJson(doc, payload, length);
+}
+
+bool ruuvi_payload_read(const JsonDocument &doc, RuuviReading *reading)
+{
+  const char *data = doc["data"];
+  if (data)
+  {
+    if (!ruuvi_decode_hex(data, reading))
+    {
+      return false;
+    }
+    // -- Gateways send the timestamp as a string.
+    JsonVariantConst ts = doc["ts"];
+    reading->timestamp = ts.is<const char *>() ? strtoul(ts.as<const char *>(), NULL, 10) : ts.as<unsigned long>();
+    ruuvi_clamp(reading);
+    return true;
+  }
+
+  if (doc["pressure"].as<long>() == 0)
+  {
+    return false;
+  }
+  ruuvi_sanitize_name(reading->name, doc["name"] | "", RUUVI_NAME_LEN);
+  reading->temperature = ruuvi_fixed(doc["temperature"], 100, RUUVI_TEMPERATURE_MIN, RUUVI_TEMPERATURE_MAX);
+  reading->humidity = ruuvi_fixed(doc["humidity"], 100, 0, RUUVI_HUMIDITY_MAX);
+  reading->pressure = ruuvi_fixed(doc["pressure"], 1, 0, RUUVI_PRESSURE_MAX);
+  reading->battery = ruuvi_fixed(doc["batteryVoltage"], 1000, 0, RUUVI_BATTERY_MAX);
+  reading->timestamp = doc["timestamp"];
+  reading->acceleration[0] = ruuvi_fixed(doc["accelerationX"], 1000, INT16_MIN, INT16_MAX);
+  reading->acceleration[1] = ruuvi_fixed(doc["accelerationY"], 1000, INT16_MIN, INT16_MAX);
+  reading->acceleration[2] = ruuvi_fixed(doc["accelerationZ"], 1000, INT16_MIN, INT16_MAX);
+  reading->tx_power = ruuvi_fixed(doc["txPower"], 1, INT8_MIN, INT8_MAX);
+  reading->movement = doc["movementCounter"];
+  reading->sequence = doc["measurementSequenceNumber"];
+  return true;
+}
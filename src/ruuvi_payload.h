@@ -0,0 +1,29 @@
+#ifndef RUUVI_PAYLOAD_H_
+#define RUUVI_PAYLOAD_H_
+
+#include <stddef.h>
+#include <ArduinoJson.h>
+#include "ruuvi.h"
+#include "telemetry.h"
+
+/**
+ * Tell the encoding of a reading payload from its first byte: a
+ * MessagePack map starts with a fixmap, map16 or map32 marker, JSON never
+ * does.
+ */
+PayloadFormat ruuvi_payload_format(const char *payload, size_t length);
+
+/**
+ * Deserialize payload into doc with the parser for format.
+ */
+DeserializationError ruuvi_payload_parse(JsonDocument &doc, const char *payload, size_t length, PayloadFormat format);
+
+/**
+ * Fill reading from a deserialized payload, either the decoded JSON
+ * fields or the raw advertisement hex published by a Ruuvi Gateway.
+ * Returns false when doc holds no usable reading. Payloads are untrusted:
+ * names are reduced to what the fonts can draw and values clamped.
+ */
+bool ruuvi_payload_read(const JsonDocument &doc, RuuviReading *reading);
+
+#endif
@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "ruuvi_raw.h"
+
+#define AD_TYPE_MANUFACTURER 0xFF
+#define RUUVI_COMPANY_ID 0x0499
+#define RUUVI_FORMAT_RAWV2 5
+#define RAWV2_LEN 24 // format byte through MAC
+
+static int hex_value(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  c |= 0x20; // lower case
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+static int16_t read_i16(const uint8_t *p)
+{
+  return (int16_t)((p[0] << 8) | p[1]);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static bool decode_rawv2(const uint8_t *p, RuuviReading *reading)
+{
+  int16_t temperature = read_i16(p + 1);   // 0.005 °C
+  uint16_t humidity = read_u16(p + 3);     // 0.0025 %
+  uint16_t pressure = read_u16(p + 5);     // Pa - 50000
+  uint16_t power = read_u16(p + 13);       // 11 bits battery, 5 bits tx power
+  if (temperature == (int16_t)0x8000 || humidity == 0xFFFF || pressure == 0xFFFF)
+  {
+    return false;
+  }
+
+  reading->temperature = (temperature * 5 + (temperature < 0 ? -5 : 5)) / 10;
+  reading->humidity = (humidity + 2) / 4;
+  reading->pressure = pressure + 50000;
+  for (int i = 0; i < 3; i++)
+  {
+    reading->acceleration[i] = read_i16(p + 7 + 2 * i);
+  }
+  reading->battery = (power >> 5) == 2047 ? 0 : (power >> 5) + 1600;
+  reading->tx_power = (power & 0x1F) == 31 ? 0 : (power & 0x1F) * 2 - 40;
+  reading->movement = p[15];
+  reading->sequence = read_u16(p + 16);
+  memcpy(reading->mac, p + 18, 6);
+  snprintf(reading->name, RUUVI_NAME_LEN, "Ruuvi %02X%02X", reading->mac[4], reading->mac[5]);
+  return true;
+}
+
+bool ruuvi_decode_advertisement(const uint8_t *data, size_t length, RuuviReading *reading)
+{
+  size_t i = 0;
+  while (i < length)
+  {
+    size_t ad_length = data[i];
+    if (ad_length == 0 || i + 1 + ad_length > length)
+    {
+      break;
+    }
+    const uint8_t *ad = data + i + 1;
+    // -- Type, little endian company id, then the Ruuvi payload.
+    if (ad[0] == AD_TYPE_MANUFACTURER && ad_length >= 3 + RAWV2_LEN &&
+        (ad[1] | ad[2] << 8) == RUUVI_COMPANY_ID && ad[3] == RUUVI_FORMAT_RAWV2)
+    {
+      return decode_rawv2(ad + 3, reading);
+    }
+    i += 1 + ad_length;
+  }
+  return false;
+}
+
+bool ruuvi_decode_hex(const char *hex, RuuviReading *reading)
+{
+  uint8_t data[RUUVI_ADV_MAX_LEN];
+  size_t length = 0;
+  while (hex[0] && hex[1])
+  {
+    int high = hex_value(hex[0]);
+    int low = hex_value(hex[1]);
+    if (high < 0 || low < 0 || length == RUUVI_ADV_MAX_LEN)
+    {
+      return false;
+    }
+    data[length++] = (uint8_t)(high << 4 | low);
+    hex += 2;
+  }
+  if (hex[0])
+  {
+    return false; // odd number of digits
+  }
+  return ruuvi_decode_advertisement(data, length, reading);
+}
@@ -0,0 +1,24 @@
+#ifndef RUUVI_RAW_H_
+#define RUUVI_RAW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ruuvi.h"
+
+// -- Longest legacy BLE advertisement.
+#define RUUVI_ADV_MAX_LEN 31
+
+/**
+ * Decode a hex encoded advertisement as published by Ruuvi Gateway in
+ * "data" (e.g. "0201061BFF9904050F...") straight into reading. Only
+ * integer math is used. Returns false when the text is not valid hex or
+ * carries no Ruuvi data format 5 (RAWv2) manufacturer data.
+ */
+bool ruuvi_decode_hex(const char *hex, RuuviReading *reading);
+
+/**
+ * Decode binary advertisement data (AD structures).
+ */
+bool ruuvi_decode_advertisement(const uint8_t *data, size_t length, RuuviReading *reading);
+
+#endif
@@ -0,0 +1,196 @@
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <esp_sleep.h>
+#include <sys/time.h>
+
+#include "sleep_clock.h"
+
+#define SLEEP_CLOCK_MAGIC 0x534C4B32
+#define NTP_LOCAL_PORT 2390
+#define NTP_PACKET_SIZE 48
+#define NTP_UNIX_OFFSET 2208988800UL
+// -- Any clock before 2020-01-01 has never been set.
+#define VALID_EPOCH 1577836800L
+// -- Drift is only learned over sleeps long enough to swamp the 1 s timestamp resolution.
+#define MIN_DRIFT_SPAN_S 600.0f
+// -- Assumed drift uncertainty until the first observation.
+#define INITIAL_RESIDUAL 0.02f
+
+typedef struct
+{
+  uint32_t magic;
+  bool synced;
+  float drift;            // wall seconds per RTC second minus one
+  float residual;         // smoothed |drift error| left after correction
+  float sleep_since_sync; // RTC seconds slept since the last network observation
+  float requested_sleep;  // RTC seconds requested for the sleep that is in progress
+  float slept;            // wall seconds of the sleep that ended, 0 if unknown
+} SleepClockState;
+
+RTC_DATA_ATTR static SleepClockState clock_state;
+
+static void set_clock(double epoch)
+{
+  struct timeval tv;
+  tv.tv_sec = (time_t)epoch;
+  tv.tv_usec = (suseconds_t)((epoch - (double)tv.tv_sec) * 1000000.0);
+  settimeofday(&tv, NULL);
+}
+
+static double now_seconds()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double)tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+void sleep_clock_wake()
+{
+  if (clock_state.magic != SLEEP_CLOCK_MAGIC)
+  {
+    memset(&clock_state, 0, sizeof(clock_state));
+    clock_state.magic = SLEEP_CLOCK_MAGIC;
+    clock_state.residual = INITIAL_RESIDUAL;
+  }
+
+  bool timer = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+  clock_state.slept = timer ? clock_state.requested_sleep * (1.0f + clock_state.drift) : 0;
+
+  // -- Only a timer wakeup keeps the RTC based system time; the learned drift is kept anyway.
+  if (!timer || time(NULL) < VALID_EPOCH)
+  {
+    clock_state.synced = false;
+    clock_state.requested_sleep = 0;
+    return;
+  }
+
+  // -- The system clock advanced by RTC seconds; add what the drift says it missed.
+  double corrected = now_seconds() + clock_state.requested_sleep * clock_state.drift;
+  set_clock(corrected);
+  clock_state.sleep_since_sync += clock_state.requested_sleep;
+  clock_state.requested_sleep = 0;
+}
+
+static void observe(double network_time, bool lower_bound)
+{
+  double error = network_time - now_seconds();
+  if (lower_bound)
+  {
+    // -- A measurement timestamp older than our clock tells nothing, a newer one only that the clock
+    // -- is behind by at least that much. How stale the message was is unknown, so it neither
+    // -- counts as a sync nor says anything about the drift.
+    if (clock_state.synced && error > 1.0)
+    {
+      set_clock(network_time);
+    }
+    return;
+  }
+
+  if (clock_state.synced && clock_state.sleep_since_sync >= MIN_DRIFT_SPAN_S)
+  {
+    float observed = (float)(error / clock_state.sleep_since_sync);
+    clock_state.drift += SLEEP_CLOCK_DRIFT_SMOOTHING * observed;
+    clock_state.drift = constrain(clock_state.drift, -SLEEP_CLOCK_MAX_DRIFT, SLEEP_CLOCK_MAX_DRIFT);
+    clock_state.residual = (1.0f - SLEEP_CLOCK_DRIFT_SMOOTHING) * clock_state.residual + SLEEP_CLOCK_DRIFT_SMOOTHING * fabsf(observed);
+  }
+
+  set_clock(network_time);
+  clock_state.synced = true;
+  clock_state.sleep_since_sync = 0;
+
+  Serial.print("Clock error: ");
+  Serial.print(error, 3);
+  Serial.print(" s, drift: ");
+  Serial.print(clock_state.drift * 1e6f, 0);
+  Serial.println(" ppm");
+}
+
+void sleep_clock_observe(time_t network_time, bool lower_bound)
+{
+  if (network_time < VALID_EPOCH)
+  {
+    return;
+  }
+  observe((double)network_time, lower_bound);
+}
+
+float sleep_clock_error_estimate()
+{
+  if (!clock_state.synced)
+  {
+    return INFINITY;
+  }
+  // -- One second for the timestamp resolution plus the unexplained drift since the last sync.
+  return 1.0f + clock_state.residual * clock_state.sleep_since_sync;
+}
+
+bool sleep_clock_needs_sync()
+{
+  return sleep_clock_error_estimate() > SLEEP_CLOCK_SYNC_THRESHOLD_S;
+}
+
+bool sleep_clock_sntp_sync(WiFiUDP &udp, const char *server)
+{
+  uint8_t packet[NTP_PACKET_SIZE];
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0x1B; // LI 0, version 3, mode 3 (client)
+
+  if (!udp.begin(NTP_LOCAL_PORT))
+  {
+    return false;
+  }
+  udp.beginPacket(server, NTP_PORT);
+  udp.write(packet, NTP_PACKET_SIZE);
+  udp.endPacket();
+
+  bool result = false;
+  unsigned long sent = millis();
+  while (millis() - sent < NTP_TIMEOUT_MS)
+  {
+    if (udp.parsePacket() >= NTP_PACKET_SIZE)
+    {
+      unsigned long round_trip = millis() - sent;
+      udp.read(packet, NTP_PACKET_SIZE);
+      uint32_t seconds = (uint32_t)packet[40] << 24 | (uint32_t)packet[41] << 16 | (uint32_t)packet[42] << 8 | packet[43];
+      uint32_t fraction = (uint32_t)packet[44] << 24 | (uint32_t)packet[45] << 16 | (uint32_t)packet[46] << 8 | packet[47];
+      if (seconds > NTP_UNIX_OFFSET)
+      {
+        double network_time = (double)(seconds - NTP_UNIX_OFFSET) + fraction / 4294967296.0 + round_trip / 2000.0;
+        observe(network_time, false);
+        result = true;
+      }
+      break;
+    }
+    delay(10);
+  }
+  udp.stop();
+  return result;
+}
+
+uint64_t sleep_clock_sleep_us(uint32_t period_s, bool align)
+{
+  float wall_s = period_s;
+  if (align && clock_state.synced)
+  {
+    // -- Land on the next period boundary, but never sleep less than half a period.
+    time_t now = time(NULL);
+    wall_s = period_s - (now % period_s);
+    if (wall_s < period_s / 2)
+    {
+      wall_s += period_s;
+    }
+  }
+
+  clock_state.requested_sleep = wall_s / (1.0f + clock_state.drift);
+  return (uint64_t)(clock_state.requested_sleep * 1000000.0f);
+}
+
+float sleep_clock_slept_s()
+{
+  return clock_state.slept;
+}
+
+float sleep_clock_drift()
+{
+  return clock_state.drift;
+}
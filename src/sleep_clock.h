@@ -0,0 +1,64 @@
+#ifndef SLEEP_CLOCK_H_
+#define SLEEP_CLOCK_H_
+
+#include <stdint.h>
+#include <time.h>
+
+class WiFiUDP;
+
+#define NTP_SERVER "pool.ntp.org"
+#define NTP_PORT 123
+#define NTP_TIMEOUT_MS 1000
+
+// -- Run a full SNTP query only when the estimated wall clock error exceeds this (seconds).
+#define SLEEP_CLOCK_SYNC_THRESHOLD_S 15
+// -- Weight of a new drift observation in the smoothed drift coefficient.
+#define SLEEP_CLOCK_DRIFT_SMOOTHING 0.3f
+// -- Sleeps are never corrected by more than this fraction (150 kHz RC is within a few %).
+#define SLEEP_CLOCK_MAX_DRIFT 0.1f
+
+/**
+ * Call once early in setup(). Applies the drift correction for the
+ * sleep that just ended to the system clock.
+ */
+void sleep_clock_wake();
+
+/**
+ * Feed a network time observation (SNTP or a message timestamp).
+ * Message timestamps are measurement times and can only prove that the
+ * local clock is behind, so pass lower_bound = true for them. Those only
+ * move a synced clock forward; they never sync it or teach the drift, as a
+ * retained message may be hours old.
+ */
+void sleep_clock_observe(time_t network_time, bool lower_bound);
+
+/**
+ * True when the estimated error is above SLEEP_CLOCK_SYNC_THRESHOLD_S
+ * and an SNTP round trip is worth doing.
+ */
+bool sleep_clock_needs_sync();
+
+/**
+ * Query an SNTP server through udp and feed the result to the drift
+ * estimator. Returns false on timeout or malformed reply.
+ */
+bool sleep_clock_sntp_sync(WiFiUDP &udp, const char *server);
+
+/**
+ * Timer wakeup in microseconds for a sleep of period_s wall seconds,
+ * corrected with the smoothed RTC drift. With align and a synced clock the
+ * sleep instead ends on the next multiple of period_s, at least half a
+ * period away; only meaningful for a fixed period.
+ */
+uint64_t sleep_clock_sleep_us(uint32_t period_s, bool align);
+
+/**
+ * Wall seconds the sleep that just ended lasted, drift corrected. 0 when
+ * this was not a timer wakeup.
+ */
+float sleep_clock_slept_s();
+
+float sleep_clock_drift();
+float sleep_clock_error_estimate();
+
+#endif
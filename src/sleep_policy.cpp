@@ -0,0 +1,126 @@
+#include <math.h>
+#include <string.h>
+
+#include "sleep_policy.h"
+
+#define SLEEP_POLICY_MAGIC 0x534C5032
+
+static const int32_t steps[3] = {SLEEP_POLICY_TEMPERATURE_STEP, SLEEP_POLICY_HUMIDITY_STEP, SLEEP_POLICY_PRESSURE_STEP};
+
+void sleep_policy_init(SleepPolicyState *state, uint32_t base_s)
+{
+  if (state->magic == SLEEP_POLICY_MAGIC)
+  {
+    return;
+  }
+  memset(state, 0, sizeof(*state));
+  state->magic = SLEEP_POLICY_MAGIC;
+  state->interval_s = base_s;
+  state->activity = -1.0f; // unknown until two wakes have been seen
+}
+
+uint32_t sleep_policy_wake(SleepPolicyState *state, uint32_t slept_s)
+{
+  uint32_t elapsed_s = slept_s ? slept_s + state->last_awake_ms / 1000 : 0;
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    // -- An unknown gap makes the count meaningless until the tag is seen again.
+    if (elapsed_s == 0 || state->since_last_s[tag] == UINT32_MAX)
+    {
+      state->since_last_s[tag] = UINT32_MAX;
+    }
+    else
+    {
+      state->since_last_s[tag] += elapsed_s;
+    }
+  }
+  return elapsed_s;
+}
+
+void sleep_policy_observe(SleepPolicyState *state, int tag, const RuuviReading *reading)
+{
+  if (tag < 0 || tag >= RUUVI_TAG_COUNT)
+  {
+    return;
+  }
+
+  int32_t values[3] = {reading->temperature, reading->humidity, reading->pressure};
+  uint32_t span_s = state->since_last_s[tag];
+  if (reading->timestamp && state->last_time[tag] && reading->timestamp > state->last_time[tag])
+  {
+    span_s = reading->timestamp - state->last_time[tag];
+  }
+  if (state->have_last[tag] && span_s >= SLEEP_POLICY_MIN_SPAN_S && span_s != UINT32_MAX)
+  {
+    float hours = span_s / 3600.0f;
+    state->wake_measured = true;
+    for (int i = 0; i < 3; i++)
+    {
+      float change = fabsf((float)(values[i] - state->last[tag][i])) / steps[i] / hours;
+      if (change > state->wake_activity)
+      {
+        state->wake_activity = change;
+      }
+    }
+  }
+
+  memcpy(state->last[tag], values, sizeof(values));
+  state->last_time[tag] = reading->timestamp;
+  state->since_last_s[tag] = 0;
+  state->have_last[tag] = true;
+}
+
+uint32_t sleep_policy_interval(SleepPolicyState *state, uint32_t base_s, int battery_percent, uint32_t awake_ms)
+{
+  // -- A wake without a rate (timed out, or first after a reset) leaves the activity alone.
+  if (state->wake_measured)
+  {
+    state->activity = state->activity < 0 ? state->wake_activity
+                                          : (1.0f - SLEEP_POLICY_SMOOTHING) * state->activity + SLEEP_POLICY_SMOOTHING * state->wake_activity;
+  }
+  state->wake_activity = 0;
+  state->wake_measured = false;
+  state->awake_ms = state->awake_ms == 0 ? awake_ms : (state->awake_ms + awake_ms) / 2;
+  state->last_awake_ms = awake_ms;
+
+  // -- Refresh about once per unit of change: one unit per hour gives an hour of sleep.
+  float interval = state->activity > 0 ? 3600.0f / state->activity : (float)SLEEP_POLICY_MAX_S;
+  if (state->activity < 0)
+  {
+    interval = base_s;
+  }
+
+  if (battery_percent <= SLEEP_POLICY_CRITICAL_BATTERY)
+  {
+    interval = SLEEP_POLICY_MAX_S;
+  }
+  else if (battery_percent < SLEEP_POLICY_LOW_BATTERY)
+  {
+    interval *= (float)SLEEP_POLICY_LOW_BATTERY / battery_percent;
+  }
+
+  if (interval < SLEEP_POLICY_MIN_S)
+  {
+    interval = SLEEP_POLICY_MIN_S;
+  }
+  if (interval > SLEEP_POLICY_MAX_S)
+  {
+    interval = SLEEP_POLICY_MAX_S;
+  }
+
+  state->interval_s = (uint32_t)interval;
+  return state->interval_s;
+}
+
+float sleep_policy_battery_days(const SleepPolicyState *state, int battery_percent)
+{
+  float awake_s = state->awake_ms / 1000.0f;
+  float cycle_s = awake_s + state->interval_s;
+  if (cycle_s <= 0)
+  {
+    return 0;
+  }
+  float average_ma = (awake_s * AWAKE_CURRENT_MA + state->interval_s * SLEEP_CURRENT_MA) / cycle_s;
+  float remaining_mah = BATTERY_CAPACITY_MAH * battery_percent / 100.0f;
+  return remaining_mah / average_ma / 24.0f;
+}
@@ -0,0 +1,79 @@
+#ifndef SLEEP_POLICY_H_
+#define SLEEP_POLICY_H_
+
+#include <stdint.h>
+#include "ruuvi.h"
+
+// -- Bounds for the adaptive sleep interval (seconds).
+#define SLEEP_POLICY_MIN_S (60 * 10)
+#define SLEEP_POLICY_MAX_S (60 * 90)
+
+// -- Change per hour that counts as one unit of activity for each displayed value.
+#define SLEEP_POLICY_TEMPERATURE_STEP 50 // 0.50 °C
+#define SLEEP_POLICY_HUMIDITY_STEP 200   // 2.00 %
+#define SLEEP_POLICY_PRESSURE_STEP 100   // 1 hPa
+
+// -- Readings closer together than this are too noisy to give a rate of change.
+#define SLEEP_POLICY_MIN_SPAN_S 60
+
+// -- Weight of the latest wake in the smoothed activity.
+#define SLEEP_POLICY_SMOOTHING 0.5f
+
+// -- Below these charge levels the interval is stretched, at the critical level it is maxed.
+#define SLEEP_POLICY_LOW_BATTERY 30
+#define SLEEP_POLICY_CRITICAL_BATTERY 10
+
+// -- Energy model for the battery life projection.
+#define BATTERY_CAPACITY_MAH 2000.0f
+#define AWAKE_CURRENT_MA 110.0f
+#define SLEEP_CURRENT_MA 0.17f
+
+/**
+ * Kept in RTC memory across deep sleep. All functions are plain C++ so
+ * the policy can be replayed on a host against recorded traces.
+ */
+typedef struct
+{
+  uint32_t magic;
+  int32_t last[RUUVI_TAG_COUNT][3];       // last displayed temperature, humidity, pressure
+  uint32_t last_time[RUUVI_TAG_COUNT];    // measurement time of those values, 0 if unknown
+  uint32_t since_last_s[RUUVI_TAG_COUNT]; // wall seconds since those values, UINT32_MAX if unknown
+  bool have_last[RUUVI_TAG_COUNT];
+  float activity;         // smoothed change per hour in units of the steps above
+  float wake_activity;    // largest change seen during the current wake
+  bool wake_measured;     // whether any tag gave a rate during the current wake
+  uint32_t interval_s;    // interval chosen for the sleep that ended
+  uint32_t awake_ms;      // smoothed awake time per wake
+  uint32_t last_awake_ms; // awake time of the previous wake
+} SleepPolicyState;
+
+void sleep_policy_init(SleepPolicyState *state, uint32_t base_s);
+
+/**
+ * Start a wake that follows a sleep of slept_s wall seconds, 0 when the
+ * wake was not a timer wake and the time away is unknown. Returns the wall
+ * seconds since the previous wake started.
+ */
+uint32_t sleep_policy_wake(SleepPolicyState *state, uint32_t slept_s);
+
+/**
+ * Record a value that is about to be displayed for tag. The change since
+ * the last displayed value is turned into a rate over the time between the
+ * two measurement timestamps, or over the wall time counted by
+ * sleep_policy_wake() when either has none. A wake that timed out and
+ * skipped a tag therefore does not inflate its rate.
+ */
+void sleep_policy_observe(SleepPolicyState *state, int tag, const RuuviReading *reading);
+
+/**
+ * Choose the next sleep interval from the observed activity and the
+ * battery charge level (percent). Call once per wake, before sleeping.
+ */
+uint32_t sleep_policy_interval(SleepPolicyState *state, uint32_t base_s, int battery_percent, uint32_t awake_ms);
+
+/**
+ * Days the remaining charge lasts if every wake uses the last chosen interval.
+ */
+float sleep_policy_battery_days(const SleepPolicyState *state, int battery_percent);
+
+#endif
@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "snapshot.h"
+
+#define SNAPSHOT_MAX_WIDTH 960
+// -- Compressed bytes are sent as an IDAT chunk once this much is pending.
+// -- A row can add at most 9 bits per byte, so the buffer keeps room for one more row.
+#define PNG_FLUSH_AT 1024
+#define PNG_OUT_SIZE (PNG_FLUSH_AT + (SNAPSHOT_MAX_WIDTH + 1) * 9 / 8 + 16)
+#define DEFLATE_MAX_MATCH 258
+
+typedef struct
+{
+  uint8_t out[PNG_OUT_SIZE];
+  size_t length;
+  uint32_t bits;
+  int bit_count;
+  uint32_t adler_a;
+  uint32_t adler_b;
+  SnapshotSink sink;
+  void *context;
+} PngWriter;
+
+// -- Filter byte followed by one row of 8-bit gray.
+static uint8_t line[SNAPSHOT_MAX_WIDTH + 1];
+static PngWriter png;
+
+static const uint16_t length_base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                         35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t length_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                         3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+static void unpack_row(const uint8_t *framebuffer, int width, int y, uint8_t *gray)
+{
+  const uint8_t *row = framebuffer + y * ((width + 1) / 2);
+  for (int x = 0; x < width; x++)
+  {
+    uint8_t nibble = (x & 1) ? row[x / 2] >> 4 : row[x / 2] & 0x0F;
+    gray[x] = nibble * 0x11;
+  }
+}
+
+void snapshot_write_pgm(const uint8_t *framebuffer, int width, int height, SnapshotSink sink, void *context)
+{
+  if (width > SNAPSHOT_MAX_WIDTH)
+  {
+    return;
+  }
+  char header[32];
+  int n = snprintf(header, sizeof(header), "P5\n%d %d\n255\n", width, height);
+  sink((const uint8_t *)header, n, context);
+  for (int y = 0; y < height; y++)
+  {
+    unpack_row(framebuffer, width, y, line);
+    sink(line, width, context);
+  }
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t length)
+{
+  static const uint32_t table[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+      0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  for (size_t i = 0; i < length; i++)
+  {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+  }
+  return crc;
+}
+
+static void put_u32(uint8_t *p, uint32_t value)
+{
+  p[0] = value >> 24;
+  p[1] = value >> 16;
+  p[2] = value >> 8;
+  p[3] = value;
+}
+
+static void write_chunk(const char *type, const uint8_t *data, size_t length)
+{
+  uint8_t header[8];
+  put_u32(header, length);
+  memcpy(header + 4, type, 4);
+  uint32_t crc = crc32_update(0xFFFFFFFF, header + 4, 4);
+  crc = crc32_update(crc, data, length) ^ 0xFFFFFFFF;
+  uint8_t footer[4];
+  put_u32(footer, crc);
+
+  png.sink(header, sizeof(header), png.context);
+  if (length > 0)
+  {
+    png.sink(data, length, png.context);
+  }
+  png.sink(footer, sizeof(footer), png.context);
+}
+
+static void put_bits(uint32_t value, int count)
+{
+  png.bits |= value << png.bit_count;
+  png.bit_count += count;
+  while (png.bit_count >= 8)
+  {
+    png.out[png.length++] = png.bits & 0xFF;
+    png.bits >>= 8;
+    png.bit_count -= 8;
+  }
+}
+
+// -- Huffman codes are stored most significant bit first.
+static void put_code(uint32_t code, int count)
+{
+  uint32_t reversed = 0;
+  for (int i = 0; i < count; i++)
+  {
+    reversed = (reversed << 1) | ((code >> i) & 1);
+  }
+  put_bits(reversed, count);
+}
+
+static void put_literal(uint8_t literal)
+{
+  if (literal < 144)
+  {
+    put_code(0x30 + literal, 8);
+  }
+  else
+  {
+    put_code(0x190 + literal - 144, 9);
+  }
+}
+
+static void put_run(int length)
+{
+  int i = 28;
+  while (length_base[i] > length)
+  {
+    --i;
+  }
+  int symbol = 257 + i;
+  if (symbol < 280)
+  {
+    put_code(symbol - 256, 7);
+  }
+  else
+  {
+    put_code(0xC0 + symbol - 280, 8);
+  }
+  put_bits(length - length_base[i], length_extra[i]);
+  put_code(0, 5); // distance 1
+}
+
+static void deflate_row(const uint8_t *data, int length)
+{
+  int i = 0;
+  while (i < length)
+  {
+    put_literal(data[i]);
+    int run = 0;
+    while (i + 1 + run < length && data[i + 1 + run] == data[i])
+    {
+      ++run;
+    }
+    i += 1 + run;
+    while (run >= 3)
+    {
+      int match = run > DEFLATE_MAX_MATCH ? DEFLATE_MAX_MATCH : run;
+      put_run(match);
+      run -= match;
+    }
+    while (run-- > 0)
+    {
+      put_literal(data[i - 1]);
+    }
+  }
+
+  for (int k = 0; k < length; k++)
+  {
+    png.adler_a = (png.adler_a + data[k]) % 65521;
+    png.adler_b = (png.adler_b + png.adler_a) % 65521;
+  }
+}
+
+static void flush_idat()
+{
+  if (png.length > 0)
+  {
+    write_chunk("IDAT", png.out, png.length);
+    png.length = 0;
+  }
+}
+
+void snapshot_write_png(const uint8_t *framebuffer, int width, int height, SnapshotSink sink, void *context)
+{
+  if (width > SNAPSHOT_MAX_WIDTH)
+  {
+    return;
+  }
+  static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  memset(&png, 0, sizeof(png));
+  png.sink = sink;
+  png.context = context;
+  png.adler_a = 1;
+
+  sink(signature, sizeof(signature), context);
+  uint8_t ihdr[13];
+  put_u32(ihdr, width);
+  put_u32(ihdr + 4, height);
+  ihdr[8] = 8;  // bit depth
+  ihdr[9] = 0;  // grayscale
+  ihdr[10] = 0; // deflate
+  ihdr[11] = 0; // adaptive filtering, only filter type 0 is used
+  ihdr[12] = 0; // no interlace
+  write_chunk("IHDR", ihdr, sizeof(ihdr));
+
+  png.out[png.length++] = 0x78; // zlib header, 32K window
+  png.out[png.length++] = 0x01;
+  put_bits(1, 1); // final block
+  put_bits(1, 2); // fixed Huffman codes
+
+  line[0] = 0; // filter type none
+  for (int y = 0; y < height; y++)
+  {
+    unpack_row(framebuffer, width, y, line + 1);
+    deflate_row(line, width + 1);
+    if (png.length >= PNG_FLUSH_AT)
+    {
+      flush_idat();
+    }
+  }
+
+  put_code(0, 7); // end of block
+  if (png.bit_count > 0)
+  {
+    put_bits(0, 8 - png.bit_count);
+  }
+  put_u32(png.out + png.length, (png.adler_b << 16) | png.adler_a);
+  png.length += 4;
+  flush_idat();
+  write_chunk("IEND", NULL, 0);
+}
+
+#ifndef ARDUINO
+static void file_sink(const uint8_t *data, size_t length, void *context)
+{
+  fwrite(data, 1, length, (FILE *)context);
+}
+
+bool snapshot_save(const uint8_t *framebuffer, int width, int height, const char *path)
+{
+  FILE *file = fopen(path, "wb");
+  if (!file)
+  {
+    return false;
+  }
+  size_t n = strlen(path);
+  if (n > 4 && strcmp(path + n - 4, ".png") == 0)
+  {
+    snapshot_write_png(framebuffer, width, height, file_sink, file);
+  }
+  else
+  {
+    snapshot_write_pgm(framebuffer, width, height, file_sink, file);
+  }
+  return fclose(file) == 0;
+}
+#endif
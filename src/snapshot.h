@@ -0,0 +1,33 @@
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Receives the encoded image piece by piece. Every call hands over at
+ * most a few rows, the framebuffer is never copied as a whole.
+ */
+typedef void (*SnapshotSink)(const uint8_t *data, size_t length, void *context);
+
+/**
+ * Encode a 4bpp framebuffer (two pixels per byte, left pixel in the low
+ * nibble) as an 8-bit binary PGM.
+ */
+void snapshot_write_pgm(const uint8_t *framebuffer, int width, int height, SnapshotSink sink, void *context);
+
+/**
+ * Encode a 4bpp framebuffer as an 8-bit grayscale PNG. The deflate stream
+ * uses fixed Huffman codes with run length (distance 1) matches, which
+ * suits the mostly white panel content and needs no window memory.
+ */
+void snapshot_write_png(const uint8_t *framebuffer, int width, int height, SnapshotSink sink, void *context);
+
+#ifndef ARDUINO
+/**
+ * Dump a framebuffer to path, PNG when it ends in ".png" and PGM otherwise.
+ */
+bool snapshot_save(const uint8_t *framebuffer, int width, int height, const char *path);
+#endif
+
+#endif
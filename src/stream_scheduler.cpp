@@ -0,0 +1,75 @@
+#include <string.h>
+
+#include "stream_scheduler.h"
+
+#define STREAM_MINUTE_MS 60000
+
+void stream_scheduler_init(StreamScheduler *scheduler, const StreamConfig *config, uint32_t now_ms)
+{
+  memset(scheduler, 0, sizeof(*scheduler));
+  scheduler->config = *config;
+  if (scheduler->config.max_per_minute < 1)
+  {
+    scheduler->config.max_per_minute = 1;
+  }
+  if (scheduler->config.max_per_minute > STREAM_MAX_REFRESHES_PER_MINUTE)
+  {
+    scheduler->config.max_per_minute = STREAM_MAX_REFRESHES_PER_MINUTE;
+  }
+  scheduler->spacing_ms = STREAM_MINUTE_MS / scheduler->config.max_per_minute;
+  scheduler->last_full_ms = now_ms;
+}
+
+void stream_scheduler_mark(StreamScheduler *scheduler, uint32_t now_ms)
+{
+  ++scheduler->updates;
+  if (scheduler->pending)
+  {
+    ++scheduler->coalesced;
+  }
+  else
+  {
+    scheduler->first_pending_ms = now_ms;
+  }
+  scheduler->pending = true;
+}
+
+// -- Whether the previous refresh started less than the spacing ago, which keeps any minute under the cap.
+static bool rate_limited(const StreamScheduler *scheduler, uint32_t now_ms)
+{
+  // -- Unsigned differences survive the millis() wrap.
+  return scheduler->refreshed && now_ms - scheduler->last_refresh_ms < scheduler->spacing_ms;
+}
+
+StreamAction stream_scheduler_poll(StreamScheduler *scheduler, uint32_t now_ms)
+{
+  bool full_due = scheduler->config.full_refresh_ms && now_ms - scheduler->last_full_ms >= scheduler->config.full_refresh_ms;
+  bool partial_due = scheduler->pending && now_ms - scheduler->first_pending_ms >= scheduler->config.coalesce_ms;
+  if (!full_due && !partial_due)
+  {
+    return STREAM_IDLE;
+  }
+  if (rate_limited(scheduler, now_ms))
+  {
+    if (!scheduler->held)
+    {
+      ++scheduler->rate_limited;
+      scheduler->held = true;
+    }
+    return STREAM_IDLE;
+  }
+
+  scheduler->held = false;
+  scheduler->refreshed = true;
+  scheduler->last_refresh_ms = now_ms;
+  // -- A full refresh shows the pending updates as well.
+  scheduler->pending = false;
+  if (full_due)
+  {
+    scheduler->last_full_ms = now_ms;
+    ++scheduler->full_refreshes;
+    return STREAM_FULL;
+  }
+  ++scheduler->refreshes;
+  return STREAM_PARTIAL;
+}
@@ -0,0 +1,61 @@
+#ifndef STREAM_SCHEDULER_H_
+#define STREAM_SCHEDULER_H_
+
+#include <stdint.h>
+
+// -- Upper bound of the refreshes per minute setting.
+#define STREAM_MAX_REFRESHES_PER_MINUTE 30
+
+typedef enum
+{
+  STREAM_IDLE,    // nothing to do yet
+  STREAM_PARTIAL, // refresh the regions that changed
+  STREAM_FULL     // timed clean refresh of the whole panel
+} StreamAction;
+
+typedef struct
+{
+  uint32_t coalesce_ms;       // updates arriving within this window share a refresh
+  uint32_t max_per_minute;    // refreshes allowed in any 60 s, 1 to STREAM_MAX_REFRESHES_PER_MINUTE
+  uint32_t full_refresh_ms;   // clean refresh of the whole panel this often, 0 never
+} StreamConfig;
+
+/**
+ * Refresh scheduling of the always on mode. Plain C++ on millis() values,
+ * so days of traffic can be replayed on a host.
+ */
+typedef struct
+{
+  StreamConfig config;
+  bool pending;               // updates arrived that are not on the panel yet
+  uint32_t first_pending_ms;  // arrival of the oldest of them
+  uint32_t last_full_ms;
+  uint32_t last_refresh_ms;   // start of the latest refresh of either kind
+  uint32_t spacing_ms;        // refreshes start at least this far apart, a minute / max_per_minute
+  bool refreshed;             // last_refresh_ms is set
+  bool held;                  // a due refresh is waiting for the cap
+  // -- Counters for the status page.
+  uint32_t updates;           // updates marked
+  uint32_t refreshes;         // partial refreshes
+  uint32_t full_refreshes;
+  uint32_t coalesced;         // updates that joined an already pending refresh
+  uint32_t rate_limited;      // due refreshes that had to wait for the cap
+} StreamScheduler;
+
+void stream_scheduler_init(StreamScheduler *scheduler, const StreamConfig *config, uint32_t now_ms);
+
+/**
+ * An update arrived. Which regions it changed is left to the frame diff.
+ */
+void stream_scheduler_mark(StreamScheduler *scheduler, uint32_t now_ms);
+
+/**
+ * What to refresh now. A partial refresh is due once the oldest pending
+ * update is coalesce_ms old, a full one every full_refresh_ms. Refreshes are
+ * spread evenly under the cap, one per minute / max_per_minute, so a busy
+ * tag waits at most coalesce_ms plus that spacing instead of the rest of a
+ * minute after a burst. The returned action counts as started.
+ */
+StreamAction stream_scheduler_poll(StreamScheduler *scheduler, uint32_t now_ms);
+
+#endif
@@ -0,0 +1,47 @@
+#include <Arduino.h>
+
+#include "telemetry.h"
+
+#define TELEMETRY_MAGIC 0x544C4D33
+
+const char *const wake_phase_names[PHASE_COUNT] = {"setup", "wifi", "mqtt", "data", "refresh"};
+const char *const payload_format_names[PAYLOAD_FORMAT_COUNT] = {"json", "msgpack"};
+
+RTC_DATA_ATTR TelemetryCounters telemetry_counters;
+Telemetry telemetry;
+
+void telemetry_wake()
+{
+  if (telemetry_counters.magic != TELEMETRY_MAGIC)
+  {
+    memset(&telemetry_counters, 0, sizeof(telemetry_counters));
+    telemetry_counters.magic = TELEMETRY_MAGIC;
+  }
+  ++telemetry_counters.wakes;
+}
+
+void telemetry_mark(WakePhase phase)
+{
+  if (telemetry.phase_ms[phase] == 0)
+  {
+    telemetry.phase_ms[phase] = millis();
+  }
+}
+
+void telemetry_sleep(uint32_t awake_ms, uint32_t refresh_ms, uint32_t teardown_ms, bool sequential)
+{
+  telemetry_counters.last_wake.awake_ms = awake_ms;
+  telemetry_counters.last_wake.refresh_ms = refresh_ms;
+  telemetry_counters.last_wake.teardown_ms = teardown_ms;
+  telemetry_counters.last_wake.sequential = sequential;
+}
+
+uint32_t telemetry_sequential_ms(const WakeTiming *timing)
+{
+  if (timing->sequential)
+  {
+    return timing->awake_ms;
+  }
+  uint32_t overlap = timing->teardown_ms < timing->refresh_ms ? timing->teardown_ms : timing->refresh_ms;
+  return timing->awake_ms + overlap;
+}
@@ -0,0 +1,90 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include "ruuvi.h"
+#include "fb_diff.h"
+
+// -- Milestones of one wake, in the order they normally happen.
+typedef enum
+{
+  PHASE_SETUP,
+  PHASE_WIFI,
+  PHASE_MQTT,
+  PHASE_DATA,
+  PHASE_REFRESH,
+  PHASE_COUNT
+} WakePhase;
+
+extern const char *const wake_phase_names[PHASE_COUNT];
+
+// -- Encodings accepted on the reading topics.
+typedef enum
+{
+  PAYLOAD_JSON,
+  PAYLOAD_MSGPACK,
+  PAYLOAD_FORMAT_COUNT
+} PayloadFormat;
+
+extern const char *const payload_format_names[PAYLOAD_FORMAT_COUNT];
+
+// -- Where the time of the last finished wake went.
+typedef struct
+{
+  uint32_t awake_ms;    // boot to deep sleep
+  uint32_t refresh_ms;  // panel refresh
+  uint32_t teardown_ms; // radio shutdown, next to the refresh or before it
+  bool sequential;      // built with WEATHER_SEQUENTIAL_TEARDOWN, teardown ran before the refresh
+} WakeTiming;
+
+// -- Counters that survive deep sleep.
+typedef struct
+{
+  uint32_t magic;
+  uint32_t wakes;
+  uint32_t refreshes;
+  uint32_t timeouts;
+  WakeTiming last_wake;
+} TelemetryCounters;
+
+// -- Per wake measurements, reset on every boot.
+typedef struct
+{
+  uint32_t phase_ms[PHASE_COUNT];               // millis() when the phase was reached, 0 if not yet
+  uint32_t tag_received_ms[RUUVI_TAG_COUNT];    // millis() of the last reading per tag
+  uint32_t messages;
+  uint32_t parse_errors;
+  uint32_t queue_drops;                         // readings lost because the render loop fell behind
+  uint32_t payloads[PAYLOAD_FORMAT_COUNT];      // messages per encoding
+  uint32_t payload_bytes[PAYLOAD_FORMAT_COUNT]; // bytes on the wire per encoding
+  uint32_t decode_us[PAYLOAD_FORMAT_COUNT];     // total decode time per encoding
+  FbDiff changed;                               // new frame against what the panel showed
+} Telemetry;
+
+extern TelemetryCounters telemetry_counters;
+extern Telemetry telemetry;
+
+/**
+ * Count the wake. Call once early in setup().
+ */
+void telemetry_wake();
+
+/**
+ * Record the first time a phase is reached.
+ */
+void telemetry_mark(WakePhase phase);
+
+/**
+ * Keep the timing of this wake for the next one. Call right before deep
+ * sleep.
+ */
+void telemetry_sleep(uint32_t awake_ms, uint32_t refresh_ms, uint32_t teardown_ms, bool sequential);
+
+/**
+ * Awake time with the radio shut down before the refresh instead of next
+ * to it. Measured when the wake ran that way, otherwise estimated: the
+ * overlap, the shorter of the two, is added back.
+ */
+uint32_t telemetry_sequential_ms(const WakeTiming *timing);
+
+#endif
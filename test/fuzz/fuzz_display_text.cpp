@@ -0,0 +1,56 @@
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "display_list.h"
+#include "opensans12b_lut.h"
+#include "opensans16b_lut.h"
+#include "opensans24b_lut.h"
+
+// -- Header bytes: font, x and y as little endian int16, alignment; the rest
+// -- is the text, any bytes. The text is laid out and rasterized band by
+// -- band; traps when ink lands outside the measured bounds of the item.
+static const FontLookup *const fonts[] = {&OpenSans12BLookup, &OpenSans16BLookup, &OpenSans24BLookup};
+static const int alignments[] = {EPD_DRAW_ALIGN_LEFT, EPD_DRAW_ALIGN_RIGHT, EPD_DRAW_ALIGN_CENTER, 0};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (size < 6)
+  {
+    return 0;
+  }
+  static DisplayList list;
+  const FontLookup *font = fonts[data[0] % 3];
+  int x = (int16_t)(data[1] | data[2] << 8);
+  int y = (int16_t)(data[3] | data[4] << 8);
+  int flags = alignments[data[5] % 4];
+  std::string text((const char *)data + 6, size - 6);
+
+  display_list_clear(&list);
+  display_list_add_text(&list, font, text.c_str(), x, y, flags, NULL);
+  const DisplayItem *item = &list.items[0];
+
+  // -- Exactly sized so ASan catches a write past the band.
+  std::vector<uint8_t> band(EPD_WIDTH / 2 * DISPLAY_BAND_HEIGHT);
+  for (int band_y = 0; band_y < EPD_HEIGHT; band_y += DISPLAY_BAND_HEIGHT)
+  {
+    int height = EPD_HEIGHT - band_y < DISPLAY_BAND_HEIGHT ? EPD_HEIGHT - band_y : DISPLAY_BAND_HEIGHT;
+    memset(band.data(), 0xFF, band.size());
+    display_list_render_band(&list, band_y, height, band.data());
+    for (int row = 0; row < height; row++)
+    {
+      for (int column = 0; column < EPD_WIDTH; column++)
+      {
+        uint8_t pixel = band[row * EPD_WIDTH / 2 + column / 2] >> (column & 1 ? 4 : 0) & 0x0F;
+        int py = band_y + row;
+        if (pixel != 0x0F && (column < item->x || column >= item->x + item->width || py < item->y ||
+                              py >= item->y + item->height))
+        {
+          __builtin_trap();
+        }
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "layout.h"
+
+// -- Temperature, humidity, pressure and battery as four little endian
+// -- int32, then the local time as int64. Formatted as they came and again
+// -- clamped as the firmware stores them; traps unless every text is
+// -- terminated inside its buffer and reads back as the value.
+static int32_t read_int32(const uint8_t *data)
+{
+  return (int32_t)((uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24);
+}
+
+static void check(const RuuviReading *reading, const TagText *text, bool clamped)
+{
+  const double values[4] = {reading->temperature / 100.0, reading->humidity / 100.0, reading->pressure * 0.01,
+                            reading->battery / 1000.0};
+  for (int i = 0; i < 4; i++)
+  {
+    size_t length = strnlen(text->values[i], sizeof(text->values[i]));
+    // -- Clamped values fill the 7 character column exactly.
+    if (length == sizeof(text->values[i]) || (clamped && length != 7))
+    {
+      __builtin_trap();
+    }
+    double parsed = strtod(text->values[i], NULL);
+    if (!(parsed - values[i] < 0.0051 && values[i] - parsed < 0.0051))
+    {
+      __builtin_trap();
+    }
+  }
+  if (strnlen(text->datetime, sizeof(text->datetime)) == sizeof(text->datetime))
+  {
+    __builtin_trap();
+  }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (size < 24)
+  {
+    return 0;
+  }
+  RuuviReading reading;
+  memset(&reading, 0, sizeof(reading));
+  reading.temperature = read_int32(data);
+  reading.humidity = read_int32(data + 4);
+  reading.pressure = read_int32(data + 8);
+  reading.battery = read_int32(data + 12);
+  int64_t local_time = (int64_t)((uint64_t)(uint32_t)read_int32(data + 16) | (uint64_t)(uint32_t)read_int32(data + 20) << 32);
+
+  // -- Heap allocated, so ASan sees a write past the last buffer.
+  TagText *text = new TagText;
+  format_tag_text(&reading, (long)local_time, text);
+  check(&reading, text, false);
+
+  ruuvi_clamp(&reading);
+  format_tag_text(&reading, (long)local_time, text);
+  check(&reading, text, true);
+  delete text;
+  return 0;
+}
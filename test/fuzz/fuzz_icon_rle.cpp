@@ -0,0 +1,32 @@
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "icon.h"
+
+#define BUFFER_WIDTH 320
+#define BUFFER_ROWS 64
+
+// -- Header bytes: width, height, x, y, first buffer row, blit mode; the rest is the RLE data.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (size < 6)
+  {
+    return 0;
+  }
+  static uint8_t buffer[(BUFFER_WIDTH + 1) / 2 * BUFFER_ROWS];
+  // -- Exactly sized copy so reads past the data are caught.
+  std::vector<uint8_t> rle(data + 6, data + size);
+  Icon icon;
+  memset(&icon, 0, sizeof(icon));
+  icon.width = data[0] + 1;
+  icon.height = data[1] % 128 + 1;
+  icon.encoding = ICON_RLE;
+  icon.data = rle.data();
+  icon.size = rle.size();
+  int x = (int8_t)data[2];
+  int y = (int8_t)data[3];
+  int first_row = data[4] % 64;
+  icon_blit(&icon, buffer, BUFFER_WIDTH, first_row, BUFFER_ROWS, x, y, data[5] & 1 ? IMAGE_TRANSPARENT_WHITE : IMAGE_OPAQUE);
+  return 0;
+}
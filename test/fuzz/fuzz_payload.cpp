@@ -0,0 +1,32 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "ruuvi_payload.h"
+
+// -- The whole path of an MQTT message: format sniffing, deserialization and
+// -- reading extraction, with the document size the firmware uses.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  static StaticJsonDocument<768> doc;
+  const char *payload = (const char *)data;
+  PayloadFormat format = ruuvi_payload_format(payload, size);
+  if (ruuvi_payload_parse(doc, payload, size, format))
+  {
+    doc.clear();
+    return 0;
+  }
+  RuuviReading reading;
+  memset(&reading, 0, sizeof(reading));
+  if (ruuvi_payload_read(doc, &reading))
+  {
+    if (strnlen(reading.name, RUUVI_NAME_LEN) == RUUVI_NAME_LEN || reading.temperature < RUUVI_TEMPERATURE_MIN ||
+        reading.temperature > RUUVI_TEMPERATURE_MAX || reading.humidity < 0 || reading.humidity > RUUVI_HUMIDITY_MAX ||
+        reading.pressure < 0 || reading.pressure > RUUVI_PRESSURE_MAX || reading.battery < 0 ||
+        reading.battery > RUUVI_BATTERY_MAX)
+    {
+      __builtin_trap();
+    }
+  }
+  doc.clear();
+  return 0;
+}
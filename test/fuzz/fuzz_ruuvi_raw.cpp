@@ -0,0 +1,22 @@
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "ruuvi_raw.h"
+
+// -- The same bytes both as the hex text a gateway publishes and as binary AD structures.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  RuuviReading reading;
+  memset(&reading, 0, sizeof(reading));
+  std::string hex((const char *)data, size);
+  if (ruuvi_decode_hex(hex.c_str(), &reading) && strnlen(reading.name, RUUVI_NAME_LEN) == RUUVI_NAME_LEN)
+  {
+    __builtin_trap();
+  }
+  if (ruuvi_decode_advertisement(data, size, &reading) && strnlen(reading.name, RUUVI_NAME_LEN) == RUUVI_NAME_LEN)
+  {
+    __builtin_trap();
+  }
+  return 0;
+}
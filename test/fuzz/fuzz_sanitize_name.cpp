@@ -0,0 +1,50 @@
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "ruuvi.h"
+
+// -- Decodes what ruuvi_sanitize_name wrote and traps unless it is well formed
+// -- UTF-8 limited to the code points the fonts have.
+static void check(const char *name, size_t size)
+{
+  size_t length = strnlen(name, size);
+  if (length == size)
+  {
+    __builtin_trap(); // not terminated
+  }
+  const uint8_t *p = (const uint8_t *)name;
+  for (size_t i = 0; i < length; i++)
+  {
+    if (p[i] >= 0x20 && p[i] <= 0x7E)
+    {
+      continue;
+    }
+    // -- Only two byte sequences for U+00A0 to U+00FF can come out.
+    if ((p[i] != 0xC2 && p[i] != 0xC3) || i + 1 >= length || (p[i + 1] & 0xC0) != 0x80 ||
+        (p[i] == 0xC2 && p[i + 1] < 0xA0))
+    {
+      __builtin_trap();
+    }
+    ++i;
+  }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (size == 0)
+  {
+    return 0;
+  }
+  // -- First byte picks the destination size, exactly sized so ASan catches overruns.
+  size_t dst_size = data[0] % (RUUVI_NAME_LEN + 1);
+  std::string name((const char *)data + 1, size - 1);
+  char *dst = new char[dst_size ? dst_size : 1];
+  ruuvi_sanitize_name(dst, name.c_str(), dst_size);
+  if (dst_size > 0)
+  {
+    check(dst, dst_size);
+  }
+  delete[] dst;
+  return 0;
+}
@@ -0,0 +1,46 @@
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "ruuvi.h"
+
+// -- The three configured topics and the topic of the message, separated by
+// -- zero bytes; missing ones are empty. Traps unless the dispatch picked the
+// -- first configured topic equal to the message topic.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  std::string fields[RUUVI_TAG_COUNT + 1];
+  size_t field = 0;
+  for (size_t i = 0; i < size && field <= RUUVI_TAG_COUNT; i++)
+  {
+    if (data[i] == 0)
+    {
+      ++field;
+    }
+    else
+    {
+      fields[field] += (char)data[i];
+    }
+  }
+  const char *topics[RUUVI_TAG_COUNT];
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    topics[tag] = fields[tag].c_str();
+  }
+  const std::string &topic = fields[RUUVI_TAG_COUNT];
+
+  int found = ruuvi_topic_tag(topics, topic.c_str());
+  int expected = -1;
+  for (int tag = 0; tag < RUUVI_TAG_COUNT && expected < 0; tag++)
+  {
+    if (!fields[tag].empty() && fields[tag] == topic)
+    {
+      expected = tag;
+    }
+  }
+  if (found != expected)
+  {
+    __builtin_trap();
+  }
+  return 0;
+}
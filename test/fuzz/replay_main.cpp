@@ -0,0 +1,82 @@
+// -- Stand-in for libFuzzer's main when the compiler has none: runs every
+// -- file given, or every file in a given directory, through the harness.
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static int replay_file(const std::string &path)
+{
+  FILE *file = fopen(path.c_str(), "rb");
+  if (!file)
+  {
+    perror(path.c_str());
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+  {
+    data.insert(data.end(), chunk, chunk + length);
+  }
+  fclose(file);
+  // -- Empty inputs still get a valid pointer, like libFuzzer gives them.
+  data.reserve(1);
+  LLVMFuzzerTestOneInput(data.data(), data.size());
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  int inputs = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string path = argv[i];
+    if (path[0] == '-')
+    {
+      continue; // libFuzzer options
+    }
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+    {
+      perror(path.c_str());
+      return 1;
+    }
+    if (!S_ISDIR(info.st_mode))
+    {
+      if (replay_file(path))
+      {
+        return 1;
+      }
+      ++inputs;
+      continue;
+    }
+    DIR *dir = opendir(path.c_str());
+    struct dirent *entry;
+    while (dir && (entry = readdir(dir)) != NULL)
+    {
+      std::string file = path + "/" + entry->d_name;
+      if (entry->d_name[0] != '.' && stat(file.c_str(), &info) == 0 && S_ISREG(info.st_mode))
+      {
+        if (replay_file(file))
+        {
+          return 1;
+        }
+        ++inputs;
+      }
+    }
+    if (dir)
+    {
+      closedir(dir);
+    }
+  }
+  printf("Replayed %d inputs\n", inputs);
+  return inputs ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+#ifndef SHIM_ARDUINO_H_
+#define SHIM_ARDUINO_H_
+
+// -- The few Arduino core pieces the pure modules use, for the native test build.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <time.h>
+
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+
+// -- Right aligned in width characters with prec decimals, as avr-libc and the ESP32 core format it.
+inline char *dtostrf(double value, signed char width, unsigned char prec, char *out)
+{
+  sprintf(out, "%*.*f", width, prec, value);
+  return out;
+}
+
+inline unsigned long micros()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long)(now.tv_sec * 1000000UL + now.tv_nsec / 1000);
+}
+
+#endif
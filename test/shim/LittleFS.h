@@ -0,0 +1,78 @@
+#ifndef SHIM_LITTLEFS_H_
+#define SHIM_LITTLEFS_H_
+
+// -- LittleFS over stdio files in a host directory, enough for frame_store.
+// -- Tests point littlefs_shim_root() at a directory of their own.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <memory>
+#include <string>
+
+inline std::string &littlefs_shim_root()
+{
+  static std::string root = "/tmp";
+  return root;
+}
+
+class File
+{
+public:
+  File() {}
+  explicit File(FILE *file)
+  {
+    if (file)
+    {
+      file_.reset(file, fclose);
+    }
+  }
+
+  explicit operator bool() const { return file_ != nullptr; }
+
+  size_t read(uint8_t *data, size_t length) { return file_ ? fread(data, 1, length, file_.get()) : 0; }
+
+  size_t write(const uint8_t *data, size_t length) { return file_ ? fwrite(data, 1, length, file_.get()) : 0; }
+
+  bool seek(uint32_t position) { return file_ && fseek(file_.get(), position, SEEK_SET) == 0; }
+
+  size_t size() const
+  {
+    if (!file_)
+    {
+      return 0;
+    }
+    long position = ftell(file_.get());
+    fseek(file_.get(), 0, SEEK_END);
+    long end = ftell(file_.get());
+    fseek(file_.get(), position, SEEK_SET);
+    return end < 0 ? 0 : (size_t)end;
+  }
+
+  void close() { file_.reset(); }
+
+private:
+  std::shared_ptr<FILE> file_;
+};
+
+class LittleFSShim
+{
+public:
+  bool begin(bool format_on_fail)
+  {
+    (void)format_on_fail;
+    return true;
+  }
+
+  File open(const char *path, const char *mode)
+  {
+    std::string full = littlefs_shim_root() + path;
+    // -- "w" truncates and allows the seek back to the header, as LittleFS does.
+    return File(fopen(full.c_str(), mode[0] == 'w' ? "w+b" : "rb"));
+  }
+
+  bool remove(const char *path) { return ::remove((littlefs_shim_root() + path).c_str()) == 0; }
+};
+
+static LittleFSShim LittleFS __attribute__((unused));
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef SHIM_EPD_DRIVER_H_
+#define SHIM_EPD_DRIVER_H_
+
+// -- The parts of epdiy's epd_driver.h the pure modules use, for the native
+// -- test build. Types match epdiy so the generated font headers compile
+// -- unchanged; the panel is a framebuffer that epd_draw_image copies into.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EPD_WIDTH 960
+#define EPD_HEIGHT 540
+
+typedef struct
+{
+  uint8_t width;
+  uint8_t height;
+  uint8_t advance_x;
+  int16_t left;
+  int16_t top;
+  uint16_t compressed_size;
+  uint32_t data_offset;
+} EpdGlyph;
+
+typedef struct
+{
+  uint32_t first;
+  uint32_t last;
+  uint32_t offset;
+} EpdUnicodeInterval;
+
+typedef struct
+{
+  const uint8_t *bitmap;
+  const EpdGlyph *glyph;
+  const EpdUnicodeInterval *intervals;
+  uint32_t interval_count;
+  bool compressed;
+  uint16_t advance_y;
+  int ascender;
+  int descender;
+} EpdFont;
+
+typedef struct
+{
+  int x;
+  int y;
+  int width;
+  int height;
+} EpdRect;
+
+enum EpdFontFlags
+{
+  EPD_DRAW_BACKGROUND = 0x1,
+  EPD_DRAW_ALIGN_LEFT = 0x2,
+  EPD_DRAW_ALIGN_RIGHT = 0x4,
+  EPD_DRAW_ALIGN_CENTER = 0x8,
+};
+
+typedef struct
+{
+  uint8_t fg_color : 4;
+  uint8_t bg_color : 4;
+  uint32_t fallback_glyph;
+  enum EpdFontFlags flags;
+} EpdFontProperties;
+
+enum EpdDrawError
+{
+  EPD_DRAW_SUCCESS = 0x0,
+  EPD_DRAW_FAILED_ALLOC = 0x1,
+};
+
+typedef struct
+{
+  int unused;
+} EpdWaveform;
+
+inline const EpdWaveform *epd_shim_waveform()
+{
+  static const EpdWaveform waveform = {0};
+  return &waveform;
+}
+
+#define EPD_BUILTIN_WAVEFORM (epd_shim_waveform())
+
+inline EpdFontProperties epd_font_properties_default()
+{
+  EpdFontProperties props;
+  props.fg_color = 0;
+  props.bg_color = 15;
+  props.fallback_glyph = 0;
+  props.flags = EPD_DRAW_ALIGN_LEFT;
+  return props;
+}
+
+/**
+ * What epd_draw_image has put on the simulated panel, 4bpp like a
+ * framebuffer. Tests compare it with the expected frame.
+ */
+inline uint8_t *epd_shim_panel()
+{
+  static uint8_t panel[EPD_WIDTH / 2 * EPD_HEIGHT];
+  return panel;
+}
+
+inline enum EpdDrawError epd_draw_image(EpdRect area, const uint8_t *data, const EpdWaveform *waveform)
+{
+  (void)waveform;
+  uint8_t *panel = epd_shim_panel();
+  int stride = (area.width + 1) / 2;
+  for (int y = 0; y < area.height; y++)
+  {
+    for (int x = 0; x < area.width; x++)
+    {
+      int px = area.x + x;
+      int py = area.y + y;
+      if (px < 0 || px >= EPD_WIDTH || py < 0 || py >= EPD_HEIGHT)
+      {
+        continue;
+      }
+      uint8_t value = (data[y * stride + x / 2] >> (x & 1 ? 4 : 0)) & 0x0F;
+      uint8_t *out = panel + py * EPD_WIDTH / 2 + px / 2;
+      *out = px & 1 ? (*out & 0x0F) | value << 4 : (*out & 0xF0) | value;
+    }
+  }
+  return EPD_DRAW_SUCCESS;
+}
+
+// -- epdiy's interval scan, the reference font_lookup_glyph has to agree with.
+inline const EpdGlyph *epd_get_glyph(const EpdFont *font, uint32_t code_point)
+{
+  for (uint32_t i = 0; i < font->interval_count; i++)
+  {
+    const EpdUnicodeInterval *interval = &font->intervals[i];
+    if (code_point >= interval->first && code_point <= interval->last)
+    {
+      return &font->glyph[interval->offset + (code_point - interval->first)];
+    }
+    if (code_point < interval->first)
+    {
+      return NULL;
+    }
+  }
+  return NULL;
+}
+
+// -- Only black text on white is drawn in the layout, which never reaches epdiy's rasterizer.
+inline enum EpdDrawError epd_write_string(const EpdFont *font, const char *string, int *cursor_x, int *cursor_y,
+                                          uint8_t *framebuffer, const EpdFontProperties *properties)
+{
+  (void)font;
+  (void)cursor_x;
+  (void)cursor_y;
+  (void)framebuffer;
+  (void)properties;
+  fprintf(stderr, "epd_write_string is not emulated, drawing \"%s\"\n", string);
+  abort();
+}
+
+#endif
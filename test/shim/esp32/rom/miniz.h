@@ -0,0 +1,79 @@
+#ifndef SHIM_MINIZ_H_
+#define SHIM_MINIZ_H_
+
+// -- tinfl as the ESP32 ROM provides it, for the native test build. Glyphs
+// -- are inflated in one call into a buffer that fits them, so zlib's
+// -- inflate does the same job. Like the ROM it does not touch the heap:
+// -- zlib's state and window come from a static arena. Link with -lz.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zlib.h>
+
+#define TINFL_FLAG_PARSE_ZLIB_HEADER 1
+#define TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF 4
+
+typedef enum
+{
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+} tinfl_status;
+
+typedef struct
+{
+  int unused;
+} tinfl_decompressor;
+
+#define tinfl_init(r) ((void)(r))
+
+// -- Enough for inflate's state and a full 32 KiB window, handed out afresh for every call.
+static uint8_t tinfl_shim_arena[48 * 1024];
+static size_t tinfl_shim_used;
+
+inline voidpf tinfl_shim_alloc(voidpf opaque, uInt items, uInt size)
+{
+  (void)opaque;
+  size_t bytes = ((size_t)items * size + 15) & ~(size_t)15;
+  if (tinfl_shim_used + bytes > sizeof(tinfl_shim_arena))
+  {
+    return Z_NULL;
+  }
+  voidpf p = tinfl_shim_arena + tinfl_shim_used;
+  tinfl_shim_used += bytes;
+  return p;
+}
+
+inline void tinfl_shim_free(voidpf opaque, voidpf address)
+{
+  (void)opaque;
+  (void)address;
+}
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *in_size, uint8_t *out_start,
+                                     uint8_t *out_next, size_t *out_size, uint32_t flags)
+{
+  (void)r;
+  (void)out_start;
+  (void)flags;
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  stream.zalloc = tinfl_shim_alloc;
+  stream.zfree = tinfl_shim_free;
+  stream.next_in = (Bytef *)in;
+  stream.avail_in = (uInt)*in_size;
+  stream.next_out = out_next;
+  stream.avail_out = (uInt)*out_size;
+  tinfl_shim_used = 0;
+  if (inflateInit(&stream) != Z_OK)
+  {
+    return TINFL_STATUS_FAILED;
+  }
+  int status = inflate(&stream, Z_FINISH);
+  inflateEnd(&stream);
+  *in_size = stream.total_in;
+  *out_size = stream.total_out;
+  return status == Z_STREAM_END ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+}
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef SHIM_ESP_HEAP_CAPS_H_
+#define SHIM_ESP_HEAP_CAPS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT (1 << 2)
+
+inline void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+  (void)caps;
+  return malloc(size);
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SHIM_NATIVE_COMPAT_H_
+#define SHIM_NATIVE_COMPAT_H_
+
+// -- Included ahead of every file in the native build for what the ESP32
+// -- newlib has and older host C libraries lack.
+
+#include <string.h>
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+inline size_t strlcpy(char *dst, const char *src, size_t size)
+{
+  size_t length = strlen(src);
+  if (size)
+  {
+    size_t n = length < size - 1 ? length : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return length;
+}
+#endif
+
+#endif
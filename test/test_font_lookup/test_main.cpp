@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "font_lookup.h"
+#include "opensans12b_lut.h"
+#include "opensans16b_lut.h"
+#include "opensans24b_lut.h"
+
+// -- font_lookup_glyph against epdiy's interval scan. The generated fonts are
+// -- Latin-1 only and have no extra table, so a small hand made font with
+// -- intervals above 0xFF covers the binary search. Then the three ways of
+// -- measuring text against each other, and the measurement cache.
+
+#define LAST_CODE_POINT 0x11000
+#define RANDOM_STRINGS 20000
+
+static const FontLookup *const fonts[] = {&OpenSans12BLookup, &OpenSans16BLookup, &OpenSans24BLookup};
+static const GlyphMetrics *const metrics[] = {OpenSans12BMetrics, OpenSans16BMetrics, OpenSans24BMetrics};
+static uint32_t seed = 1;
+
+static uint32_t next_random()
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+static EpdGlyph test_glyphs[0xC9];
+
+static const EpdUnicodeInterval test_intervals[] = {
+    {0x20, 0x7E, 0x00},
+    {0xA0, 0xFF, 0x5F},
+    {0x2013, 0x2014, 0xBF},
+    {0x20AC, 0x20AC, 0xC1},
+    {0x2190, 0x2193, 0xC2},
+    {0xFB01, 0xFB02, 0xC6},
+    {0x10400, 0x10400, 0xC8},
+};
+
+static const EpdFont test_font = {NULL, test_glyphs, test_intervals, sizeof(test_intervals) / sizeof(test_intervals[0]),
+                                  true, 30, 24, -6};
+
+// -- What tools/font_lut.py emits for test_intervals from 0x100 up.
+static const FontLookupEntry test_extra[] = {
+    {0x2013, 0xBF}, {0x2014, 0xC0}, {0x20AC, 0xC1}, {0x2190, 0xC2}, {0x2191, 0xC3},
+    {0x2192, 0xC4}, {0x2193, 0xC5}, {0xFB01, 0xC6}, {0xFB02, 0xC7}, {0x10400, 0xC8},
+};
+
+#define TEST_EXTRA_COUNT (sizeof(test_extra) / sizeof(test_extra[0]))
+
+static uint16_t test_latin1[256];
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void build_test_font()
+{
+  for (size_t i = 0; i < sizeof(test_glyphs) / sizeof(test_glyphs[0]); i++)
+  {
+    test_glyphs[i].advance_x = (uint8_t)i;
+  }
+  for (int cp = 0; cp < 256; cp++)
+  {
+    const EpdGlyph *glyph = epd_get_glyph(&test_font, cp);
+    test_latin1[cp] = glyph ? (uint16_t)(glyph - test_glyphs) : FONT_LOOKUP_NONE;
+  }
+}
+
+static void assert_matches_scan(const FontLookup *lookup, uint32_t last)
+{
+  char message[64];
+  for (uint32_t cp = 0; cp <= last; cp++)
+  {
+    snprintf(message, sizeof(message), "code point 0x%X", (unsigned)cp);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(epd_get_glyph(lookup->font, cp), font_lookup_glyph(lookup, cp), message);
+  }
+}
+
+void test_generated_fonts_match_scan(void)
+{
+  for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(0, fonts[f]->extra_count);
+    assert_matches_scan(fonts[f], LAST_CODE_POINT);
+  }
+}
+
+void test_extra_table_matches_scan(void)
+{
+  const FontLookup lookup = {&test_font, test_latin1, test_extra, TEST_EXTRA_COUNT};
+  assert_matches_scan(&lookup, LAST_CODE_POINT);
+  TEST_ASSERT_EQUAL_PTR(&test_glyphs[0xC8], font_lookup_glyph(&lookup, 0x10400));
+  TEST_ASSERT_NULL(font_lookup_glyph(&lookup, 0x10401));
+  TEST_ASSERT_NULL(font_lookup_glyph(&lookup, 0xFFFFFFFF));
+}
+
+// -- Every table length from empty to full, so the search ends on both sides at odd and even sizes.
+void test_extra_table_lengths(void)
+{
+  static const uint32_t gaps[] = {0x100, 0x2012, 0x2015, 0x20AB, 0x20AD, 0x218F, 0x2194, 0xFB00, 0xFB03, 0x103FF, 0x10401};
+  for (uint16_t count = 0; count <= TEST_EXTRA_COUNT; count++)
+  {
+    const FontLookup lookup = {&test_font, test_latin1, test_extra, count};
+    for (uint16_t i = 0; i < TEST_EXTRA_COUNT; i++)
+    {
+      const EpdGlyph *expected = i < count ? &test_glyphs[test_extra[i].glyph] : NULL;
+      TEST_ASSERT_EQUAL_PTR(expected, font_lookup_glyph(&lookup, test_extra[i].code_point));
+    }
+    for (size_t i = 0; i < sizeof(gaps) / sizeof(gaps[0]); i++)
+    {
+      TEST_ASSERT_NULL(font_lookup_glyph(&lookup, gaps[i]));
+    }
+  }
+}
+
+static void assert_bounds_equal(const TextBounds *expected, const TextBounds *actual, const char *message)
+{
+  TEST_ASSERT_EQUAL_INT_MESSAGE(expected->left, actual->left, message);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(expected->right, actual->right, message);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(expected->top, actual->top, message);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(expected->bottom, actual->bottom, message);
+}
+
+// -- A label measured by the compiler, as layout.cpp does, against the runtime measurement.
+void test_constant_label(void)
+{
+  static constexpr TextBounds constant = font_measure_constant(OpenSans16BMetrics, "Kylmiö ÄÖÅ °C");
+  TextBounds measured;
+  font_measure(&OpenSans16BLookup, "Kylmiö ÄÖÅ °C", &measured);
+  assert_bounds_equal(&constant, &measured, "Kylmiö ÄÖÅ °C");
+}
+
+// -- Random Latin-1 strings as UTF-8, controls and other code points without a glyph included.
+void test_measure_ways_agree(void)
+{
+  char text[64];
+  for (int i = 0; i < RANDOM_STRINGS; i++)
+  {
+    int length = 1 + next_random() % 20;
+    char *out = text;
+    for (int c = 0; c < length; c++)
+    {
+      uint32_t cp = 1 + next_random() % 0xFF;
+      if (cp < 0x80)
+      {
+        *out++ = (char)cp;
+      }
+      else
+      {
+        *out++ = (char)(0xC0 | cp >> 6);
+        *out++ = (char)(0x80 | (cp & 0x3F));
+      }
+    }
+    *out = '\0';
+
+    for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+    {
+      TextBounds constant = font_measure_constant(metrics[f], text);
+      TextBounds measured;
+      TextBounds cached;
+      font_measure(fonts[f], text, &measured);
+      font_measure_cached(fonts[f], text, &cached);
+      assert_bounds_equal(&constant, &measured, text);
+      assert_bounds_equal(&measured, &cached, text);
+    }
+  }
+}
+
+void test_cache_hits_and_misses(void)
+{
+  // -- Different strings with the same 32 bit FNV-1a hash, so they share a slot and the hash.
+  static const char *const colliding[] = {"UUyR56", "pTk0Nu"};
+  TextBounds expected[2];
+  TextBounds bounds;
+  font_measure(&OpenSans16BLookup, colliding[0], &expected[0]);
+  font_measure(&OpenSans16BLookup, colliding[1], &expected[1]);
+  TEST_ASSERT_TRUE(memcmp(&expected[0], &expected[1], sizeof(TextBounds)) != 0);
+
+  TextCacheStats before = text_cache_stats;
+  font_measure_cached(&OpenSans16BLookup, colliding[0], &bounds);
+  assert_bounds_equal(&expected[0], &bounds, colliding[0]);
+  font_measure_cached(&OpenSans16BLookup, colliding[0], &bounds);
+  assert_bounds_equal(&expected[0], &bounds, colliding[0]);
+  TEST_ASSERT_EQUAL_UINT32(before.misses + 1, text_cache_stats.misses);
+  TEST_ASSERT_EQUAL_UINT32(before.hits + 1, text_cache_stats.hits);
+
+  font_measure_cached(&OpenSans16BLookup, colliding[1], &bounds);
+  assert_bounds_equal(&expected[1], &bounds, colliding[1]);
+  TEST_ASSERT_EQUAL_UINT32(before.misses + 2, text_cache_stats.misses);
+
+  // -- Same string in another font is another entry.
+  font_measure(&OpenSans24BLookup, colliding[1], &expected[0]);
+  font_measure_cached(&OpenSans24BLookup, colliding[1], &bounds);
+  assert_bounds_equal(&expected[0], &bounds, colliding[1]);
+  TEST_ASSERT_EQUAL_UINT32(before.misses + 3, text_cache_stats.misses);
+  TEST_ASSERT_EQUAL_UINT32(before.hits + 1, text_cache_stats.hits);
+
+  // -- Too long to keep, measured every time.
+  static const char long_text[] = "A line of text that is longer than any cache entry";
+  font_measure(&OpenSans16BLookup, long_text, &expected[0]);
+  for (int i = 0; i < 2; i++)
+  {
+    font_measure_cached(&OpenSans16BLookup, long_text, &bounds);
+    assert_bounds_equal(&expected[0], &bounds, long_text);
+  }
+  TEST_ASSERT_EQUAL_UINT32(before.misses + 5, text_cache_stats.misses);
+  TEST_ASSERT_EQUAL_UINT32(before.hits + 1, text_cache_stats.hits);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  build_test_font();
+  UNITY_BEGIN();
+  RUN_TEST(test_generated_fonts_match_scan);
+  RUN_TEST(test_extra_table_matches_scan);
+  RUN_TEST(test_extra_table_lengths);
+  RUN_TEST(test_constant_label);
+  RUN_TEST(test_measure_ways_agree);
+  RUN_TEST(test_cache_hits_and_misses);
+  return UNITY_END();
+}
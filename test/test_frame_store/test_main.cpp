@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <LittleFS.h>
+#include <unity.h>
+
+#include "frame_store.h"
+
+// -- Frame store slots as files in a temporary directory, through the LittleFS shim.
+#define FRAME_BYTES 4096
+
+static char root[] = "/tmp/frame_store_XXXXXX";
+static uint8_t frame[FRAME_BYTES];
+static uint8_t restored[FRAME_BYTES];
+
+static void fill(uint8_t *data, uint8_t seed)
+{
+  for (int i = 0; i < FRAME_BYTES; i++)
+  {
+    // -- Runs and literals both, as a real frame has.
+    data[i] = (i / 64) % 3 ? 0xFF : (uint8_t)(i * seed);
+  }
+}
+
+static void slot_file(char *path, size_t size, uint32_t slot)
+{
+  snprintf(path, size, "%s/frame%u.rle", root, (unsigned)slot);
+}
+
+static void corrupt_byte(uint32_t slot, long offset)
+{
+  char path[64];
+  slot_file(path, sizeof(path), slot);
+  FILE *file = fopen(path, "r+b");
+  TEST_ASSERT_NOT_NULL(file);
+  fseek(file, offset, SEEK_SET);
+  int byte = fgetc(file);
+  fseek(file, offset, SEEK_SET);
+  fputc(byte ^ 0x5A, file);
+  fclose(file);
+}
+
+// -- Deep sleep keeps the RTC state, a power loss does not.
+static void power_loss()
+{
+  memset(&frame_store_state, 0, sizeof(frame_store_state));
+  TEST_ASSERT_TRUE(frame_store_begin());
+}
+
+void setUp(void)
+{
+  for (uint32_t slot = 0; slot < FRAME_STORE_SLOTS; slot++)
+  {
+    char path[64];
+    slot_file(path, sizeof(path), slot);
+    remove(path);
+    rmdir(path);
+  }
+  power_loss();
+  memset(restored, 0, sizeof(restored));
+}
+
+void tearDown(void)
+{
+}
+
+void test_round_trip(void)
+{
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+  fill(frame, 3);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  TEST_ASSERT_TRUE(frame_store_load(restored, FRAME_BYTES));
+  TEST_ASSERT_EQUAL_MEMORY(frame, restored, FRAME_BYTES);
+
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  TEST_ASSERT_TRUE(frame_store_stats.save_skipped);
+  power_loss();
+  TEST_ASSERT_TRUE(frame_store_load(restored, FRAME_BYTES));
+  TEST_ASSERT_EQUAL_MEMORY(frame, restored, FRAME_BYTES);
+}
+
+// -- The panel shows the newest frame. When that one is corrupted an older one that still
+// -- verifies must not be restored, the wake has to refresh clean instead.
+void test_corrupted_newest_restores_nothing(void)
+{
+  fill(frame, 3);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  fill(frame, 7);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  corrupt_byte(frame_store_state.slot, 40);
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+  power_loss();
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+
+  // -- The next save is the newest again and restores.
+  fill(frame, 9);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  TEST_ASSERT_TRUE(frame_store_load(restored, FRAME_BYTES));
+  TEST_ASSERT_EQUAL_MEMORY(frame, restored, FRAME_BYTES);
+}
+
+// -- Power lost while writing: the newest file still has magic 0 and nothing is restored.
+void test_torn_newest_restores_nothing(void)
+{
+  fill(frame, 3);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  fill(frame, 7);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  char path[64];
+  slot_file(path, sizeof(path), frame_store_state.slot);
+  FILE *file = fopen(path, "r+b");
+  TEST_ASSERT_NOT_NULL(file);
+  uint32_t magic = 0;
+  fwrite(&magic, sizeof(magic), 1, file);
+  fclose(file);
+  power_loss();
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+}
+
+// -- A save that fails leaves the previous frame on flash, which no longer matches the panel.
+void test_failed_save_restores_nothing(void)
+{
+  fill(frame, 3);
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  char path[64];
+  slot_file(path, sizeof(path), (frame_store_state.slot + 1) % FRAME_STORE_SLOTS);
+  TEST_ASSERT_EQUAL_INT(0, mkdir(path, 0700));
+  fill(frame, 7);
+  TEST_ASSERT_FALSE(frame_store_save(frame, FRAME_BYTES));
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+  rmdir(path);
+
+  // -- The same frame is not taken as already stored.
+  TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  TEST_ASSERT_FALSE(frame_store_stats.save_skipped);
+  TEST_ASSERT_TRUE(frame_store_load(restored, FRAME_BYTES));
+  TEST_ASSERT_EQUAL_MEMORY(frame, restored, FRAME_BYTES);
+}
+
+// -- After a full rotation a slot holds an older frame that verifies on its own, it must not
+// -- pass for the newest.
+void test_reused_slot_needs_newest_sequence(void)
+{
+  for (int i = 0; i < FRAME_STORE_SLOTS + 1; i++)
+  {
+    fill(frame, 3 + 2 * i);
+    TEST_ASSERT_TRUE(frame_store_save(frame, FRAME_BYTES));
+  }
+  ++frame_store_state.sequence;
+  TEST_ASSERT_FALSE(frame_store_load(restored, FRAME_BYTES));
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  if (!mkdtemp(root))
+  {
+    return 1;
+  }
+  littlefs_shim_root() = root;
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_corrupted_newest_restores_nothing);
+  RUN_TEST(test_torn_newest_restores_nothing);
+  RUN_TEST(test_failed_save_restores_nothing);
+  RUN_TEST(test_reused_slot_needs_newest_sequence);
+  int failures = UNITY_END();
+  setUp();
+  rmdir(root);
+  return failures;
+}
@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+#include <zlib.h>
+
+#include "display_list.h"
+#include "glyph_blit.h"
+#include "opensans12b_lut.h"
+#include "opensans16b_lut.h"
+#include "opensans24b_lut.h"
+
+// -- The word wise kernel against the per pixel one, and text alignment against epdiy's own
+// -- measurement. Rows per second of both kernels are printed for comparison with bench.cpp.
+
+#define WIDTH 256
+#define ROWS 96
+#define GLYPH_MAX 64
+
+static const FontLookup *const fonts[] = {&OpenSans12BLookup, &OpenSans16BLookup, &OpenSans24BLookup};
+static uint32_t seed = 1;
+
+static uint32_t next_random()
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+static void fill_random(uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; i++)
+  {
+    data[i] = (uint8_t)next_random();
+  }
+}
+
+// -- The unused nibble at the end of odd width rows is empty in the fonts.
+static void clear_padding(uint8_t *bitmap, int width, int height)
+{
+  int byte_width = (width + 1) / 2;
+  for (int row = 0; width & 1 && row < height; row++)
+  {
+    bitmap[row * byte_width + byte_width - 1] &= 0x0F;
+  }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+// -- Random coverage, sizes and placements including odd x, both edges and partial bands.
+void test_dark_matches_generic(void)
+{
+  static uint8_t bitmap[GLYPH_MAX * GLYPH_MAX / 2];
+  static uint8_t expected[WIDTH / 2 * ROWS];
+  static uint8_t actual[WIDTH / 2 * ROWS];
+  for (int i = 0; i < 20000; i++)
+  {
+    int width = 1 + next_random() % GLYPH_MAX;
+    int height = 1 + next_random() % GLYPH_MAX;
+    int x = (int)(next_random() % (WIDTH + GLYPH_MAX)) - GLYPH_MAX / 2;
+    int y = (int)(next_random() % (ROWS + GLYPH_MAX)) - GLYPH_MAX;
+    int first_row = next_random() % 32;
+    int rows = 1 + next_random() % (ROWS - first_row);
+    fill_random(bitmap, (width + 1) / 2 * height);
+    clear_padding(bitmap, width, height);
+    memset(expected, 0xFF, sizeof(expected));
+    memset(actual, 0xFF, sizeof(actual));
+    glyph_blit_generic(expected, WIDTH, first_row, rows, x, y, bitmap, width, height);
+    glyph_blit_dark(actual, WIDTH, first_row, rows, x, y, bitmap, width, height);
+    if (memcmp(expected, actual, sizeof(actual)) != 0)
+    {
+      char message[128];
+      snprintf(message, sizeof(message), "%dx%d glyph at %d,%d, rows %d+%d", width, height, x, y, first_row, rows);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+// -- What glyph_blit_dark relies on, checked over every glyph of the fonts in use.
+void test_font_rows_are_padded(void)
+{
+  static uint8_t bitmap[GLYPH_MAX * GLYPH_MAX];
+  for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+  {
+    const EpdFont *font = fonts[f]->font;
+    for (uint32_t i = 0; i < font->interval_count; i++)
+    {
+      const EpdUnicodeInterval *interval = &font->intervals[i];
+      for (uint32_t cp = interval->first; cp <= interval->last; cp++)
+      {
+        const EpdGlyph *glyph = &font->glyph[interval->offset + (cp - interval->first)];
+        int byte_width = (glyph->width + 1) / 2;
+        if (!(glyph->width & 1) || glyph->height == 0)
+        {
+          continue;
+        }
+        uLongf length = sizeof(bitmap);
+        TEST_ASSERT_EQUAL_INT(Z_OK, uncompress(bitmap, &length, font->bitmap + glyph->data_offset, glyph->compressed_size));
+        for (int row = 0; row < glyph->height; row++)
+        {
+          TEST_ASSERT_EQUAL_HEX8(0, bitmap[row * byte_width + byte_width - 1] >> 4);
+        }
+      }
+    }
+  }
+}
+
+// -- Pen start epd_write_string ends up using: epd_get_text_bounds without background, then
+// -- x -= w / 2 for centered and x -= w for right aligned text.
+static int epdiy_aligned_x(const EpdFont *font, const char *text, int x, int flags)
+{
+  int minx = 100000;
+  int maxx = -1;
+  int pen = x;
+  uint32_t cp;
+  while ((cp = font_next_code_point(&text)) != 0)
+  {
+    const EpdGlyph *glyph = epd_get_glyph(font, cp);
+    if (!glyph)
+    {
+      continue;
+    }
+    int x1 = pen + glyph->left;
+    int x2 = x1 + glyph->width;
+    minx = x1 < minx ? x1 : minx;
+    maxx = x2 > maxx ? x2 : maxx;
+    pen += glyph->advance_x;
+  }
+  int x1 = x < minx ? x : minx;
+  int w = maxx - x1;
+  if (flags & EPD_DRAW_ALIGN_RIGHT)
+  {
+    return x - w;
+  }
+  if (flags & EPD_DRAW_ALIGN_CENTER)
+  {
+    return x - w / 2;
+  }
+  return x;
+}
+
+void test_alignment_matches_epdiy(void)
+{
+  static const char *const pieces[] = {"0", "1", "4", "7", "8", "-", ".", " ", "°C", "%", " hpa", " V", "A", "W", "j", "y",
+                                       "f", "Ä", "Ö", "å", "é", "ß", "/", ":", "(", ")", "_", "Q", "g", "~"};
+  static const int aligns[] = {EPD_DRAW_ALIGN_LEFT, EPD_DRAW_ALIGN_CENTER, EPD_DRAW_ALIGN_RIGHT};
+  static DisplayList list;
+  for (int i = 0; i < 5000; i++)
+  {
+    char text[DISPLAY_TEXT_LEN] = "";
+    int length = 1 + next_random() % 10;
+    for (int p = 0; p < length; p++)
+    {
+      strcat(text, pieces[next_random() % (sizeof(pieces) / sizeof(pieces[0]))]);
+    }
+    // -- Needs ink somewhere, epdiy's bounds of blank text are degenerate.
+    if (strspn(text, " ") == strlen(text))
+    {
+      continue;
+    }
+    const FontLookup *font = fonts[next_random() % 3];
+    int flags = aligns[next_random() % 3];
+    int x = 100 + next_random() % 700;
+    int y = 100 + next_random() % 300;
+    display_list_clear(&list);
+    TEST_ASSERT_TRUE(display_list_add_text(&list, font, text, x, y, flags, NULL));
+    int expected = epdiy_aligned_x(font->font, text, x, flags);
+    if (list.items[0].cursor_x != expected)
+    {
+      char message[160];
+      snprintf(message, sizeof(message), "\"%s\" flags %d at %d: %d, epdiy %d", text, flags, x, list.items[0].cursor_x, expected);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+static double rows_per_second(bool dark, int x, const uint8_t *bitmap, const EpdGlyph *glyph)
+{
+  static uint8_t buffer[WIDTH / 2 * ROWS];
+  const int n = 20000;
+  clock_t start = clock();
+  for (int i = 0; i < n; i++)
+  {
+    if (dark)
+    {
+      glyph_blit_dark(buffer, WIDTH, 0, ROWS, x, 10, bitmap, glyph->width, glyph->height);
+    }
+    else
+    {
+      glyph_blit_generic(buffer, WIDTH, 0, ROWS, x, 10, bitmap, glyph->width, glyph->height);
+    }
+  }
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  return seconds > 0 ? n * glyph->height / seconds : 0;
+}
+
+// -- Not asserted, host timings only show the ratio bench_glyph_blit measures on the device.
+void test_report_speed(void)
+{
+  const EpdGlyph *glyph = font_lookup_glyph(&OpenSans24BLookup, '8');
+  static uint8_t bitmap[GLYPH_MAX * GLYPH_MAX / 2];
+  uLongf length = sizeof(bitmap);
+  TEST_ASSERT_EQUAL_INT(Z_OK, uncompress(bitmap, &length, OpenSans24B.bitmap + glyph->data_offset, glyph->compressed_size));
+  char message[160];
+  snprintf(message, sizeof(message), "rows/s generic %.0fM, dark even x %.0fM, dark odd x %.0fM",
+           rows_per_second(false, 100, bitmap, glyph) / 1e6, rows_per_second(true, 100, bitmap, glyph) / 1e6,
+           rows_per_second(true, 101, bitmap, glyph) / 1e6);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_dark_matches_generic);
+  RUN_TEST(test_font_rows_are_padded);
+  RUN_TEST(test_alignment_matches_epdiy);
+  RUN_TEST(test_report_speed);
+  return UNITY_END();
+}
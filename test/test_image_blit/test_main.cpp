@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+#include <vector>
+
+#include "frame_store.h"
+#include "icon.h"
+#include "image_blit.h"
+
+// -- image_blit against a per pixel reference, the sequential icon encodings drawn band by
+// -- band against image_blit, and the timings of a 60x60 icon in every mode.
+
+#define BUFFER_MAX 301
+#define ROWS_MAX 80
+#define IMAGE_MAX 70
+
+static uint32_t seed = 7;
+
+static uint32_t next_random()
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+static uint8_t get_pixel(const uint8_t *data, int stride, int x, int y)
+{
+  uint8_t byte = data[y * stride + x / 2];
+  return (x & 1) ? byte >> 4 : byte & 0x0F;
+}
+
+static void set_pixel(uint8_t *data, int stride, int x, int y, uint8_t value)
+{
+  uint8_t *p = &data[y * stride + x / 2];
+  *p = (x & 1) ? (*p & 0x0F) | (value << 4) : (*p & 0xF0) | value;
+}
+
+static void reference_blit(uint8_t *buffer, int buffer_width, int first_row, int rows, int x, int y, const uint8_t *data,
+                           int width, int height, ImageBlitMode mode)
+{
+  int stride = (buffer_width + 1) / 2;
+  int image_stride = (width + 1) / 2;
+  for (int iy = 0; iy < height; iy++)
+  {
+    for (int ix = 0; ix < width; ix++)
+    {
+      int bx = x + ix;
+      int by = y + iy;
+      uint8_t value = get_pixel(data, image_stride, ix, iy);
+      if (bx < 0 || bx >= buffer_width || by < first_row || by >= first_row + rows ||
+          (mode == IMAGE_TRANSPARENT_WHITE && value == 0x0F))
+      {
+        continue;
+      }
+      set_pixel(buffer, stride, bx, by - first_row, value);
+    }
+  }
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+// -- Random images with plenty of white, placed anywhere including off every edge, into
+// -- buffers of odd and even widths holding any band of rows.
+void test_matches_reference(void)
+{
+  static uint8_t image[(IMAGE_MAX + 1) / 2 * IMAGE_MAX];
+  static uint8_t expected[(BUFFER_MAX + 1) / 2 * ROWS_MAX];
+  static uint8_t actual[(BUFFER_MAX + 1) / 2 * ROWS_MAX];
+  for (int i = 0; i < 30000; i++)
+  {
+    int width = 1 + next_random() % IMAGE_MAX;
+    int height = 1 + next_random() % IMAGE_MAX;
+    int buffer_width = 1 + next_random() % BUFFER_MAX;
+    int rows = 1 + next_random() % ROWS_MAX;
+    int first_row = next_random() % 100;
+    int x = (int)(next_random() % (buffer_width + 2 * width)) - width;
+    int y = first_row + (int)(next_random() % (rows + 2 * height)) - height;
+    ImageBlitMode mode = next_random() & 1 ? IMAGE_TRANSPARENT_WHITE : IMAGE_OPAQUE;
+    for (size_t b = 0; b < (width + 1) / 2 * (size_t)height; b++)
+    {
+      uint8_t lo = next_random() % 3 ? 0x0F : next_random() % 16;
+      uint8_t hi = next_random() % 3 ? 0x0F : next_random() % 16;
+      image[b] = lo | hi << 4;
+    }
+    size_t size = (buffer_width + 1) / 2 * rows;
+    for (size_t b = 0; b < size; b++)
+    {
+      expected[b] = (uint8_t)next_random();
+    }
+    memcpy(actual, expected, size);
+    reference_blit(expected, buffer_width, first_row, rows, x, y, image, width, height, mode);
+    image_blit(actual, buffer_width, first_row, rows, x, y, image, width, height, mode);
+    // -- The padding nibble of an odd width buffer row is not a pixel.
+    if (buffer_width & 1)
+    {
+      for (int row = 0; row < rows; row++)
+      {
+        expected[row * ((buffer_width + 1) / 2) + buffer_width / 2] &= 0x0F;
+        actual[row * ((buffer_width + 1) / 2) + buffer_width / 2] &= 0x0F;
+      }
+    }
+    if (memcmp(expected, actual, size) != 0)
+    {
+      char message[160];
+      snprintf(message, sizeof(message), "%dx%d image at %d,%d mode %d into %d wide rows %d+%d", width, height, x, y, mode,
+               buffer_width, first_row, rows);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+static void append(const uint8_t *data, size_t length, void *context)
+{
+  std::vector<uint8_t> *out = (std::vector<uint8_t> *)context;
+  out->insert(out->end(), data, data + length);
+}
+
+// -- 1bpp mask of the non-white pixels, then their gray levels two to a byte.
+static void mask_encode(const uint8_t *image, int width, int height, std::vector<uint8_t> *out)
+{
+  int mask_stride = (width + 7) / 8;
+  out->assign(mask_stride * height, 0);
+  std::vector<uint8_t> grays;
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      uint8_t value = get_pixel(image, (width + 1) / 2, x, y);
+      if (value != 0x0F)
+      {
+        (*out)[y * mask_stride + x / 8] |= 1 << (x % 8);
+        grays.push_back(value);
+      }
+    }
+  }
+  for (size_t i = 0; i < grays.size(); i += 2)
+  {
+    out->push_back(grays[i] | (i + 1 < grays.size() ? grays[i + 1] << 4 : 0));
+  }
+}
+
+// -- One reader per icon kept across bands of random heights, then an earlier band again, which
+// -- has to start over. Every band has to come out as image_blit draws the raw image.
+void test_icon_bands(void)
+{
+  static uint8_t image[(IMAGE_MAX + 1) / 2 * IMAGE_MAX];
+  static uint8_t expected[(BUFFER_MAX + 1) / 2 * ROWS_MAX];
+  static uint8_t band[(BUFFER_MAX + 1) / 2 * ROWS_MAX];
+  const int stride = (BUFFER_MAX + 1) / 2;
+  std::vector<uint8_t> encoded;
+  for (int i = 0; i < 3000; i++)
+  {
+    int width = 1 + next_random() % IMAGE_MAX;
+    int height = 1 + next_random() % IMAGE_MAX;
+    int x = (int)(next_random() % (BUFFER_MAX + 2 * width)) - width;
+    int y = (int)(next_random() % (ROWS_MAX + 2 * height)) - height;
+    ImageBlitMode mode = next_random() & 1 ? IMAGE_TRANSPARENT_WHITE : IMAGE_OPAQUE;
+    size_t image_size = (width + 1) / 2 * (size_t)height;
+    for (size_t b = 0; b < image_size; b++)
+    {
+      // -- Long white runs, so the RLE has repeat packets across row ends.
+      image[b] = next_random() % 4 ? 0xFF : (uint8_t)next_random();
+    }
+    // -- The padding nibble of odd width rows is white, as icon_convert.py writes it.
+    for (int row = 0; width & 1 && row < height; row++)
+    {
+      image[row * ((width + 1) / 2) + width / 2] |= 0xF0;
+    }
+
+    IconEncoding encoding = next_random() & 1 ? ICON_RLE : ICON_MASK;
+    encoded.clear();
+    if (encoding == ICON_RLE)
+    {
+      frame_rle_encode(image, image_size, append, &encoded);
+    }
+    else
+    {
+      mask_encode(image, width, height, &encoded);
+    }
+    Icon icon = {(uint16_t)width, (uint16_t)height, (uint8_t)encoding, {0, 0, 0, 0}, encoded.data(), (uint32_t)encoded.size()};
+
+    memset(expected, 0x77, sizeof(expected));
+    image_blit(expected, BUFFER_MAX, 0, ROWS_MAX, x, y, image, width, height, mode);
+
+    IconReader reader;
+    memset(&reader, 0, sizeof(reader));
+    int band_y = 0;
+    int again = next_random() % ROWS_MAX;
+    bool repeated = false;
+    while (band_y < ROWS_MAX)
+    {
+      int rows = 1 + next_random() % 24;
+      rows = rows < ROWS_MAX - band_y ? rows : ROWS_MAX - band_y;
+      memset(band, 0x77, stride * rows);
+      icon_blit_from(&reader, &icon, band, BUFFER_MAX, band_y, rows, x, y, mode);
+      if (memcmp(band, expected + band_y * stride, stride * rows) != 0)
+      {
+        char message[160];
+        snprintf(message, sizeof(message), "%s %dx%d icon at %d,%d mode %d, band %d+%d", encoding == ICON_RLE ? "RLE" : "mask",
+                 width, height, x, y, mode, band_y, rows);
+        TEST_FAIL_MESSAGE(message);
+      }
+      band_y += rows;
+      if (band_y > again && !repeated)
+      {
+        band_y = again;
+        repeated = true;
+      }
+    }
+  }
+}
+
+static double microseconds(bool reference, int x, ImageBlitMode mode, const uint8_t *icon)
+{
+  static uint8_t buffer[(BUFFER_MAX + 1) / 2 * ROWS_MAX];
+  const int n = 20000;
+  clock_t start = clock();
+  for (int i = 0; i < n; i++)
+  {
+    if (reference)
+    {
+      reference_blit(buffer, BUFFER_MAX, 0, ROWS_MAX, x, 10, icon, 60, 60, mode);
+    }
+    else
+    {
+      image_blit(buffer, BUFFER_MAX, 0, ROWS_MAX, x, 10, icon, 60, 60, mode);
+    }
+  }
+  return (double)(clock() - start) / CLOCKS_PER_SEC * 1e6 / n;
+}
+
+// -- Not asserted, host timings only show the ratios bench_blits measures on the device.
+void test_report_speed(void)
+{
+  static uint8_t icon[30 * 60];
+  for (size_t b = 0; b < sizeof(icon); b++)
+  {
+    icon[b] = next_random() % 2 ? 0xFF : (uint8_t)next_random();
+  }
+  char message[200];
+  snprintf(message, sizeof(message),
+           "60x60 us per pixel %.1f, even opaque %.1f, odd opaque %.1f, even transparent %.1f, odd transparent %.1f",
+           microseconds(true, 20, IMAGE_OPAQUE, icon), microseconds(false, 20, IMAGE_OPAQUE, icon),
+           microseconds(false, 21, IMAGE_OPAQUE, icon), microseconds(false, 20, IMAGE_TRANSPARENT_WHITE, icon),
+           microseconds(false, 21, IMAGE_TRANSPARENT_WHITE, icon));
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_reference);
+  RUN_TEST(test_icon_bands);
+  RUN_TEST(test_report_speed);
+  return UNITY_END();
+}
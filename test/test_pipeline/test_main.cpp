@@ -0,0 +1,124 @@
+#include <atomic>
+#include <stdint.h>
+#include <thread>
+#include <unity.h>
+
+#include "pipeline.h"
+
+#define ITEMS 2000000
+
+// -- Two fields that have to arrive together, a torn copy breaks the check.
+typedef struct
+{
+  uint32_t sequence;
+  uint32_t check;
+} Item;
+
+static SpscQueue<Item, 8> queue;
+static std::atomic<bool> consumed;
+static uint32_t received;
+static uint32_t errors;
+
+static void produce()
+{
+  for (uint32_t i = 0; i < ITEMS; i++)
+  {
+    Item item = {i, ~i};
+    while (!queue.push(item))
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+static void consume(void *parameter)
+{
+  (void)parameter;
+  uint32_t expected = 0;
+  while (expected < ITEMS)
+  {
+    Item item;
+    if (!queue.pop(item))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    if (item.sequence != expected || item.check != ~expected)
+    {
+      ++errors;
+    }
+    expected = item.sequence + 1;
+    ++received;
+  }
+  consumed.store(true);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_capacity(void)
+{
+  SpscQueue<int, 4> small;
+  int item = 0;
+  TEST_ASSERT_FALSE(small.pop(item));
+  TEST_ASSERT_TRUE(small.push(1));
+  TEST_ASSERT_TRUE(small.push(2));
+  TEST_ASSERT_TRUE(small.push(3));
+  TEST_ASSERT_FALSE(small.push(4));
+  TEST_ASSERT_TRUE(small.pop(item));
+  TEST_ASSERT_EQUAL_INT(1, item);
+  TEST_ASSERT_TRUE(small.push(4));
+  for (int expected = 2; expected <= 4; expected++)
+  {
+    TEST_ASSERT_TRUE(small.pop(item));
+    TEST_ASSERT_EQUAL_INT(expected, item);
+  }
+  TEST_ASSERT_FALSE(small.pop(item));
+}
+
+// -- A small queue wraps constantly, every item has to come out once, in order and whole.
+void test_threads_keep_order(void)
+{
+  received = 0;
+  errors = 0;
+  std::thread producer(produce);
+  std::thread consumer(consume, (void *)NULL);
+  producer.join();
+  consumer.join();
+  TEST_ASSERT_EQUAL_UINT32(ITEMS, received);
+  TEST_ASSERT_EQUAL_UINT32(0, errors);
+}
+
+// -- The consumer started the way the firmware starts its tasks.
+void test_pipeline_start(void)
+{
+  received = 0;
+  errors = 0;
+  consumed.store(false);
+  PipelineHandle handle = 0;
+  TEST_ASSERT_TRUE(pipeline_start(consume, "consumer", 4096, NULL, 0, &handle));
+  TEST_ASSERT_TRUE(handle != 0);
+  produce();
+  while (!consumed.load())
+  {
+    std::this_thread::yield();
+  }
+  TEST_ASSERT_EQUAL_UINT32(ITEMS, received);
+  TEST_ASSERT_EQUAL_UINT32(0, errors);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_capacity);
+  RUN_TEST(test_threads_keep_order);
+  RUN_TEST(test_pipeline_start);
+  return UNITY_END();
+}
@@ -0,0 +1,177 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "reading_stats.h"
+
+// -- The running statistics against a two pass reference, and what averaging buys over the first sample.
+
+static uint32_t seed = 11;
+
+static uint32_t next_random()
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// -- Roughly normal, the sum of twelve uniforms.
+static double next_gaussian()
+{
+  double sum = 0;
+  for (int i = 0; i < 12; i++)
+  {
+    sum += (next_random() & 0xFFFF) / 65536.0;
+  }
+  return sum - 6.0;
+}
+
+static RuuviReading reading(int32_t temperature, int32_t humidity, int32_t pressure, int32_t battery, uint32_t timestamp)
+{
+  RuuviReading r;
+  memset(&r, 0, sizeof(r));
+  r.temperature = temperature;
+  r.humidity = humidity;
+  r.pressure = pressure;
+  r.battery = battery;
+  r.timestamp = timestamp;
+  r.valid = true;
+  return r;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+// -- Pressure is the hard field, about 100000 Pa with a spread of a few Pa.
+void test_matches_two_pass(void)
+{
+  static int32_t values[64][READING_FIELD_COUNT];
+  const double centre[READING_FIELD_COUNT] = {2150, 4500, 101325, 2950};
+  double worst_mean = 0;
+  double worst_stddev = 0;
+  for (int run = 0; run < 2000; run++)
+  {
+    int count = 2 + next_random() % 63;
+    double spread = 1 + next_random() % 200;
+    ReadingStats stats;
+    reading_stats_reset(&stats);
+    for (int i = 0; i < count; i++)
+    {
+      for (int field = 0; field < READING_FIELD_COUNT; field++)
+      {
+        values[i][field] = (int32_t)lround(centre[field] + spread * next_gaussian());
+      }
+      RuuviReading r = reading(values[i][0], values[i][1], values[i][2], values[i][3], 1700000000 + i);
+      reading_stats_add(&stats, &r, i * 100);
+    }
+
+    RuuviReading mean;
+    reading_stats_mean(&stats, &mean);
+    int32_t means[READING_FIELD_COUNT] = {mean.temperature, mean.humidity, mean.pressure, mean.battery};
+    for (int field = 0; field < READING_FIELD_COUNT; field++)
+    {
+      double sum = 0;
+      for (int i = 0; i < count; i++)
+      {
+        sum += values[i][field];
+      }
+      double expected_mean = sum / count;
+      double squares = 0;
+      for (int i = 0; i < count; i++)
+      {
+        squares += (values[i][field] - expected_mean) * (values[i][field] - expected_mean);
+      }
+      double expected_stddev = sqrt(squares / (count - 1));
+
+      worst_mean = fmax(worst_mean, fabs(means[field] - expected_mean));
+      if (expected_stddev > 0)
+      {
+        double actual = reading_stats_stddev(&stats, (ReadingField)field);
+        worst_stddev = fmax(worst_stddev, fabs(actual - expected_stddev) / expected_stddev);
+      }
+    }
+  }
+  char message[120];
+  snprintf(message, sizeof(message), "worst mean error %.4f, worst relative stddev error %.2e", worst_mean, worst_stddev);
+  TEST_MESSAGE(message);
+  // -- The mean is rounded to the fixed point unit, so within half of it.
+  TEST_ASSERT_TRUE_MESSAGE(worst_mean <= 0.5, message);
+  TEST_ASSERT_TRUE_MESSAGE(worst_stddev <= 3e-6, message);
+}
+
+// -- A wake's worth of readings of a constant temperature with sensor noise: the average is
+// -- closer to the truth than the first sample the display used to show.
+void test_averaging_reduces_noise(void)
+{
+  const int samples = 10;
+  const double truth = 2150;
+  const double noise = 5;  // 0.05 °C
+  double first_squares = 0;
+  double mean_squares = 0;
+  const int runs = 2000;
+  for (int run = 0; run < runs; run++)
+  {
+    ReadingStats stats;
+    reading_stats_reset(&stats);
+    int32_t first = 0;
+    for (int i = 0; i < samples; i++)
+    {
+      int32_t temperature = (int32_t)lround(truth + noise * next_gaussian());
+      if (i == 0)
+      {
+        first = temperature;
+      }
+      RuuviReading r = reading(temperature, 4500, 101325, 2950, 1700000000 + i);
+      reading_stats_add(&stats, &r, i * 500);
+    }
+    RuuviReading mean;
+    reading_stats_mean(&stats, &mean);
+    first_squares += (first - truth) * (first - truth);
+    mean_squares += (mean.temperature - truth) * (mean.temperature - truth);
+  }
+  double first_rms = sqrt(first_squares / runs);
+  double mean_rms = sqrt(mean_squares / runs);
+  char message[120];
+  snprintf(message, sizeof(message), "%d samples: first sample rms error %.2f, averaged %.2f (0.01 C)", samples, first_rms,
+           mean_rms);
+  TEST_MESSAGE(message);
+  // -- Ideally sqrt(10) better, the rounding to 0.01 °C takes a little of it.
+  TEST_ASSERT_TRUE_MESSAGE(mean_rms * 2.5 < first_rms, message);
+}
+
+// -- Out of order delivery: the newest timestamp supplies the name and time, every sample counts.
+void test_newest_reading_wins(void)
+{
+  ReadingStats stats;
+  reading_stats_reset(&stats);
+  RuuviReading newer = reading(2000, 4000, 100000, 3000, 1700000010);
+  strcpy(newer.name, "newer");
+  RuuviReading older = reading(2200, 4200, 100002, 3002, 1700000005);
+  strcpy(older.name, "older");
+  reading_stats_add(&stats, &newer, 0);
+  reading_stats_add(&stats, &older, 100);
+  RuuviReading mean;
+  reading_stats_mean(&stats, &mean);
+  TEST_ASSERT_EQUAL_STRING("newer", mean.name);
+  TEST_ASSERT_EQUAL_UINT32(1700000010, mean.timestamp);
+  TEST_ASSERT_EQUAL_INT32(2100, mean.temperature);
+  TEST_ASSERT_EQUAL_INT32(100001, mean.pressure);
+  TEST_ASSERT_FALSE(reading_stats_window_closed(&stats, READING_STATS_WINDOW_MS - 1));
+  TEST_ASSERT_TRUE(reading_stats_window_closed(&stats, READING_STATS_WINDOW_MS));
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_two_pass);
+  RUN_TEST(test_averaging_reduces_noise);
+  RUN_TEST(test_newest_reading_wins);
+  return UNITY_END();
+}
@@ -0,0 +1,176 @@
+#include <string.h>
+#include <unity.h>
+
+#include "display_list.h"
+#include "fb_diff.h"
+#include "layout.h"
+#include "refresh_policy.h"
+
+#define FRAME_BYTES (EPD_WIDTH / 2 * EPD_HEIGHT)
+#define WARM 25
+
+static RefreshPolicyState state;
+
+void setUp(void)
+{
+  memset(&state, 0, sizeof(state));
+  refresh_policy_init(&state);
+}
+
+void tearDown(void)
+{
+}
+
+// -- Fast updates of one region until it gets cleaned, at a constant temperature.
+static int fast_updates_until_clean(int region, int temperature)
+{
+  int fast = 0;
+  while (refresh_policy_decide(&state, region, 1000, temperature) == REFRESH_FAST)
+  {
+    ++fast;
+    TEST_ASSERT_LESS_THAN(100, fast);
+  }
+  return fast;
+}
+
+// -- Warm, the score never passes its limit first, the update count does.
+void test_warm_cleans_after_max_fast(void)
+{
+  for (int cycle = 0; cycle < 3; cycle++)
+  {
+    TEST_ASSERT_EQUAL_INT(REFRESH_POLICY_MAX_FAST, fast_updates_until_clean(0, WARM));
+    TEST_ASSERT_EQUAL_UINT16(0, state.fast_updates[0]);
+    TEST_ASSERT_EQUAL_FLOAT(0, state.ghosting[0]);
+  }
+}
+
+// -- Every fast update scores 1 + 0.1 per degree below 20 °C, so the cold clean up sooner.
+void test_cold_cleans_at_ghosting_limit(void)
+{
+  TEST_ASSERT_EQUAL_INT(5, fast_updates_until_clean(0, 10));  // 2.0 per update
+  TEST_ASSERT_EQUAL_INT(3, fast_updates_until_clean(1, 0));   // 3.0 per update
+  TEST_ASSERT_EQUAL_INT(2, fast_updates_until_clean(2, -10)); // 4.0 per update
+  TEST_ASSERT_EQUAL_INT(REFRESH_POLICY_MAX_FAST, fast_updates_until_clean(3, REFRESH_POLICY_WARM_C));
+}
+
+// -- The score accumulates across temperatures: three cold updates, then warm ones.
+void test_ghosting_accumulates(void)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(REFRESH_FAST, refresh_policy_decide(&state, 0, 10, 0));
+  }
+  TEST_ASSERT_EQUAL_FLOAT(9.0f, state.ghosting[0]);
+  TEST_ASSERT_EQUAL_INT(REFRESH_FAST, refresh_policy_decide(&state, 0, 10, WARM));
+  TEST_ASSERT_EQUAL_FLOAT(REFRESH_POLICY_MAX_GHOSTING, state.ghosting[0]);
+  TEST_ASSERT_EQUAL_INT(REFRESH_CLEAN, refresh_policy_decide(&state, 0, 10, WARM));
+}
+
+void test_unchanged_regions_are_skipped(void)
+{
+  for (int i = 0; i < 50; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(REFRESH_SKIP, refresh_policy_decide(&state, 1, 0, 0));
+  }
+  TEST_ASSERT_EQUAL_UINT16(0, state.fast_updates[1]);
+  TEST_ASSERT_EQUAL_INT(REFRESH_SKIP, refresh_policy_decide(&state, -1, 100, WARM));
+  TEST_ASSERT_EQUAL_INT(REFRESH_SKIP, refresh_policy_decide(&state, REFRESH_REGION_COUNT, 100, WARM));
+}
+
+void test_cleaned_all_resets_every_region(void)
+{
+  for (int region = 0; region < REFRESH_REGION_COUNT; region++)
+  {
+    refresh_policy_decide(&state, region, 10, 0);
+  }
+  refresh_policy_cleaned_all(&state);
+  for (int region = 0; region < REFRESH_REGION_COUNT; region++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(0, state.fast_updates[region]);
+    TEST_ASSERT_EQUAL_FLOAT(0, state.ghosting[region]);
+  }
+}
+
+void test_average_refresh_time(void)
+{
+  TEST_ASSERT_EQUAL_FLOAT(0, refresh_policy_average_ms(&state));
+  refresh_policy_record(&state, 300);
+  refresh_policy_record(&state, 1500);
+  TEST_ASSERT_EQUAL_FLOAT(900, refresh_policy_average_ms(&state));
+}
+
+static RuuviReading reading(int32_t temperature)
+{
+  RuuviReading r;
+  memset(&r, 0, sizeof(r));
+  strcpy(r.name, "Tag");
+  r.temperature = temperature;
+  r.humidity = 4500;
+  r.pressure = 101300;
+  r.battery = 2950;
+  r.valid = true;
+  return r;
+}
+
+static void draw_frame(uint8_t *frame, int wake)
+{
+  static DisplayList list;
+  memset(frame, 0xFF, FRAME_BYTES);
+  display_list_clear(&list);
+  fb = frame;
+  layout_list = &list;
+  draw_static_layout();
+  // -- The first column changes every wake, the last one every third, the middle never.
+  RuuviReading tags[RUUVI_TAG_COUNT] = {reading(2000 + wake * 7), reading(2150), reading(1800 + wake / 3 * 10)};
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    draw_tag_column(tag, &tags[tag], 1700000000);
+  }
+  draw_bottom_battery("Battery: 80% 3.90 V", 20, 520);
+  fb = NULL;
+  layout_list = NULL;
+}
+
+// -- Rendered frames, diffed per region against the previous one as refreshRegions does.
+void test_frame_sequence(void)
+{
+  static uint8_t frames[2][FRAME_BYTES];
+  int actions[REFRESH_REGION_COUNT][3] = {{0}};
+  draw_frame(frames[0], 0);
+  for (int wake = 1; wake <= 27; wake++)
+  {
+    uint8_t *previous = frames[(wake - 1) % 2];
+    uint8_t *next = frames[wake % 2];
+    draw_frame(next, wake);
+    for (int region = 0; region < REFRESH_REGION_COUNT; region++)
+    {
+      const RefreshRegion *r = &refresh_regions[region];
+      FbDiff diff = fb_diff_area(previous, next, EPD_WIDTH, r->x, r->y, r->width, r->height, 0);
+      ++actions[region][refresh_policy_decide(&state, region, diff.pixels, WARM)];
+    }
+  }
+  // -- 27 changes: three cycles of eight fast updates and a clean one.
+  TEST_ASSERT_EQUAL_INT(24, actions[0][REFRESH_FAST]);
+  TEST_ASSERT_EQUAL_INT(3, actions[0][REFRESH_CLEAN]);
+  TEST_ASSERT_EQUAL_INT(27, actions[1][REFRESH_SKIP]);
+  // -- Changes at wakes 3, 6, ... 27: nine, the ninth is the first clean one.
+  TEST_ASSERT_EQUAL_INT(18, actions[2][REFRESH_SKIP]);
+  TEST_ASSERT_EQUAL_INT(8, actions[2][REFRESH_FAST]);
+  TEST_ASSERT_EQUAL_INT(1, actions[2][REFRESH_CLEAN]);
+  TEST_ASSERT_EQUAL_INT(27, actions[3][REFRESH_SKIP]);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_warm_cleans_after_max_fast);
+  RUN_TEST(test_cold_cleans_at_ghosting_limit);
+  RUN_TEST(test_ghosting_accumulates);
+  RUN_TEST(test_unchanged_regions_are_skipped);
+  RUN_TEST(test_cleaned_all_resets_every_region);
+  RUN_TEST(test_average_refresh_time);
+  RUN_TEST(test_frame_sequence);
+  return UNITY_END();
+}
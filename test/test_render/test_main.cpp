@@ -0,0 +1,286 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include "display_list.h"
+#include "fb_diff.h"
+#include "layout.h"
+#include "snapshot.h"
+
+// -- Golden frames are 8-bit PGMs next to this file, rewrite them with UPDATE_GOLDEN=1 after an intended change.
+#define FRAME_BYTES (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+static uint8_t frame[FRAME_BYTES];
+static uint8_t expected[FRAME_BYTES];
+static DisplayList list;
+
+static void golden_path(char *path, size_t size, const char *name, const char *suffix)
+{
+  const char *file = __FILE__;
+  const char *slash = strrchr(file, '/');
+  int dir = slash ? (int)(slash - file + 1) : 0;
+  snprintf(path, size, "%.*sgolden/%s%s", dir, file, name, suffix);
+}
+
+// -- 8-bit PGM as snapshot_write_pgm writes it, packed back to 4bpp.
+static bool read_pgm(const char *path, uint8_t *framebuffer)
+{
+  FILE *file = fopen(path, "rb");
+  if (!file)
+  {
+    return false;
+  }
+  int width = 0;
+  int height = 0;
+  int max = 0;
+  bool ok = fscanf(file, "P5 %d %d %d", &width, &height, &max) == 3 && fgetc(file) != EOF && width == EPD_WIDTH &&
+            height == EPD_HEIGHT && max == 255;
+  static uint8_t row[EPD_WIDTH];
+  for (int y = 0; ok && y < EPD_HEIGHT; y++)
+  {
+    ok = fread(row, 1, EPD_WIDTH, file) == EPD_WIDTH;
+    for (int x = 0; ok && x < EPD_WIDTH; x += 2)
+    {
+      framebuffer[y * EPD_WIDTH / 2 + x / 2] = (row[x] >> 4) | (row[x + 1] & 0xF0);
+    }
+  }
+  fclose(file);
+  return ok;
+}
+
+// -- tolerance is the gray level difference (0-15) a pixel may have before it counts, 0 for an exact match.
+static void assert_golden(const uint8_t *framebuffer, const char *name, int tolerance)
+{
+  char path[512];
+  golden_path(path, sizeof(path), name, ".pgm");
+  if (getenv("UPDATE_GOLDEN"))
+  {
+    TEST_ASSERT_TRUE_MESSAGE(snapshot_save(framebuffer, EPD_WIDTH, EPD_HEIGHT, path), path);
+    return;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(read_pgm(path, expected), path);
+  FbDiff diff = fb_diff(expected, framebuffer, EPD_WIDTH, EPD_HEIGHT, tolerance);
+  if (diff.pixels)
+  {
+    char actual[512];
+    char message[640];
+    golden_path(actual, sizeof(actual), name, ".actual.pgm");
+    snapshot_save(framebuffer, EPD_WIDTH, EPD_HEIGHT, actual);
+    snprintf(message, sizeof(message), "%s: %u px differ by more than %d in %dx%d at %d,%d, frame written to %s", name,
+             (unsigned)diff.pixels, tolerance, diff.width, diff.height, diff.x, diff.y, actual);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+static RuuviReading reading(const char *name, int32_t temperature, int32_t humidity, int32_t pressure, int32_t battery)
+{
+  RuuviReading r;
+  memset(&r, 0, sizeof(r));
+  strncpy(r.name, name, RUUVI_NAME_LEN - 1);
+  r.temperature = temperature;
+  r.humidity = humidity;
+  r.pressure = pressure;
+  r.battery = battery;
+  r.valid = true;
+  return r;
+}
+
+// -- 2023-11-14 22:13:20 UTC, the display converts to local time before drawing.
+static const long local_time = 1700000000;
+
+static void draw_standard()
+{
+  RuuviReading tags[RUUVI_TAG_COUNT] = {
+      reading("Living room", 2143, 4512, 101325, 2987),
+      reading("Sauna", 7815, 1203, 100980, 2911),
+      reading("Balcony", -1234, 8876, 99874, 2650),
+  };
+  draw_static_layout();
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    draw_tag_column(tag, &tags[tag], local_time);
+  }
+  draw_bottom_battery("Battery: 87% 3.95 V  ~412 days", 20, 520);
+}
+
+void setUp(void)
+{
+  memset(frame, 0xFF, sizeof(frame));
+  display_list_clear(&list);
+  fb = frame;
+  layout_list = &list;
+}
+
+void tearDown(void)
+{
+  fb = NULL;
+  layout_list = NULL;
+}
+
+void test_standard_layout(void)
+{
+  draw_standard();
+  assert_golden(frame, "standard", 0);
+}
+
+// -- Widest values the formatting allows, names with Latin-1 and an empty one. The two names
+// -- wider than their frame are cut to it and end in "...", nothing runs off the panel.
+void test_extreme_values(void)
+{
+  RuuviReading tags[RUUVI_TAG_COUNT] = {
+      reading("Kylmiö ÄÖÅ °", RUUVI_TEMPERATURE_MIN, 0, 0, 0),
+      reading("", RUUVI_TEMPERATURE_MAX, RUUVI_HUMIDITY_MAX, RUUVI_PRESSURE_MAX, RUUVI_BATTERY_MAX),
+      reading("A name that is far too long", 0, 5000, 50000, 1600),
+  };
+  draw_static_layout();
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    draw_tag_column(tag, &tags[tag], 0);
+  }
+  draw_bottom_battery("Battery: 0% 3.20 V", 20, 520);
+  assert_golden(frame, "extremes", 0);
+}
+
+// -- Only the middle tag reported, the other columns keep the static layer.
+void test_missing_tags(void)
+{
+  RuuviReading tag = reading("Kitchen", 2250, 3900, 101800, 3010);
+  draw_static_layout();
+  draw_tag_column(1, &tag, local_time);
+  draw_bottom_battery("Battery: 54% 3.78 V", 20, 520);
+  assert_golden(frame, "missing", 0);
+}
+
+void test_spread(void)
+{
+  ReadingStats stats;
+  reading_stats_reset(&stats);
+  int32_t temperatures[] = {2110, 2150, 2131, 2178, 2102};
+  for (size_t i = 0; i < sizeof(temperatures) / sizeof(temperatures[0]); i++)
+  {
+    RuuviReading r = reading("Office", temperatures[i], 4000, 101000, 3000);
+    r.timestamp = local_time;
+    reading_stats_add(&stats, &r, i * 1000);
+  }
+  RuuviReading mean;
+  reading_stats_mean(&stats, &mean);
+  draw_static_layout();
+  draw_tag_column(0, &mean, local_time);
+  draw_tag_spread(0, &stats);
+  assert_golden(frame, "spread", 0);
+}
+
+void test_timeout_message(void)
+{
+  draw_timeout_message();
+  assert_golden(frame, "timeout", 0);
+}
+
+// -- The background composed at build time has to match drawing the items one by one.
+void test_composed_background_matches_items(void)
+{
+  static uint8_t items[FRAME_BYTES];
+  draw_static_layout();
+  fb = items;
+  memset(items, 0xFF, sizeof(items));
+  draw_static_layout_items();
+  FbDiff diff = fb_diff(frame, items, EPD_WIDTH, EPD_HEIGHT, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+}
+
+// -- Band rendering from the display list alone gives the same panel as the framebuffer build.
+void test_band_rendering_matches_framebuffer(void)
+{
+  draw_standard();
+  memset(epd_shim_panel(), 0xFF, FRAME_BYTES);
+  TEST_ASSERT_EQUAL_INT(EPD_DRAW_SUCCESS, display_list_draw(&list));
+  FbDiff diff = fb_diff(frame, epd_shim_panel(), EPD_WIDTH, EPD_HEIGHT, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+}
+
+// -- Redrawing only the dirty rectangles of a changed column ends up at the new frame.
+void test_band_partial_update(void)
+{
+  draw_standard();
+  memset(epd_shim_panel(), 0xFF, FRAME_BYTES);
+  display_list_draw(&list);
+  DisplaySummary summary;
+  display_list_summarize(&list, &summary);
+
+  setUp();
+  RuuviReading tags[RUUVI_TAG_COUNT] = {
+      reading("Living room", 2143, 4512, 101325, 2987),
+      reading("Sauna", 8102, 1150, 100975, 2911),
+      reading("Balcony", -1234, 8876, 99874, 2650),
+  };
+  draw_static_layout();
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    draw_tag_column(tag, &tags[tag], local_time);
+  }
+  draw_bottom_battery("Battery: 87% 3.95 V  ~412 days", 20, 520);
+
+  DirtyRects dirty;
+  display_list_diff(&summary, &list, &dirty);
+  TEST_ASSERT_GREATER_THAN(0, dirty.count);
+  for (int i = 0; i < dirty.count; i++)
+  {
+    // -- As epd_clear_area leaves it.
+    EpdRect r = dirty.rects[i];
+    for (int y = r.y; y < r.y + r.height; y++)
+    {
+      memset(epd_shim_panel() + y * EPD_WIDTH / 2 + r.x / 2, 0xFF, (r.width + 1) / 2);
+    }
+    TEST_ASSERT_EQUAL_INT(EPD_DRAW_SUCCESS, display_list_draw_area(&list, r));
+  }
+  FbDiff diff = fb_diff(frame, epd_shim_panel(), EPD_WIDTH, EPD_HEIGHT, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+}
+
+// -- Items past the capacity are counted and the summary left invalid, so the next refresh is clean.
+void test_display_list_overflow(void)
+{
+  draw_standard();
+  TEST_ASSERT_EQUAL_INT(0, list.dropped);
+  DisplaySummary summary;
+  display_list_summarize(&list, &summary);
+  TEST_ASSERT_TRUE(display_summary_valid(&summary));
+
+  static const uint8_t pixels[2] = {0x00, 0x00};
+  const Icon dot = {2, 2, ICON_RAW, {0, 5, 10, 15}, pixels, sizeof(pixels)};
+  while (list.count < DISPLAY_LIST_MAX_ITEMS)
+  {
+    TEST_ASSERT_TRUE(display_list_add_image(&list, 0, 0, &dot, IMAGE_OPAQUE));
+  }
+  TEST_ASSERT_FALSE(display_list_add_image(&list, 0, 0, &dot, IMAGE_OPAQUE));
+  TEST_ASSERT_FALSE(display_list_add_image(&list, 2, 2, &dot, IMAGE_TRANSPARENT_WHITE));
+  TEST_ASSERT_EQUAL_INT(DISPLAY_LIST_MAX_ITEMS, list.count);
+  TEST_ASSERT_EQUAL_INT(2, list.dropped);
+  display_list_summarize(&list, &summary);
+  TEST_ASSERT_FALSE(display_summary_valid(&summary));
+
+  display_list_clear(&list);
+  TEST_ASSERT_EQUAL_INT(0, list.dropped);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  // -- Timestamps are formatted in local time, pin it.
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  UNITY_BEGIN();
+  RUN_TEST(test_standard_layout);
+  RUN_TEST(test_extreme_values);
+  RUN_TEST(test_missing_tags);
+  RUN_TEST(test_spread);
+  RUN_TEST(test_timeout_message);
+  RUN_TEST(test_composed_background_matches_items);
+  RUN_TEST(test_band_rendering_matches_framebuffer);
+  RUN_TEST(test_band_partial_update);
+  RUN_TEST(test_display_list_overflow);
+  return UNITY_END();
+}
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "ruuvi_raw.h"
+
+// -- Test vectors from the Ruuvi data format 5 (RAWv2) specification,
+// -- wrapped in the flags and manufacturer AD structures Ruuvi Gateway publishes.
+#define ADV_PREFIX "0201061BFF9904"
+#define VALID_DATA ADV_PREFIX "0512FC5394C37C0004FFFC040CAC364200CDCBB8334C884F"
+#define MAX_DATA ADV_PREFIX "057FFFFFFEFFFE7FFF7FFF7FFFFFDEFEFFFECBB8334C884F"
+#define MIN_DATA ADV_PREFIX "058001000000008001800180010000000000CBB8334C884F"
+#define INVALID_DATA ADV_PREFIX "058000FFFFFFFF800080008000FFFFFFFFFFFFFFFFFFFFFF"
+
+static RuuviReading reading;
+
+void setUp(void)
+{
+  memset(&reading, 0, sizeof(reading));
+}
+
+void tearDown(void)
+{
+}
+
+void test_valid_vector(void)
+{
+  static const uint8_t mac[6] = {0xCB, 0xB8, 0x33, 0x4C, 0x88, 0x4F};
+  TEST_ASSERT_TRUE(ruuvi_decode_hex(VALID_DATA, &reading));
+  TEST_ASSERT_EQUAL_INT32(2430, reading.temperature);
+  TEST_ASSERT_EQUAL_INT32(5349, reading.humidity);
+  TEST_ASSERT_EQUAL_INT32(100044, reading.pressure);
+  TEST_ASSERT_EQUAL_INT16(4, reading.acceleration[0]);
+  TEST_ASSERT_EQUAL_INT16(-4, reading.acceleration[1]);
+  TEST_ASSERT_EQUAL_INT16(1036, reading.acceleration[2]);
+  TEST_ASSERT_EQUAL_INT32(2977, reading.battery);
+  TEST_ASSERT_EQUAL_INT8(4, reading.tx_power);
+  TEST_ASSERT_EQUAL_UINT8(66, reading.movement);
+  TEST_ASSERT_EQUAL_UINT16(205, reading.sequence);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(mac, reading.mac, 6);
+  TEST_ASSERT_EQUAL_STRING("Ruuvi 884F", reading.name);
+}
+
+// -- 163.835 °C and 163.835 % round to the nearest 0.01.
+void test_maximum_values(void)
+{
+  TEST_ASSERT_TRUE(ruuvi_decode_hex(MAX_DATA, &reading));
+  TEST_ASSERT_EQUAL_INT32(16384, reading.temperature);
+  TEST_ASSERT_EQUAL_INT32(16384, reading.humidity);
+  TEST_ASSERT_EQUAL_INT32(RUUVI_PRESSURE_MAX, reading.pressure);
+  for (int i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_EQUAL_INT16(32767, reading.acceleration[i]);
+  }
+  TEST_ASSERT_EQUAL_INT32(3646, reading.battery);
+  TEST_ASSERT_EQUAL_INT8(20, reading.tx_power);
+  TEST_ASSERT_EQUAL_UINT8(254, reading.movement);
+  TEST_ASSERT_EQUAL_UINT16(65534, reading.sequence);
+}
+
+void test_minimum_values(void)
+{
+  TEST_ASSERT_TRUE(ruuvi_decode_hex(MIN_DATA, &reading));
+  TEST_ASSERT_EQUAL_INT32(-16384, reading.temperature);
+  TEST_ASSERT_EQUAL_INT32(0, reading.humidity);
+  TEST_ASSERT_EQUAL_INT32(50000, reading.pressure);
+  for (int i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_EQUAL_INT16(-32767, reading.acceleration[i]);
+  }
+  TEST_ASSERT_EQUAL_INT32(1600, reading.battery);
+  TEST_ASSERT_EQUAL_INT8(-40, reading.tx_power);
+  TEST_ASSERT_EQUAL_UINT8(0, reading.movement);
+  TEST_ASSERT_EQUAL_UINT16(0, reading.sequence);
+}
+
+// -- 0x8000 / 0xFFFF sentinels mark every field as not available.
+void test_invalid_vector(void)
+{
+  TEST_ASSERT_FALSE(ruuvi_decode_hex(INVALID_DATA, &reading));
+}
+
+void test_truncated(void)
+{
+  char hex[sizeof(VALID_DATA)];
+  strcpy(hex, VALID_DATA);
+  for (size_t length = strlen(hex) - 2; length > 0; length -= 2)
+  {
+    hex[length] = '\0';
+    TEST_ASSERT_FALSE_MESSAGE(ruuvi_decode_hex(hex, &reading), hex);
+  }
+  TEST_ASSERT_FALSE(ruuvi_decode_hex("", &reading));
+}
+
+void test_truncated_binary(void)
+{
+  uint8_t data[RUUVI_ADV_MAX_LEN];
+  const char *hex = VALID_DATA;
+  size_t length = strlen(hex) / 2;
+  for (size_t i = 0; i < length; i++)
+  {
+    unsigned value;
+    sscanf(hex + 2 * i, "%2x", &value);
+    data[i] = (uint8_t)value;
+  }
+  TEST_ASSERT_TRUE(ruuvi_decode_advertisement(data, length, &reading));
+  for (size_t i = 0; i < length; i++)
+  {
+    TEST_ASSERT_FALSE(ruuvi_decode_advertisement(data, i, &reading));
+  }
+}
+
+void test_other_manufacturer(void)
+{
+  TEST_ASSERT_FALSE(ruuvi_decode_hex("0201061BFF4C00" "0512FC5394C37C0004FFFC040CAC364200CDCBB8334C884F", &reading));
+}
+
+void test_other_format(void)
+{
+  TEST_ASSERT_FALSE(ruuvi_decode_hex(ADV_PREFIX "0312FC5394C37C0004FFFC040CAC364200CDCBB8334C884F", &reading));
+}
+
+void test_bad_hex(void)
+{
+  TEST_ASSERT_FALSE(ruuvi_decode_hex(VALID_DATA "0", &reading));
+  TEST_ASSERT_FALSE(ruuvi_decode_hex(ADV_PREFIX "05G2FC5394C37C0004FFFC040CAC364200CDCBB8334C884F", &reading));
+  TEST_ASSERT_FALSE(ruuvi_decode_hex(VALID_DATA "00", &reading)); // longer than an advertisement
+}
+
+void test_lower_case(void)
+{
+  TEST_ASSERT_TRUE(ruuvi_decode_hex("0201061bff99040512fc5394c37c0004fffc040cac364200cdcbb8334c884f", &reading));
+  TEST_ASSERT_EQUAL_INT32(2430, reading.temperature);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_valid_vector);
+  RUN_TEST(test_maximum_values);
+  RUN_TEST(test_minimum_values);
+  RUN_TEST(test_invalid_vector);
+  RUN_TEST(test_truncated);
+  RUN_TEST(test_truncated_binary);
+  RUN_TEST(test_other_manufacturer);
+  RUN_TEST(test_other_format);
+  RUN_TEST(test_bad_hex);
+  RUN_TEST(test_lower_case);
+  return UNITY_END();
+}
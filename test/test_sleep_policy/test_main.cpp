@@ -0,0 +1,185 @@
+#include <math.h>
+#include <string.h>
+#include <unity.h>
+
+#include "sleep_policy.h"
+
+// -- Replays wakes the way main.cpp drives the policy: sleep_policy_wake with the time slept,
+// -- an observation per tag that reported, then sleep_policy_interval for the next sleep.
+
+#define BASE_S (60 * 30)
+#define AWAKE_MS 20000
+#define START 1700000000u
+
+static SleepPolicyState state;
+static uint32_t now;
+
+// -- Temperature in 0.01 °C at time t for a trace that rises rate_per_h from 20 °C.
+static int32_t ramp(uint32_t t, float rate_per_h)
+{
+  return 2000 + (int32_t)lroundf((t - START) / 3600.0f * rate_per_h * 100);
+}
+
+static RuuviReading reading_at(uint32_t t, int32_t temperature, bool timestamped)
+{
+  RuuviReading r;
+  memset(&r, 0, sizeof(r));
+  r.temperature = temperature;
+  r.humidity = 4000;
+  r.pressure = 101000;
+  r.timestamp = timestamped ? t : 0;
+  r.valid = true;
+  return r;
+}
+
+/**
+ * One wake after slept_s (0 for a wake that is not a timer wake). Readings
+ * arrive a few seconds in, tags not in mask are missing. Returns the next
+ * interval, which the simulation then sleeps unaligned.
+ */
+static uint32_t wake(uint32_t slept_s, float rate_per_h, uint8_t mask, bool timestamped)
+{
+  now += slept_s;
+  sleep_policy_wake(&state, slept_s);
+  uint32_t measured = now + 5;
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    if (mask & (1 << tag))
+    {
+      RuuviReading r = reading_at(measured, ramp(measured, rate_per_h), timestamped);
+      sleep_policy_observe(&state, tag, &r);
+    }
+  }
+  now += AWAKE_MS / 1000;
+  return sleep_policy_interval(&state, BASE_S, 80, AWAKE_MS);
+}
+
+static uint32_t replay(int wakes, float rate_per_h, bool timestamped)
+{
+  uint32_t interval = wake(0, rate_per_h, 0x7, timestamped);
+  for (int i = 0; i < wakes; i++)
+  {
+    interval = wake(interval, rate_per_h, 0x7, timestamped);
+  }
+  return interval;
+}
+
+void setUp(void)
+{
+  memset(&state, 0, sizeof(state));
+  sleep_policy_init(&state, BASE_S);
+  now = START;
+}
+
+void tearDown(void)
+{
+}
+
+void test_first_wake_uses_base(void)
+{
+  TEST_ASSERT_EQUAL_UINT32(BASE_S, wake(0, 0, 0, true));
+}
+
+void test_steady_values_stretch_to_max(void)
+{
+  TEST_ASSERT_EQUAL_UINT32(SLEEP_POLICY_MAX_S, replay(10, 0, true));
+}
+
+// -- 2 °C per hour is four temperature steps per hour, a refresh every 15 minutes.
+void test_ramp_settles_on_rate(void)
+{
+  uint32_t interval = replay(20, 2.0f, true);
+  TEST_ASSERT_UINT32_WITHIN(30, 900, interval);
+}
+
+void test_fast_change_clamps_to_min(void)
+{
+  TEST_ASSERT_EQUAL_UINT32(SLEEP_POLICY_MIN_S, replay(10, 20.0f, true));
+}
+
+// -- The timestamps and the counted wall time have to give the same rate.
+void test_fallback_matches_timestamps(void)
+{
+  uint32_t with_timestamps = replay(20, 2.0f, true);
+  setUp();
+  uint32_t without = replay(20, 2.0f, false);
+  TEST_ASSERT_UINT32_WITHIN(30, with_timestamps, without);
+}
+
+// -- A timed out wake that missed every tag: the next change spans two sleeps and must not
+// -- count as if it happened in one.
+static void check_missed_wake(bool timestamped)
+{
+  uint32_t interval = replay(20, 2.0f, timestamped);
+  interval = wake(interval, 2.0f, 0, timestamped);
+  interval = wake(interval, 2.0f, 0x7, timestamped);
+  TEST_ASSERT_UINT32_WITHIN(60, 900, interval);
+}
+
+void test_missed_wake_with_timestamps(void)
+{
+  check_missed_wake(true);
+}
+
+void test_missed_wake_without_timestamps(void)
+{
+  check_missed_wake(false);
+}
+
+// -- After a reset the time away is unknown, the change across it must not count at all.
+void test_unknown_gap_is_ignored(void)
+{
+  uint32_t interval = replay(10, 0, false);
+  TEST_ASSERT_EQUAL_UINT32(SLEEP_POLICY_MAX_S, interval);
+  now += 5 * 3600;
+  sleep_policy_wake(&state, 0);
+  RuuviReading r = reading_at(now, 3000, false);
+  sleep_policy_observe(&state, 0, &r);
+  TEST_ASSERT_EQUAL_FLOAT(0, state.wake_activity);
+}
+
+void test_wake_returns_elapsed(void)
+{
+  wake(0, 0, 0x7, true);
+  TEST_ASSERT_EQUAL_UINT32(BASE_S + AWAKE_MS / 1000, sleep_policy_wake(&state, BASE_S));
+  TEST_ASSERT_EQUAL_UINT32(0, sleep_policy_wake(&state, 0));
+}
+
+// -- A day of a noisy trace never leaves the bounds, and low battery only lengthens sleeps.
+void test_bounds_and_low_battery(void)
+{
+  uint32_t interval = wake(0, 0, 0x7, true);
+  uint32_t seed = 1;
+  for (int i = 0; i < 200; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    float rate = (seed >> 16) % 800 / 100.0f;
+    interval = wake(interval, rate, 0x7, true);
+    TEST_ASSERT_TRUE(interval >= SLEEP_POLICY_MIN_S && interval <= SLEEP_POLICY_MAX_S);
+  }
+  SleepPolicyState saved = state;
+  uint32_t normal = sleep_policy_interval(&state, BASE_S, 80, AWAKE_MS);
+  state = saved;
+  uint32_t low = sleep_policy_interval(&state, BASE_S, SLEEP_POLICY_LOW_BATTERY / 2, AWAKE_MS);
+  state = saved;
+  TEST_ASSERT_TRUE(low >= normal);
+  TEST_ASSERT_EQUAL_UINT32(SLEEP_POLICY_MAX_S, sleep_policy_interval(&state, BASE_S, SLEEP_POLICY_CRITICAL_BATTERY, AWAKE_MS));
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_first_wake_uses_base);
+  RUN_TEST(test_steady_values_stretch_to_max);
+  RUN_TEST(test_ramp_settles_on_rate);
+  RUN_TEST(test_fast_change_clamps_to_min);
+  RUN_TEST(test_fallback_matches_timestamps);
+  RUN_TEST(test_missed_wake_with_timestamps);
+  RUN_TEST(test_missed_wake_without_timestamps);
+  RUN_TEST(test_unknown_gap_is_ignored);
+  RUN_TEST(test_wake_returns_elapsed);
+  RUN_TEST(test_bounds_and_low_battery);
+  return UNITY_END();
+}
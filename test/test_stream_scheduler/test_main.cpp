@@ -0,0 +1,423 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include "display_list.h"
+#include "fb_diff.h"
+#include "layout.h"
+#include "reading_stats.h"
+#include "refresh_policy.h"
+#include "stream_scheduler.h"
+
+// -- A day of always on traffic replayed a millisecond at a time, the way streamLoop polls,
+// -- with every refresh rendered and diffed the way streamLoop and refreshPanel do it.
+
+#define MINUTE_MS 60000u
+#define HOUR_MS (60 * MINUTE_MS)
+// -- Panel time of a refresh, the loop does not poll meanwhile.
+#define PARTIAL_BUSY_MS 400
+#define FULL_BUSY_MS 1500
+#define FRAME_BYTES (EPD_WIDTH / 2 * EPD_HEIGHT)
+
+// -- Allocations of the whole program are counted by interposing the C allocator. The sanitizers
+// -- bring their own allocator that must not be bypassed, so they are not counted there.
+#if defined(__SANITIZE_ADDRESS__)
+#define COUNT_ALLOCATIONS 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define COUNT_ALLOCATIONS 0
+#endif
+#endif
+#if !defined(COUNT_ALLOCATIONS) && defined(__GLIBC__)
+#define COUNT_ALLOCATIONS 1
+#endif
+
+#if COUNT_ALLOCATIONS
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *p, size_t size);
+static unsigned long allocations;
+
+extern "C" void *malloc(size_t size)
+{
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+  ++allocations;
+  return __libc_realloc(p, size);
+}
+#endif
+
+// -- What streamLoop keeps between refreshes, hl.front_fb and hl.back_fb among it.
+static uint8_t front[FRAME_BYTES];
+static uint8_t back[FRAME_BYTES];
+static DisplayList list;
+static DisplaySummary summary;
+static DirtyRects dirty;
+static ReadingStats stats[RUUVI_TAG_COUNT];
+static RuuviReading shown[RUUVI_TAG_COUNT];
+static RefreshPolicyState policy;
+static const char *const names[RUUVI_TAG_COUNT] = {"Living room", "Sauna", "Balcony"};
+static uint32_t regions_updated;
+static uint32_t seed = 5;
+
+static int32_t wander(int32_t value, int32_t step)
+{
+  seed = seed * 1103515245u + 12345u;
+  return value + (int32_t)((seed >> 8) % (2 * step + 1)) - step;
+}
+
+static void receive(int tag, uint32_t now_ms, uint32_t epoch)
+{
+  RuuviReading reading = shown[tag];
+  if (!reading.valid)
+  {
+    memset(&reading, 0, sizeof(reading));
+    strncpy(reading.name, names[tag], RUUVI_NAME_LEN - 1);
+    reading.temperature = 2150;
+    reading.humidity = 4500;
+    reading.pressure = 101325;
+    reading.battery = 2950;
+    reading.valid = true;
+  }
+  reading.temperature = wander(reading.temperature, 20);
+  reading.humidity = wander(reading.humidity, 30);
+  reading.pressure = wander(reading.pressure, 5);
+  reading.timestamp = epoch;
+  reading_stats_add(&stats[tag], &reading, now_ms);
+}
+
+// -- epd_hl_update_area leaves the back buffer equal to the front one in the area.
+static void update_area(int x, int y, int width, int height)
+{
+  for (int row = y; row < y + height; row++)
+  {
+    memcpy(back + row * EPD_WIDTH / 2 + x / 2, front + row * EPD_WIDTH / 2 + x / 2, width / 2);
+  }
+}
+
+// -- refreshRegions without the panel.
+static void refresh_dirty(const DirtyRects *rects)
+{
+  for (int i = 0; i < REFRESH_REGION_COUNT; i++)
+  {
+    const RefreshRegion *region = &refresh_regions[i];
+    EpdRect area = {region->x, region->y, region->width, region->height};
+    EpdRect changed = area;
+    int parts = 0;
+    for (int j = 0; j < rects->count; j++)
+    {
+      EpdRect part;
+      if (display_rect_intersect(rects->rects[j], area, &part))
+      {
+        changed = parts++ ? display_rect_union(changed, part) : part;
+      }
+    }
+    if (parts == 0)
+    {
+      continue;
+    }
+    FbDiff diff = fb_diff_area(front, back, EPD_WIDTH, changed.x, changed.y, changed.width, changed.height, 0);
+    if (refresh_policy_decide(&policy, i, diff.pixels, 20) != REFRESH_SKIP)
+    {
+      ++regions_updated;
+      update_area(area.x, area.y, area.width, area.height);
+    }
+  }
+}
+
+// -- The body of streamLoop after a poll said refresh.
+static void render(bool full, uint32_t epoch)
+{
+  display_list_clear(&list);
+  draw_static_layout();
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    if (stats[tag].count)
+    {
+      reading_stats_mean(&stats[tag], &shown[tag]);
+      shown[tag].valid = true;
+      draw_tag_column(tag, &shown[tag], epoch);
+      draw_tag_spread(tag, &stats[tag]);
+      reading_stats_reset(&stats[tag]);
+    }
+    else if (shown[tag].valid)
+    {
+      draw_tag_column(tag, &shown[tag], epoch);
+    }
+  }
+  char battery[48];
+  snprintf(battery, sizeof(battery), "Battery: %d%% %.2f V", 87, 3.95);
+  draw_bottom_battery(battery, 20, 520);
+
+  if (full)
+  {
+    memset(back, 0xFF, FRAME_BYTES);
+    update_area(0, 0, EPD_WIDTH, EPD_HEIGHT);
+    refresh_policy_cleaned_all(&policy);
+  }
+  else if (display_summary_valid(&summary))
+  {
+    display_list_diff(&summary, &list, &dirty);
+    refresh_dirty(&dirty);
+  }
+  display_list_summarize(&list, &summary);
+}
+
+typedef struct
+{
+  uint32_t period_ms;
+  uint32_t burst;      // every this many periods a burst arrives, 0 never
+  uint32_t next_ms;    // time since the start of the soak
+  uint32_t count;
+} Tag;
+
+typedef struct
+{
+  uint32_t refreshes;
+  uint32_t full_refreshes;
+  uint32_t most_per_minute;
+  uint32_t worst_latency_ms;
+  uint32_t longest_full_gap_ms;
+  unsigned long allocations;     // after the first refresh, which may set up the C library
+} Soak;
+
+static const StreamConfig defaults = {2000, 6, 60 * MINUTE_MS};
+
+void setUp(void)
+{
+  memset(front, 0xFF, sizeof(front));
+  memset(back, 0xFF, sizeof(back));
+  memset(&summary, 0, sizeof(summary));
+  memset(shown, 0, sizeof(shown));
+  for (int tag = 0; tag < RUUVI_TAG_COUNT; tag++)
+  {
+    reading_stats_reset(&stats[tag]);
+  }
+  refresh_policy_init(&policy);
+  regions_updated = 0;
+  fb = front;
+  layout_list = &list;
+}
+
+void tearDown(void)
+{
+  fb = NULL;
+  layout_list = NULL;
+}
+
+// -- start is the millis() value the soak begins at, so the wrap can fall inside it. render draws
+// -- and diffs every refresh as well.
+static Soak soak(const StreamConfig *config, uint32_t start, uint32_t duration_ms, bool render_frames)
+{
+  Tag tags[] = {{1000, 0, 0, 0}, {2500, 40, 300, 0}, {10000, 6, 7000, 0}};
+  const int tag_count = RUUVI_TAG_COUNT;
+  StreamScheduler scheduler;
+  stream_scheduler_init(&scheduler, config, start);
+
+  Soak result;
+  memset(&result, 0, sizeof(result));
+  // -- Starts of the latest refreshes, a ring as long as the cap allows in a minute.
+  uint32_t starts[STREAM_MAX_REFRESHES_PER_MINUTE];
+  uint32_t started = 0;
+  uint32_t last_full = 0;
+  uint32_t busy_until = 0;
+  uint32_t waiting[RUUVI_TAG_COUNT] = {0}; // arrivals not popped by the loop yet
+  unsigned long allocations_before = 0;
+  uint32_t oldest_unshown = 0;
+  bool unshown = false;
+
+  for (uint32_t t = 0; t < duration_ms; t++)
+  {
+    for (int i = 0; i < tag_count; i++)
+    {
+      Tag *tag = &tags[i];
+      if (t < tag->next_ms)
+      {
+        continue;
+      }
+      ++tag->count;
+      ++waiting[i];
+      if (!unshown)
+      {
+        unshown = true;
+        oldest_unshown = t;
+      }
+      // -- A burst is five readings 50 ms apart, as a tag flushing its buffer.
+      bool bursting = tag->burst && tag->count % (tag->burst * 5) < 5;
+      tag->next_ms += bursting ? 50 : tag->period_ms;
+    }
+    if (t < busy_until)
+    {
+      continue;
+    }
+
+    uint32_t now = start + t;
+    uint32_t epoch = 1700000000 + t / 1000;
+    for (int i = 0; i < tag_count; i++)
+    {
+      for (; waiting[i]; waiting[i]--)
+      {
+        if (render_frames)
+        {
+          receive(i, now, epoch);
+        }
+        stream_scheduler_mark(&scheduler, now);
+      }
+    }
+    StreamAction action = stream_scheduler_poll(&scheduler, now);
+    if (action == STREAM_IDLE)
+    {
+      continue;
+    }
+
+    if (started >= config->max_per_minute)
+    {
+      uint32_t in_minute = 1;
+      for (uint32_t i = 1; i <= config->max_per_minute && i <= started; i++)
+      {
+        if (t - starts[(started - i) % STREAM_MAX_REFRESHES_PER_MINUTE] < MINUTE_MS)
+        {
+          ++in_minute;
+        }
+      }
+      if (in_minute > result.most_per_minute)
+      {
+        result.most_per_minute = in_minute;
+      }
+    }
+    starts[started++ % STREAM_MAX_REFRESHES_PER_MINUTE] = t;
+    if (unshown && t - oldest_unshown > result.worst_latency_ms)
+    {
+      result.worst_latency_ms = t - oldest_unshown;
+    }
+    unshown = false;
+    if (action == STREAM_FULL)
+    {
+      if (t - last_full > result.longest_full_gap_ms)
+      {
+        result.longest_full_gap_ms = t - last_full;
+      }
+      last_full = t;
+      ++result.full_refreshes;
+    }
+    else
+    {
+      ++result.refreshes;
+    }
+    busy_until = t + (action == STREAM_FULL ? FULL_BUSY_MS : PARTIAL_BUSY_MS);
+    if (render_frames)
+    {
+      render(action == STREAM_FULL, epoch);
+    }
+#if COUNT_ALLOCATIONS
+    if (started == 1)
+    {
+      allocations_before = allocations;
+    }
+#endif
+  }
+#if COUNT_ALLOCATIONS
+  result.allocations = allocations - allocations_before;
+#else
+  (void)allocations_before;
+#endif
+  TEST_ASSERT_EQUAL_UINT32(result.refreshes, scheduler.refreshes);
+  TEST_ASSERT_EQUAL_UINT32(result.full_refreshes, scheduler.full_refreshes);
+  return result;
+}
+
+static void report(const char *name, const Soak *result)
+{
+  char message[200];
+  snprintf(message, sizeof(message),
+           "%s: %u partial, %u full, at most %u per minute, worst latency %u ms, longest full gap %u ms, %lu allocations",
+           name,
+           (unsigned)result->refreshes, (unsigned)result->full_refreshes, (unsigned)result->most_per_minute,
+           (unsigned)result->worst_latency_ms, (unsigned)result->longest_full_gap_ms, result->allocations);
+  TEST_MESSAGE(message);
+}
+
+// -- 24 h at the default settings, the millis() wrap an hour in.
+void test_day_at_defaults(void)
+{
+  Soak result = soak(&defaults, 0u - HOUR_MS, 24 * HOUR_MS, true);
+  report("24 h", &result);
+  TEST_ASSERT_EQUAL_UINT32(0, result.allocations);
+  TEST_ASSERT_EQUAL_INT(0, list.dropped);
+  // -- The partial refreshes went through the diff, and the back buffer ends up as the panel would.
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(result.refreshes, regions_updated);
+  TEST_ASSERT_EQUAL_UINT32(0, fb_diff(front, back, EPD_WIDTH, EPD_HEIGHT, 0).pixels);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(defaults.max_per_minute, result.most_per_minute);
+  // -- Waits at most the coalesce window plus the spacing, and whatever refresh was on the panel.
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(defaults.coalesce_ms + MINUTE_MS / defaults.max_per_minute + FULL_BUSY_MS,
+                                   result.worst_latency_ms);
+  // -- Each full refresh counts from when it ran, a held one pushes the next back, so the 24th falls just past the day.
+  TEST_ASSERT_EQUAL_UINT32(23, result.full_refreshes);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(defaults.full_refresh_ms + MINUTE_MS / defaults.max_per_minute + FULL_BUSY_MS,
+                                   result.longest_full_gap_ms);
+}
+
+// -- The cap holds at its extremes as well, with no timed full refreshes at all.
+void test_cap_extremes(void)
+{
+  StreamConfig slow = {0, 1, 0};
+  Soak result = soak(&slow, 12345, 2 * HOUR_MS, false);
+  TEST_ASSERT_EQUAL_UINT32(1, result.most_per_minute);
+  TEST_ASSERT_EQUAL_UINT32(0, result.full_refreshes);
+  TEST_ASSERT_EQUAL_UINT32(120, result.refreshes);
+
+  StreamConfig fast = {0, STREAM_MAX_REFRESHES_PER_MINUTE, 0};
+  result = soak(&fast, 0u - MINUTE_MS, 2 * HOUR_MS, false);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(STREAM_MAX_REFRESHES_PER_MINUTE, result.most_per_minute);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(MINUTE_MS / STREAM_MAX_REFRESHES_PER_MINUTE + PARTIAL_BUSY_MS, result.worst_latency_ms);
+}
+
+// -- Updates inside the window share one refresh, the counters say so.
+void test_coalesces_within_window(void)
+{
+  StreamScheduler scheduler;
+  stream_scheduler_init(&scheduler, &defaults, 0);
+  stream_scheduler_mark(&scheduler, 100);
+  stream_scheduler_mark(&scheduler, 900);
+  stream_scheduler_mark(&scheduler, 2000);
+  TEST_ASSERT_EQUAL_INT(STREAM_IDLE, stream_scheduler_poll(&scheduler, 2099));
+  TEST_ASSERT_EQUAL_INT(STREAM_PARTIAL, stream_scheduler_poll(&scheduler, 2100));
+  TEST_ASSERT_EQUAL_INT(STREAM_IDLE, stream_scheduler_poll(&scheduler, 5000));
+  TEST_ASSERT_EQUAL_UINT32(3, scheduler.updates);
+  TEST_ASSERT_EQUAL_UINT32(2, scheduler.coalesced);
+  TEST_ASSERT_EQUAL_UINT32(1, scheduler.refreshes);
+
+  // -- Due again before the spacing is up, held once and counted once.
+  stream_scheduler_mark(&scheduler, 5000);
+  TEST_ASSERT_EQUAL_INT(STREAM_IDLE, stream_scheduler_poll(&scheduler, 7000));
+  TEST_ASSERT_EQUAL_INT(STREAM_IDLE, stream_scheduler_poll(&scheduler, 12000));
+  TEST_ASSERT_EQUAL_INT(STREAM_PARTIAL, stream_scheduler_poll(&scheduler, 12100));
+  TEST_ASSERT_EQUAL_UINT32(1, scheduler.rate_limited);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  // -- Timestamps are formatted in local time. With TZ unset glibc duplicates the zone name on every
+  // -- localtime(), which newlib on the device does not, so pin it as test_render does.
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  UNITY_BEGIN();
+  RUN_TEST(test_day_at_defaults);
+  RUN_TEST(test_cap_extremes);
+  RUN_TEST(test_coalesces_within_window);
+  return UNITY_END();
+}
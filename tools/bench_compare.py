@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""
+Compare two captured benchmark runs of the "bench" or "bench_native"
+environment. Compare runs of the same environment only.
+
+    pio run -e bench -t upload && pio device monitor | tee bench_new.txt
+    pio run -e bench_native -t exec | tee bench_new.txt
+    python3 tools/bench_compare.py bench_base.txt bench_new.txt --threshold 10
+
+Lines that are not benchmark results (boot log etc.) are ignored. Exits
+with status 1 when any benchmark got slower than the threshold (percent).
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith('{"bench"'):
+                continue
+            try:
+                result = json.loads(line)
+            except ValueError:
+                continue
+            results[result["bench"]] = result["us_per_op"]
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+    print("%-24s %12s %12s %8s" % ("bench", "base us", "new us", "change"))
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline or name not in current:
+            print("%-24s %12s %12s %8s" % (name, baseline.get(name, "-"), current.get(name, "-"), "n/a"))
+            continue
+        change = 100.0 * (current[name] - baseline[name]) / baseline[name] if baseline[name] else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-24s %12.4f %12.4f %+7.1f%%%s" % (name, baseline[name], current[name], change, flag))
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
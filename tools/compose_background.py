@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+Compose the static layer of the display into lib/icons/background_img.h.
+
+The three tag frames, the twelve sensor icons and their unit labels never
+change. They are drawn here once, the way draw_static_layout_items()
+(src/layout.cpp) draws them: frames opaque, icons with white left out,
+labels as black text ANDed into the background. The finished 960x540 4bpp
+frame is run length coded with the frame store packets, so the firmware
+expands it into the framebuffer with a single frame_rle_decode().
+
+Keep FRAMES and LABELS in sync with draw_static_layout_items().
+
+Runs as a PlatformIO pre script (extra_scripts) and only rewrites the
+header when the hash of its inputs differs from the one recorded in it, so
+checkouts and touched files that leave the inputs alone do not rebuild. Run it by hand with:
+
+    python3 tools/compose_background.py [--force] [-o lib/icons/background_img.h]
+"""
+
+import argparse
+import hashlib
+import os
+import sys
+import zlib
+
+WIDTH = 960
+HEIGHT = 540
+FONT = "lib/OpenSans/opensans16b.h"
+OUTPUT = "lib/icons/background_img.h"
+HASH_PREFIX = "// Inputs sha256: "
+
+# -- (x, y, image header) of the frames, drawn opaque.
+FRAMES = [(x, 100, "lib/icons/r_rect_img.h") for x in range(10, 651, 320)]
+# -- (y, icon header, label, label baseline) per row, columns at x = 20, 340 and 660, labels at x + 195.
+LABELS = [
+    (105, "lib/icons/temp_img.h", " °C", 148),
+    (175, "lib/icons/hum_img.h", " %", 218),
+    (245, "lib/icons/pres_img.h", " hpa", 288),
+    (315, "lib/icons/batt_img.h", " V", 358),
+]
+LABEL_COLUMNS = range(20, 661, 320)
+
+
+def project_path(root, path):
+    return os.path.join(root, path)
+
+
+def glyph_bitmap(font, glyph):
+    width, height, _, _, _, compressed_size, offset = glyph
+    size = (width + 1) // 2 * height
+    if font["compressed"]:
+        return zlib.decompress(font["bitmap"][offset:offset + compressed_size])[:size]
+    return font["bitmap"][offset:offset + size]
+
+
+def get_pixel(frame, x, y):
+    byte = frame[y * WIDTH // 2 + x // 2]
+    return byte >> 4 if x & 1 else byte & 0x0F
+
+
+def set_pixel(frame, x, y, value):
+    i = y * WIDTH // 2 + x // 2
+    frame[i] = (frame[i] & 0x0F) | value << 4 if x & 1 else (frame[i] & 0xF0) | value
+
+
+def draw_image(frame, x, y, image, transparent):
+    width, height, pixels = image
+    for yy in range(height):
+        for xx in range(width):
+            value = pixels[yy * width + xx]
+            if transparent and value == 0x0F:
+                continue
+            if 0 <= x + xx < WIDTH and 0 <= y + yy < HEIGHT:
+                set_pixel(frame, x + xx, y + yy, value)
+
+
+def draw_text(frame, font, text, x, y):
+    # -- Left aligned, the pen starts at x. Coverage c turns a pixel p into p & ~c, as glyph_blit_dark does.
+    from font_lut import glyph_index
+
+    for char in text:
+        index = glyph_index(font, ord(char))
+        if index is None:
+            continue
+        glyph = font["glyphs"][index]
+        width, height, advance_x, left, top, _, _ = glyph
+        data = glyph_bitmap(font, glyph)
+        stride = (width + 1) // 2
+        for yy in range(height):
+            for xx in range(width):
+                byte = data[yy * stride + xx // 2]
+                coverage = byte >> 4 if xx & 1 else byte & 0x0F
+                px = x + left + xx
+                py = y - top + yy
+                if coverage and 0 <= px < WIDTH and 0 <= py < HEIGHT:
+                    set_pixel(frame, px, py, get_pixel(frame, px, py) & ~coverage & 0x0F)
+        x += advance_x
+
+
+def compose(root):
+    from font_lut import read_font
+    from icon_convert import read_header
+
+    frame = bytearray([0xFF]) * (WIDTH * HEIGHT // 2)
+    for x, y, path in FRAMES:
+        draw_image(frame, x, y, read_header(project_path(root, path)), False)
+    font = read_font(project_path(root, FONT))
+    for x in LABEL_COLUMNS:
+        for y, path, label, baseline in LABELS:
+            draw_image(frame, x, y, read_header(project_path(root, path)), True)
+            draw_text(frame, font, label, x + 195, baseline)
+    return frame
+
+
+def inputs(root):
+    paths = [FONT, "tools/compose_background.py", "tools/font_lut.py", "tools/icon_convert.py"]
+    paths += [path for _, _, path in FRAMES] + [path for _, path, _, _ in LABELS]
+    return [project_path(root, path) for path in paths]
+
+
+def inputs_hash(root):
+    digest = hashlib.sha256()
+    for path in inputs(root):
+        with open(path, "rb") as f:
+            data = f.read()
+        # -- Name and length too, so content moving between inputs changes the hash.
+        digest.update(("%s %d\n" % (os.path.relpath(path, root), len(data))).encode())
+        digest.update(data)
+    return digest.hexdigest()
+
+
+def recorded_hash(output):
+    try:
+        with open(output) as f:
+            for line in f:
+                if line.startswith(HASH_PREFIX):
+                    return line[len(HASH_PREFIX):].strip()
+    except OSError:
+        pass
+    return None
+
+
+def generate(root, output, force=False):
+    digest = inputs_hash(root)
+    if not force and recorded_hash(output) == digest:
+        return False
+
+    from icon_convert import rle_encode
+
+    frame = compose(root)
+    data = rle_encode(frame)
+    lines = ["    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + "," for i in range(0, len(data), 16)]
+    text = "\n".join([
+        "#pragma once",
+        "",
+        "// Generated by tools/compose_background.py, do not edit.",
+        HASH_PREFIX + digest,
+        "// Static layer of the display, %d bytes run length coded from %d." % (len(data), len(frame)),
+        "const uint32_t background_img_width = %d;" % WIDTH,
+        "const uint32_t background_img_height = %d;" % HEIGHT,
+        "const uint8_t background_img_data[%d] = {" % len(data),
+    ] + lines + ["};", ""])
+    with open(output, "w") as f:
+        f.write(text)
+    print("compose_background: %s, %d bytes" % (os.path.relpath(output, root), len(data)))
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", help="header to write, %s by default" % OUTPUT)
+    parser.add_argument("--force", action="store_true", help="write even when the header is up to date")
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    sys.path.insert(0, os.path.join(root, "tools"))
+    generate(root, args.output or project_path(root, OUTPUT), args.force)
+
+
+try:
+    Import("env")  # noqa: F821, defined when PlatformIO runs this as an extra script
+except NameError:
+    if __name__ == "__main__":
+        main()
+else:
+    sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "tools"))  # noqa: F821
+    generate(env["PROJECT_DIR"], project_path(env["PROJECT_DIR"], OUTPUT))  # noqa: F821
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Generate glyph lookup tables for fonts written by epdiy's fontconvert.py.
+
+epdiy finds a glyph by scanning the font's EpdUnicodeInterval array on every
+character. For each font this writes <font>_lut.h next to it with:
+
+    <Name>Latin1[256]  glyph index of every code point below 0x100,
+                       FONT_LOOKUP_NONE where the font has no glyph
+    <Name>Extra[]      code points from 0x100 up with their glyph index,
+                       sorted for a binary search
+    <Name>Lookup       the FontLookup (src/font_lookup.h) the text
+                       rendering takes instead of the EpdFont
+    <Name>Metrics[256] constexpr glyph metrics of Latin-1, for measuring
+                       constant strings at compile time with
+                       font_measure_constant()
+
+    python3 tools/font_lut.py lib/OpenSans/opensans12b.h lib/OpenSans/opensans16b.h
+"""
+
+import argparse
+import os
+import re
+
+LOOKUP_NONE = 0xFFFF
+
+
+def read_font(path):
+    """
+    Name, bitmap, glyphs (width, height, advance_x, left, top,
+    compressed_size, data_offset), intervals (first, last, offset) and the
+    compressed flag of a font header.
+    """
+    with open(path) as f:
+        text = f.read()
+    bitmap_text, rest = text.split("Glyphs[]", 1)
+    bitmap = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", bitmap_text.split("{", 1)[1]))
+    glyph_text, rest = rest.split("Intervals[]", 1)
+    glyphs = [tuple(int(v) for v in g.split(",")) for g in re.findall(r"\{\s*(-?\d+(?:\s*,\s*-?\d+){6})\s*\}", glyph_text)]
+    interval_text, font_text = rest.split("EpdFont", 1)
+    intervals = [tuple(int(v, 16) for v in i)
+                 for i in re.findall(r"\{\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+)\s*\}", interval_text)]
+    name = re.match(r"\s*(\w+)\s*=", font_text).group(1)
+    fields = re.findall(r"(-?\d+)\s*,", font_text.split("{", 1)[1])
+    return {
+        "name": name,
+        "bitmap": bitmap,
+        "glyphs": glyphs,
+        "intervals": intervals,
+        "compressed": int(fields[1]),
+    }
+
+
+def glyph_index(font, code_point):
+    for first, last, offset in font["intervals"]:
+        if first <= code_point <= last:
+            return offset + code_point - first
+    return None
+
+
+def table_lines(values, per_line):
+    return ["    " + ", ".join(values[i:i + per_line]) + "," for i in range(0, len(values), per_line)]
+
+
+def write_lut(path, output):
+    font = read_font(path)
+    name = font["name"]
+    latin1 = []
+    for code_point in range(256):
+        index = glyph_index(font, code_point)
+        latin1.append("0x%04X" % (LOOKUP_NONE if index is None else index))
+    extra = sorted((code_point, offset + code_point - first)
+                   for first, last, offset in font["intervals"]
+                   for code_point in range(max(first, 0x100), last + 1))
+
+    lines = [
+        "#pragma once",
+        '#include "font_lookup.h"',
+        '#include "%s"' % os.path.basename(path),
+        "",
+        "// Generated by tools/font_lut.py from %s, do not edit." % os.path.basename(path),
+        "const uint16_t %sLatin1[256] = {" % name,
+    ] + table_lines(latin1, 16) + ["};"]
+    if extra:
+        lines += ["const FontLookupEntry %sExtra[%d] = {" % (name, len(extra))]
+        lines += table_lines(["{0x%X, %d}" % entry for entry in extra], 8) + ["};"]
+        extra_name = "%sExtra" % name
+    else:
+        extra_name = "NULL"
+    lines += ["const FontLookup %sLookup = {&%s, %sLatin1, %s, %d};" % (name, name, name, extra_name, len(extra))]
+
+    metrics = []
+    for code_point in range(256):
+        index = glyph_index(font, code_point)
+        if index is None:
+            metrics.append("{0, 0, 0, 0, 0, false}")
+        else:
+            width, height, advance_x, left, top, _, _ = font["glyphs"][index]
+            metrics.append("{%d, %d, %d, %d, %d, true}" % (advance_x, left, width, top, height))
+    lines += ["// advance_x, left, width, top, height, present", "constexpr GlyphMetrics %sMetrics[256] = {" % name]
+    lines += table_lines(metrics, 4) + ["};", ""]
+    with open(output, "w") as f:
+        f.write("\n".join(lines))
+    print("%s: %d glyphs, %d beyond Latin-1" % (os.path.basename(output), len(font["glyphs"]), len(extra)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("fonts", nargs="+", help="font headers")
+    args = parser.parse_args()
+    for path in args.fonts:
+        write_lut(path, re.sub(r"\.h$", "_lut.h", path))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Convert an icon into a header the firmware draws with icon_blit() (src/icon.h).
+
+The source is a 24-bit .bmp or an existing 4bpp image header as written by
+epdiy's imgconvert.py (lib/icons/*_img.h). Every encoding is tried:
+
+    raw   4bpp rows, copied with memcpy
+    rle   run length coded 4bpp bytes (same packets as the frame store)
+    mask  1bpp mask of the non-white pixels plus their 4bpp gray levels
+    pal2  2bpp indices into a 4 level palette, lossy unless the icon has
+          at most 4 gray levels, only picked with --lossy
+
+The encodings are ordered from fastest to slowest to decode. The next one is
+only chosen when it is at least --saving percent smaller than the current
+pick. --encoding forces one.
+
+    python3 tools/icon_convert.py lib/icons/temp_img.h --name temp_icon -o lib/icons/temp_icon.h
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+ENCODINGS = ["raw", "rle", "mask", "pal2"]
+
+
+def read_bmp(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        raise ValueError("not a BMP file")
+    offset = struct.unpack_from("<I", data, 10)[0]
+    width, height = struct.unpack_from("<ii", data, 18)
+    bits = struct.unpack_from("<H", data, 28)[0]
+    if bits != 24:
+        raise ValueError("only 24-bit BMP files are supported")
+    stride = (width * 3 + 3) & ~3
+    pixels = []
+    rows = range(abs(height)) if height < 0 else range(height - 1, -1, -1)
+    for y in rows:
+        row = offset + y * stride
+        for x in range(width):
+            b, g, r = data[row + x * 3:row + x * 3 + 3]
+            pixels.append((299 * r + 587 * g + 114 * b) // 1000 >> 4)
+    return width, abs(height), pixels
+
+
+def read_header(path):
+    with open(path) as f:
+        text = f.read()
+    width = int(re.search(r"_width\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"_height\s*=\s*(\d+)", text).group(1))
+    data = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", text.split("{", 1)[1])]
+    stride = (width + 1) // 2
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            byte = data[y * stride + x // 2]
+            pixels.append(byte >> 4 if x & 1 else byte & 0x0F)
+    return width, height, pixels
+
+
+def pack4(values):
+    out = bytearray()
+    for i in range(0, len(values), 2):
+        low = values[i]
+        high = values[i + 1] if i + 1 < len(values) else 0
+        out.append(low | high << 4)
+    return out
+
+
+def encode_raw(width, height, pixels):
+    out = bytearray()
+    for y in range(height):
+        out += pack4(pixels[y * width:(y + 1) * width])
+    return out
+
+
+def rle_encode(raw):
+    out = bytearray()
+    i = 0
+    while i < len(raw):
+        run = 1
+        while i + run < len(raw) and run < 129 and raw[i + run] == raw[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([0x80 + run - 2, raw[i]])
+            i += run
+            continue
+        start = i
+        while i < len(raw) and i - start < 128 and (i + 1 >= len(raw) or raw[i + 1] != raw[i]):
+            i += 1
+        out.append(i - start - 1)
+        out += raw[start:i]
+    return out
+
+
+def encode_rle(width, height, pixels):
+    return rle_encode(encode_raw(width, height, pixels))
+
+
+def encode_mask(width, height, pixels):
+    mask = bytearray()
+    grays = []
+    stride = (width + 7) // 8
+    for y in range(height):
+        row = bytearray(stride)
+        for x in range(width):
+            value = pixels[y * width + x]
+            if value != 0x0F:
+                row[x // 8] |= 1 << (x % 8)
+                grays.append(value)
+        mask += row
+    return mask + pack4(grays)
+
+
+def palette_for(pixels):
+    levels = sorted(set(pixels))
+    if len(levels) <= 4:
+        return (levels + [0x0F] * 4)[:4]
+    return [0, 5, 10, 15]
+
+
+def encode_pal2(width, height, pixels):
+    palette = palette_for(pixels)
+    out = bytearray()
+    error = 0
+    for y in range(height):
+        row = bytearray((width + 3) // 4)
+        for x in range(width):
+            value = pixels[y * width + x]
+            index = min(range(4), key=lambda i: abs(palette[i] - value))
+            error = max(error, abs(palette[index] - value))
+            row[x // 4] |= index << (x % 4 * 2)
+        out += row
+    return out, palette, error
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help=".bmp or 4bpp image header")
+    parser.add_argument("--name", required=True, help="C name of the Icon")
+    parser.add_argument("-o", "--output", help="header to write, stdout when omitted")
+    parser.add_argument("--encoding", choices=ENCODINGS, help="force an encoding")
+    parser.add_argument("--saving", type=float, default=25.0, help="percent smaller a slower encoding has to be")
+    parser.add_argument("--lossy", action="store_true", help="allow pal2 to quantize to 4 gray levels")
+    args = parser.parse_args()
+
+    if args.source.lower().endswith(".bmp"):
+        width, height, pixels = read_bmp(args.source)
+    else:
+        width, height, pixels = read_header(args.source)
+
+    pal2, palette, pal2_error = encode_pal2(width, height, pixels)
+    candidates = {
+        "raw": encode_raw(width, height, pixels),
+        "rle": encode_rle(width, height, pixels),
+        "mask": encode_mask(width, height, pixels),
+        "pal2": pal2,
+    }
+    allowed = [e for e in ENCODINGS if e != "pal2" or args.lossy or pal2_error == 0]
+    if args.encoding:
+        choice = args.encoding
+    else:
+        choice = "raw"
+        for encoding in allowed[1:]:
+            if len(candidates[encoding]) <= len(candidates[choice]) * (1 - args.saving / 100.0):
+                choice = encoding
+
+    sizes = ", ".join("%s %d" % (e, len(candidates[e])) for e in ENCODINGS)
+    print("%s: %dx%d, %s bytes (pal2 max error %d), using %s" % (args.name, width, height, sizes, pal2_error, choice),
+          file=sys.stderr)
+
+    data = candidates[choice]
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    header = [
+        "#pragma once",
+        '#include "icon.h"',
+        "",
+        "// Generated by tools/icon_convert.py from %s" % args.source.split("/")[-1],
+        "// %s bytes" % sizes,
+        "const uint8_t %s_data[%d] = {" % (args.name, len(data)),
+    ] + lines + [
+        "};",
+        "const Icon %s = {%d, %d, ICON_%s, {%s}, %s_data, %d};" % (
+            args.name, width, height, choice.upper(), ", ".join(str(p) for p in palette), args.name, len(data)),
+        "",
+    ]
+    text = "\n".join(header)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
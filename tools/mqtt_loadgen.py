@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""
+Publish synthetic or recorded Ruuvi readings to a local broker to stress the
+display's ingestion.
+
+Every tag topic gets --rate messages per second, with --burst extra messages
+every --burst-every seconds on top. --mix picks the payload variant of each
+message by weight:
+
+    json       the Ruuvi Station style JSON the display decodes field by field
+    hex        a Ruuvi Gateway style {"data": "<advertisement hex>", "ts": "<epoch>"}
+    msgpack    the JSON reading as MessagePack
+    oversized  a JSON reading padded past the MQTT client buffer (768 bytes)
+    malformed  truncated JSON that must count as a parse error
+
+--reorder sends that share of readings with a timestamp from the past,
+--retain publishes everything retained, so the display gets the last reading
+of each tag when it next connects and subscribes (the next wake, or the
+next reconnect in always on mode). --replay sends a recorded file instead,
+one "<topic> <payload>" per line.
+
+--fanout and --storm only load the broker. The display subscribes to the
+exact tag topics (connectMqtt in src/main.cpp), so it never receives the
+<tag>/fanoutN traffic or the retained ruuvitag/storm/N readings; they show
+what a busy broker costs the display, not how it handles the messages.
+
+    pip install paho-mqtt msgpack
+    python3 tools/mqtt_loadgen.py --host localhost --topic ruuvitag/F9:81:78:B2:70:BE \\
+        --rate 1 --burst 20 --burst-every 30 --mix json=8,hex=2,malformed=1 \\
+        --duration 120 --metrics http://display.local/metrics
+
+With --metrics the display's /metrics counters are read before and after the
+run, so the report shows the messages it saw, parse errors, queue drops and
+when the wake reached the data and refresh phases next to what was sent.
+"""
+
+import argparse
+import json
+import random
+import re
+import struct
+import time
+import urllib.request
+
+import paho.mqtt.client as mqtt
+
+VARIANTS = ["json", "hex", "msgpack", "oversized", "malformed"]
+# -- Above MQTTClient mqttClient(768) in src/main.cpp.
+OVERSIZED_BYTES = 1024
+METRICS = ["display_messages_total", "display_parse_errors_total", "display_queue_drops_total",
+           "display_refreshes_total", "display_stream_updates_total"]
+
+
+def parse_mix(text):
+    mix = {}
+    for part in text.split(","):
+        name, _, weight = part.partition("=")
+        if name not in VARIANTS:
+            raise argparse.ArgumentTypeError("unknown variant %s, one of %s" % (name, ", ".join(VARIANTS)))
+        mix[name] = float(weight or 1)
+    return mix
+
+
+def synthetic_reading(tag, sequence, timestamp):
+    # -- A slow drift with some noise per tag, within what the display clamps to.
+    phase = sequence / 50.0 + tag
+    return {
+        "name": "Load %d" % tag,
+        "temperature": round(21.0 + 3.0 * ((phase % 4) - 2) + random.gauss(0, 0.05), 2),
+        "humidity": round(45.0 + 10.0 * ((phase % 3) - 1.5) + random.gauss(0, 0.2), 2),
+        "pressure": 101325 + random.randint(-300, 300),
+        "batteryVoltage": 2.9 + random.randint(0, 20) / 100.0,
+        "accelerationX": 0.01, "accelerationY": -0.02, "accelerationZ": 1.0,
+        "txPower": 4,
+        "movementCounter": sequence % 256,
+        "measurementSequenceNumber": sequence % 65536,
+        "timestamp": timestamp,
+    }
+
+
+def rawv2_hex(reading, tag):
+    # -- Flags and manufacturer data as a Ruuvi Gateway forwards them, see src/ruuvi_raw.cpp.
+    power = (int(round(reading["batteryVoltage"] * 1000)) - 1600) << 5 | (reading["txPower"] + 40) // 2
+    payload = struct.pack(">BhHHhhhHBH6s", 5,
+                          int(round(reading["temperature"] / 0.005)),
+                          int(round(reading["humidity"] / 0.0025)),
+                          reading["pressure"] - 50000,
+                          int(reading["accelerationX"] * 1000), int(reading["accelerationY"] * 1000),
+                          int(reading["accelerationZ"] * 1000),
+                          power, reading["movementCounter"], reading["measurementSequenceNumber"],
+                          bytes([0xC0, 0xFF, 0xEE, 0x00, 0x00, tag & 0xFF]))
+    manufacturer = b"\xff\x99\x04" + payload
+    return (b"\x02\x01\x06" + bytes([len(manufacturer)]) + manufacturer).hex().upper()
+
+
+def encode(variant, reading, tag):
+    if variant == "hex":
+        return json.dumps({"data": rawv2_hex(reading, tag), "ts": str(reading["timestamp"])}).encode()
+    if variant == "msgpack":
+        # -- Only needed for this variant, runs without it don't need it installed.
+        import msgpack
+        return msgpack.packb(reading, use_single_float=True)
+    text = json.dumps(reading).encode()
+    if variant == "oversized":
+        reading = dict(reading, padding="x" * OVERSIZED_BYTES)
+        return json.dumps(reading).encode()
+    if variant == "malformed":
+        return text[:random.randint(1, len(text) - 1)]
+    return text
+
+
+def read_metrics(url):
+    values = {}
+    with urllib.request.urlopen(url, timeout=5) as response:
+        for line in response.read().decode().splitlines():
+            match = re.match(r"(\w+)(\{[^}]*\})?\s+([-\d.]+)$", line)
+            if match:
+                values[match.group(1) + (match.group(2) or "")] = float(match.group(3))
+    return values
+
+
+def schedule(args, topics):
+    """(offset in seconds, topic index) of every message of the run, in order."""
+    events = []
+    if args.rate > 0:
+        for index in range(len(topics)):
+            step = 1.0 / args.rate
+            start = random.uniform(0, step)
+            events += [(start + i * step, index) for i in range(int((args.duration - start) / step) + 1)]
+    if args.burst and args.burst_every > 0:
+        at = args.burst_every
+        while at < args.duration:
+            for index in range(len(topics)):
+                events += [(at + i * 0.001, index) for i in range(args.burst)]
+            at += args.burst_every
+    return sorted(events)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--username")
+    parser.add_argument("--password")
+    parser.add_argument("--topic", action="append", help="tag topic the display subscribes to, repeatable")
+    parser.add_argument("--fanout", type=int, default=0, help="broker only: extra topics per tag, not subscribed by the display")
+    parser.add_argument("--rate", type=float, default=1.0, help="messages per second per topic")
+    parser.add_argument("--burst", type=int, default=0, help="extra messages per topic in each burst")
+    parser.add_argument("--burst-every", type=float, default=30.0, help="seconds between bursts")
+    parser.add_argument("--duration", type=float, default=60.0, help="seconds to run")
+    parser.add_argument("--mix", type=parse_mix, default={"json": 1.0}, help="variant weights, e.g. json=8,hex=1,malformed=1")
+    parser.add_argument("--reorder", type=float, default=0.0, help="share of readings timestamped up to --reorder-by in the past")
+    parser.add_argument("--reorder-by", type=int, default=600, help="seconds")
+    parser.add_argument("--retain", action="store_true", help="publish as retained messages")
+    parser.add_argument("--storm", type=int, default=0, help="broker only: retained readings on that many ruuvitag/storm/N topics before the run, not subscribed by the display")
+    parser.add_argument("--clear", action="store_true", help="clear the retained messages this run left behind")
+    parser.add_argument("--replay", help="file of '<topic> <payload>' lines to send instead of synthetic readings")
+    parser.add_argument("--metrics", help="display /metrics URL, read before and after the run")
+    parser.add_argument("--seed", type=int, help="random seed for a repeatable run")
+    args = parser.parse_args()
+    random.seed(args.seed)
+
+    tags = args.topic or ["ruuvitag/F9:81:78:B2:70:BE", "ruuvitag/ED:30:75:FE:CD:37", "ruuvitag/CD:8C:07:25:4B:54"]
+    topics = tags + ["%s/fanout%d" % (tag, i) for tag in tags for i in range(args.fanout)]
+    names = list(args.mix)
+    weights = [args.mix[name] for name in names]
+
+    client = mqtt.Client()
+    if args.username:
+        client.username_pw_set(args.username, args.password)
+    client.connect(args.host, args.port)
+    client.loop_start()
+    before = read_metrics(args.metrics) if args.metrics else {}
+
+    stats = {"messages": 0, "bytes": 0, "subscribed": 0, "reordered": 0, "late": 0}
+    sent = dict((name, 0) for name in VARIANTS + ["replay"])
+    retained = set()
+
+    def publish(topic, payload, retain):
+        client.publish(topic, payload, retain=retain)
+        if retain:
+            retained.add(topic)
+        stats["messages"] += 1
+        stats["bytes"] += len(payload)
+        if topic in tags:
+            stats["subscribed"] += 1
+
+    started = time.time()
+    for i in range(args.storm):
+        publish("ruuvitag/storm/%d" % i, encode("json", synthetic_reading(i, i, int(started)), i), True)
+    storm_s = time.time() - started
+
+    started = time.time()
+    if args.replay:
+        with open(args.replay) as f:
+            for line in f:
+                topic, _, payload = line.rstrip("\n").partition(" ")
+                if topic:
+                    publish(topic, payload.encode(), args.retain)
+                    sent["replay"] += 1
+                    time.sleep(1.0 / args.rate if args.rate > 0 else 0)
+    else:
+        for sequence, (offset, index) in enumerate(schedule(args, topics)):
+            delay = started + offset - time.time()
+            if delay > 0:
+                time.sleep(delay)
+            elif delay < -0.1:
+                stats["late"] += 1
+            timestamp = int(time.time())
+            if random.random() < args.reorder:
+                timestamp -= random.randint(1, args.reorder_by)
+                stats["reordered"] += 1
+            variant = random.choices(names, weights)[0]
+            publish(topics[index], encode(variant, synthetic_reading(index % len(tags), sequence, timestamp), index), args.retain)
+            sent[variant] += 1
+    elapsed = time.time() - started
+
+    if args.clear:
+        for topic in retained:
+            client.publish(topic, b"", retain=True)
+    client.loop_stop()
+    client.disconnect()
+
+    print("%d messages, %d bytes in %.1f s, %.1f msg/s, %d sent late" % (
+        stats["messages"], stats["bytes"], elapsed, stats["messages"] / max(elapsed, 1e-9), stats["late"]))
+    print("variants: " + ", ".join("%s %d" % (name, count) for name, count in sent.items() if count))
+    if args.storm:
+        print("storm: %d retained topics in %.2f s, broker only" % (args.storm, storm_s))
+    if args.reorder:
+        print("reordered timestamps: %d" % stats["reordered"])
+    if args.metrics:
+        after = read_metrics(args.metrics)
+        print("display, %d of %d messages sent on its topics:" % (stats["subscribed"], stats["messages"]))
+        for name in METRICS:
+            if name in after:
+                print("  %s +%d" % (name, after[name] - before.get(name, 0)))
+        for phase in ["data", "refresh"]:
+            key = 'display_phase_milliseconds{phase="%s"}' % phase
+            if after.get(key):
+                print("  %s phase at %d ms into the wake" % (phase, after[key]))
+
+
+if __name__ == "__main__":
+    main()
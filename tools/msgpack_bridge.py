@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+Republish JSON Ruuvi readings from a local broker as MessagePack.
+
+The display accepts both encodings on the same topic and tells them apart
+by the first byte, so point a tag topic in the display configuration at
+the republished topic to switch it over.
+
+    pip install paho-mqtt msgpack
+    python3 tools/msgpack_bridge.py --host localhost --source 'ruuvitag/#' --prefix ruuvitag-mp
+
+Prints the bytes on the wire for both encodings every --report seconds.
+"""
+
+import argparse
+import json
+import time
+
+import msgpack
+import paho.mqtt.client as mqtt
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--username")
+    parser.add_argument("--password")
+    parser.add_argument("--source", default="ruuvitag/#", help="topic filter to read JSON readings from")
+    parser.add_argument("--prefix", default="ruuvitag-mp", help="replaces the first topic level when republishing")
+    parser.add_argument("--retain", action="store_true", help="republish as retained messages")
+    parser.add_argument("--report", type=float, default=10.0, help="seconds between size reports")
+    args = parser.parse_args()
+
+    stats = {"messages": 0, "json": 0, "msgpack": 0, "skipped": 0}
+
+    def on_connect(client, userdata, flags, rc):
+        client.subscribe(args.source)
+
+    def on_message(client, userdata, message):
+        if message.topic.startswith(args.prefix + "/"):
+            return
+        try:
+            reading = json.loads(message.payload)
+        except ValueError:
+            stats["skipped"] += 1
+            return
+        if not isinstance(reading, dict):
+            stats["skipped"] += 1
+            return
+        packed = msgpack.packb(reading, use_single_float=True)
+        topic = args.prefix + "/" + message.topic.split("/", 1)[-1]
+        client.publish(topic, packed, retain=args.retain)
+        stats["messages"] += 1
+        stats["json"] += len(message.payload)
+        stats["msgpack"] += len(packed)
+
+    client = mqtt.Client()
+    if args.username:
+        client.username_pw_set(args.username, args.password)
+    client.on_connect = on_connect
+    client.on_message = on_message
+    client.connect(args.host, args.port)
+    client.loop_start()
+
+    try:
+        while True:
+            time.sleep(args.report)
+            if stats["messages"]:
+                print("%d messages: json %d bytes, msgpack %d bytes (%.0f%%), %d skipped" % (
+                    stats["messages"], stats["json"], stats["msgpack"],
+                    100.0 * stats["msgpack"] / stats["json"], stats["skipped"]))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        client.loop_stop()
+        client.disconnect()
+
+
+if __name__ == "__main__":
+    main()